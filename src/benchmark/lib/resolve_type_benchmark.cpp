@@ -0,0 +1,25 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+void BM_MakeSharedByColumnType(benchmark::State& state) {
+  const auto type_string = column_type_string<T>();
+  for (auto _ : state) {
+    auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(type_string);
+    benchmark::DoNotOptimize(column);
+  }
+}
+
+static const auto registered_make_shared = register_for_all_column_types(
+    "BM_MakeSharedByColumnType", [](auto type) { return &BM_MakeSharedByColumnType<typename decltype(type)::type>; },
+    [](auto* benchmark) {});
+
+}  // namespace opossum
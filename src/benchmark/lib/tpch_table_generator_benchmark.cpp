@@ -0,0 +1,51 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Generates the lineitems of scale factor 0.01 (about 60'000 rows) with the given number of workers
+static void BM_TpchTableGenerator(benchmark::State& state) {
+  const auto generator = TpchTableGenerator{0.01, 10'000, static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(generator.generate_table(TpchTable::LineItem));
+  }
+  state.SetItemsProcessed(state.iterations() * generator.row_count(TpchTable::LineItem));
+}
+BENCHMARK(BM_TpchTableGenerator)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+// For comparison, adds the same lineitems row by row, as a generator on top of Table::append would
+static void BM_TpchTableAppend(benchmark::State& state) {
+  const auto line_items = TpchTableGenerator{0.01, 10'000, 1}.generate_table(TpchTable::LineItem);
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  rows.reserve(line_items->row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < line_items->chunk_count(); ++chunk_id) {
+    const auto& chunk = line_items->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      auto& row = rows.emplace_back();
+      for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+        row.push_back((*chunk.get_column(column_id))[chunk_offset]);
+      }
+    }
+  }
+
+  for (auto _ : state) {
+    auto table = Table{10'000};
+    for (auto column_id = ColumnID{0}; column_id < line_items->col_count(); ++column_id) {
+      table.add_column(line_items->column_name(column_id), line_items->column_data_type(column_id));
+    }
+    for (const auto& row : rows) {
+      table.append(row);
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_TpchTableAppend);
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+// Casts a variant holding the same type, which is the fast path of type_cast
+template <typename T>
+void BM_TypeCastSameType(benchmark::State& state) {
+  const auto variant = AllTypeVariant{generate_benchmark_value<T>(42)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(type_cast<T>(variant));
+  }
+}
+
+// Casts a variant holding a different type to T
+template <typename T, typename FromType>
+void BM_TypeCastFrom(benchmark::State& state) {
+  const auto variant = AllTypeVariant{generate_benchmark_value<FromType>(42)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(type_cast<T>(variant));
+  }
+}
+
+static const auto registered_same_type = register_for_all_column_types(
+    "BM_TypeCastSameType", [](auto type) { return &BM_TypeCastSameType<typename decltype(type)::type>; },
+    [](auto* benchmark) {});
+
+static const auto registered_from_int = register_for_all_column_types(
+    "BM_TypeCastFromInt", [](auto type) { return &BM_TypeCastFrom<typename decltype(type)::type, int32_t>; },
+    [](auto* benchmark) {});
+
+static const auto registered_from_double = register_for_all_column_types(
+    "BM_TypeCastFromDouble", [](auto type) { return &BM_TypeCastFrom<typename decltype(type)::type, double>; },
+    [](auto* benchmark) {});
+
+// Strings holding a number, i.e., the typical case when importing data
+template <typename T>
+void BM_TypeCastFromNumericString(benchmark::State& state) {
+  const auto variant = AllTypeVariant{std::string{"42"}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(type_cast<T>(variant));
+  }
+}
+
+static const auto registered_from_string = register_for_all_column_types(
+    "BM_TypeCastFromNumericString",
+    [](auto type) { return &BM_TypeCastFromNumericString<typename decltype(type)::type>; }, [](auto* benchmark) {});
+
+}  // namespace opossum
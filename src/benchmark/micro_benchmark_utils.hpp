@@ -0,0 +1,81 @@
+#pragma once
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Chunk sizes that micro benchmarks are run with. 0 is an unlimited chunk size.
+constexpr int64_t BENCHMARK_CHUNK_SIZES[] = {0, 1'000, 10'000, 100'000};
+
+// Number of rows used by benchmarks that operate on a full table or column
+constexpr int64_t BENCHMARK_ROW_COUNT = 100'000;
+
+// Returns a deterministic value of type T for the given index. Strings have a length that does not fit into SSO.
+template <typename T>
+T generate_benchmark_value(const int64_t index) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return "benchmark_value_" + std::to_string(index);
+  } else {
+    return static_cast<T>(index);
+  }
+}
+
+// Returns the string representation of T as used for column definitions, e.g., "int" for int32_t
+template <typename T>
+std::string column_type_string() {
+  return hana::first(
+      *hana::find_if(column_types, [](auto type_pair) { return hana::second(type_pair) == hana::type_c<T>; }));
+}
+
+// Creates a table with a single column of type_string filled with row_count values
+inline std::shared_ptr<Table> create_benchmark_table(const std::string& type_string, const uint32_t chunk_size,
+                                                     const int64_t row_count) {
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", type_string);
+  resolve_data_type(type_string, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      table->append({generate_benchmark_value<ColumnDataType>(index)});
+    }
+  });
+  return table;
+}
+
+/**
+ * Registers a benchmark template once for every type in COLUMN_TYPES. The benchmark's name is suffixed with the type,
+ * e.g., BM_ValueColumnAppend<int>. The returned value is meant to be stored in a static variable so that the
+ * registration happens during static initialization:
+ *
+ *   template <typename T>
+ *   void BM_Foo(benchmark::State& state) { ... }
+ *
+ *   static const auto registered = register_for_all_column_types("BM_Foo", [](auto type) {
+ *     return &BM_Foo<typename decltype(type)::type>;
+ *   }, [](auto* benchmark) { benchmark->Arg(42); });
+ */
+template <typename GetFunction, typename Configure>
+bool register_for_all_column_types(const std::string& name, const GetFunction& get_function,
+                                   const Configure& configure) {
+  hana::for_each(column_types, [&](auto type_pair) {
+    const auto benchmark_name = name + "<" + std::string(hana::first(type_pair)) + ">";
+    configure(benchmark::RegisterBenchmark(benchmark_name.c_str(), get_function(+hana::second(type_pair))));
+  });
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/materialize.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// Returns every other row of table, in random order
+std::shared_ptr<const PosList> create_benchmark_pos_list(const Table& table) {
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < table.get_chunk(chunk_id).size(); chunk_offset += 2) {
+      pos_list->push_back({chunk_id, chunk_offset});
+    }
+  }
+  std::shuffle(pos_list->begin(), pos_list->end(), std::mt19937{42});
+  return pos_list;
+}
+
+// Materializes positions into a table row by row, i.e., without Materialize
+template <typename T>
+void BM_MaterializeRowByRow(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto table = create_benchmark_table(column_type_string<T>(), chunk_size, BENCHMARK_ROW_COUNT);
+  const auto pos_list = create_benchmark_pos_list(*table);
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  for (auto _ : state) {
+    auto output = Table{chunk_size};
+    output.add_column("a", column_type_string<T>());
+    for (const auto& row_id : *pos_list) {
+      output.append({(*table->get_chunk(row_id.chunk_id).get_column(ColumnID{0}))[row_id.chunk_offset]});
+    }
+    benchmark::DoNotOptimize(output.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * pos_list->size());
+}
+
+template <typename T>
+void BM_MaterializeGather(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto table = create_benchmark_table(column_type_string<T>(), chunk_size, BENCHMARK_ROW_COUNT);
+  const auto pos_list = create_benchmark_pos_list(*table);
+
+  for (auto _ : state) {
+    auto column = Materialize::gather(*table, ColumnID{0}, *pos_list);
+    benchmark::DoNotOptimize(column);
+  }
+  state.SetItemsProcessed(state.iterations() * pos_list->size());
+}
+
+static const auto registered_row_by_row = register_for_all_column_types(
+    "BM_MaterializeRowByRow", [](auto type) { return &BM_MaterializeRowByRow<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(10'000); });
+
+static const auto registered_gather = register_for_all_column_types(
+    "BM_MaterializeGather", [](auto type) { return &BM_MaterializeGather<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(10'000); });
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "expression/expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_wrapper.hpp"
+#include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// Evaluates a * (a + 1) by interpreting the expression for every row, i.e., without Projection
+template <typename T>
+void BM_ProjectionRowByRow(benchmark::State& state) {
+  const auto table = create_benchmark_table(column_type_string<T>(), 10'000, BENCHMARK_ROW_COUNT);
+  const auto expression = Expression::column(ColumnID{0}) * (Expression::column(ColumnID{0}) + Expression::literal(1));
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  for (auto _ : state) {
+    auto output = Table{10'000};
+    output.add_column("x", column_type_string<T>());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& column = *table->get_chunk(chunk_id).get_column(expression->left()->column_id());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column.size(); ++chunk_offset) {
+        const auto value = type_cast<T>(column[chunk_offset]);
+        const auto addend = type_cast<T>(expression->right()->right()->value());
+        output.append({static_cast<T>(value * (value + addend))});
+      }
+    }
+    benchmark::DoNotOptimize(output.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+template <typename T>
+void BM_Projection(benchmark::State& state) {
+  const auto table = create_benchmark_table(column_type_string<T>(), 10'000, BENCHMARK_ROW_COUNT);
+  const auto expression = Expression::column(ColumnID{0}) * (Expression::column(ColumnID{0}) + Expression::literal(1));
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    auto projection = std::make_shared<Projection>(table_wrapper, std::vector<ProjectionDefinition>{{expression, "x"}});
+    projection->execute();
+    benchmark::DoNotOptimize(projection->get_output());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+BENCHMARK_TEMPLATE(BM_ProjectionRowByRow, int32_t);
+BENCHMARK_TEMPLATE(BM_ProjectionRowByRow, double);
+BENCHMARK_TEMPLATE(BM_Projection, int32_t);
+BENCHMARK_TEMPLATE(BM_Projection, double);
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/result_cache.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Point query on a column of unique, unordered strings, where the first argument toggles Bloom filters
+static void BM_TableScanPointQuery(benchmark::State& state) {
+  const auto table = create_benchmark_table("string", 10'000, BENCHMARK_ROW_COUNT);
+  if (state.range(0)) table->enable_bloom_filter(ColumnID{0}, 0.01);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto search_value = generate_benchmark_value<std::string>(BENCHMARK_ROW_COUNT / 2);
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, search_value);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+}
+BENCHMARK(BM_TableScanPointQuery)->ArgName("bloom_filter")->Arg(0)->Arg(1);
+
+// Range query on an evictable table, where the first argument is the BufferManager's budget in percent of the table's
+// size. Below 100%, every scan reloads chunks from the spill directory.
+static void BM_TableScanEvictedChunks(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 10'000, 10 * BENCHMARK_ROW_COUNT);
+  table->enable_eviction();
+  BufferManager::get().set_memory_budget(BufferManager::get().resident_bytes() * state.range(0) / 100);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 0);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+
+  BufferManager::get().set_memory_budget(0);
+}
+BENCHMARK(BM_TableScanEvictedChunks)->ArgName("budget_percent")->Arg(100)->Arg(50);
+
+// Range query on the ship dates of TPC-H lineitems (scale factor 0.1), where the first argument toggles merging the
+// table, i.e., dictionary-encoding its chunks. Merged, the scan compares 2-byte value ids instead of strings.
+static void BM_TableScanDictionaryColumn(benchmark::State& state) {
+  const auto table = TpchTableGenerator{0.1, 100'000}.generate_table(TpchTable::LineItem);
+  if (state.range(0)) table->merge_delta();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column_id = table->column_id_by_name("l_shipdate");
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, column_id, ScanType::OpLessThan, "1995-01-01");
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+BENCHMARK(BM_TableScanDictionaryColumn)->ArgName("merged")->Arg(0)->Arg(1);
+
+// Repeats a range query while rows are appended to the table in between, where the first argument toggles the
+// ResultCache. With the cache, only the chunks that have not been sealed before are scanned again.
+static void BM_TableScanResultCache(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 10'000, 10 * BENCHMARK_ROW_COUNT);
+  if (state.range(0)) ResultCache::get().set_memory_budget(size_t{1} << 30);
+
+  auto index = int32_t{0};
+  for (auto _ : state) {
+    table->append({index++});
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1'000);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+
+  ResultCache::get().set_memory_budget(0);
+}
+BENCHMARK(BM_TableScanResultCache)->ArgName("result_cache")->Arg(0)->Arg(1);
+
+// Substring search in a column of log lines, where the first argument toggles trigram indexes. With them, only the few
+// rows that contain all trigrams of the pattern are checked.
+static void BM_TableScanLike(benchmark::State& state) {
+  const auto table = std::make_shared<Table>(100'000);
+  table->add_column("line", "string");
+  if (state.range(0)) table->enable_trigram_index(ColumnID{0});
+  for (auto index = int64_t{0}; index < 10 * BENCHMARK_ROW_COUNT; ++index) {
+    table->append_compact({CompactValue{"GET /api/items/" + std::to_string(index) + " HTTP/1.1 200 user=" +
+                                        std::to_string(index % 1'000)}});
+  }
+  table->seal_last_chunk();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, "%/items/4242 %");
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+BENCHMARK(BM_TableScanLike)->ArgName("trigram_index")->Arg(0)->Arg(1);
+
+// Substring search in the ship modes of TPC-H lineitems (scale factor 0.1), where the first argument toggles merging
+// the table. Merged, the pattern is checked once per dictionary entry rather than once per row.
+static void BM_TableScanLikeDictionary(benchmark::State& state) {
+  const auto table = TpchTableGenerator{0.1, 100'000}.generate_table(TpchTable::LineItem);
+  if (state.range(0)) table->merge_delta();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column_id = table->column_id_by_name("l_shipmode");
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, column_id, ScanType::OpLike, "%AIR%");
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+BENCHMARK(BM_TableScanLikeDictionary)->ArgName("merged")->Arg(0)->Arg(1);
+
+}  // namespace opossum
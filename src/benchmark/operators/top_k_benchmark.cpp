@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+// Creates a table of 1M ints in sealed chunks of 10,000 rows. If clustered is set, the values ascend with the rows, so
+// that TopK can skip almost all chunks using their min/max. Otherwise, the values are shuffled.
+std::shared_ptr<Table> create_top_k_benchmark_table(const bool clustered) {
+  constexpr auto row_count = size_t{1'000'000};
+  constexpr auto chunk_size = size_t{10'000};
+
+  auto values = std::vector<int32_t>(row_count);
+  std::iota(values.begin(), values.end(), 0);
+  if (!clustered) std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column_definition("a", "int");
+  for (auto begin = size_t{0}; begin < row_count; begin += chunk_size) {
+    auto chunk = Chunk{};
+    chunk.add_column(std::make_shared<ValueColumn<int32_t>>(
+        pmr_vector<int32_t>(values.begin() + begin, values.begin() + begin + chunk_size)));
+    table->emplace_chunk(std::move(chunk));
+  }
+  table->seal_last_chunk();
+  return table;
+}
+
+// Determines the 100 smallest values by sorting all (value, position) pairs, i.e., without TopK
+static void BM_TopKFullSort(benchmark::State& state) {
+  const auto table = create_top_k_benchmark_table(state.range(0));
+
+  for (auto _ : state) {
+    auto rows = std::vector<std::pair<int32_t, RowID>>{};
+    rows.reserve(table->row_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& values =
+          static_cast<const ValueColumn<int32_t>&>(*table->get_chunk(chunk_id).get_column(ColumnID{0})).values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+        rows.emplace_back(values[chunk_offset], RowID{chunk_id, chunk_offset});
+      }
+    }
+    std::sort(rows.begin(), rows.end());
+    rows.resize(100);
+    benchmark::DoNotOptimize(rows.data());
+  }
+}
+BENCHMARK(BM_TopKFullSort)->ArgName("clustered")->Arg(0)->Arg(1);
+
+static void BM_TopK(benchmark::State& state) {
+  auto table_wrapper = std::make_shared<TableWrapper>(create_top_k_benchmark_table(state.range(0)));
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    auto top_k = std::make_shared<TopK>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 100);
+    top_k->execute();
+    benchmark::DoNotOptimize(top_k->get_output());
+  }
+}
+BENCHMARK(BM_TopK)->ArgName("clustered")->Arg(0)->Arg(1);
+
+}  // namespace opossum
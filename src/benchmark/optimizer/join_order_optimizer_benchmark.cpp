@@ -0,0 +1,92 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "optimizer/join_order_optimizer.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A fact table referencing a small dimension, of which all rows qualify, and a large dimension, of which one row does
+JoinGraph create_star_join_graph() {
+  auto facts = std::make_shared<Table>(10'000);
+  facts->add_column("f_small_id", "int");
+  facts->add_column("f_large_id", "int");
+  for (auto index = int32_t{0}; index < BENCHMARK_ROW_COUNT; ++index) {
+    facts->append({index % 10, index % 1'000});
+  }
+
+  auto small = std::make_shared<Table>(10'000);
+  small->add_column("s_id", "int");
+  for (auto index = int32_t{0}; index < 10; ++index) {
+    small->append({index});
+  }
+
+  auto large = std::make_shared<Table>(10'000);
+  large->add_column("l_id", "int");
+  large->add_column("l_value", "int");
+  for (auto index = int32_t{0}; index < 1'000; ++index) {
+    large->append({index, index * 10});
+  }
+
+  for (const auto& table : {facts, small, large}) {
+    table->enable_statistics();
+  }
+
+  auto join_graph = JoinGraph{};
+  join_graph.vertices.push_back(JoinVertex{facts, {}});
+  join_graph.vertices.push_back(JoinVertex{small, {}});
+  join_graph.vertices.push_back(JoinVertex{large, {ScanPredicate{ColumnID{1}, ScanType::OpEquals, 4'200}}});
+  join_graph.edges.push_back(JoinEdge{0, ColumnID{0}, 1, ColumnID{0}});
+  join_graph.edges.push_back(JoinEdge{0, ColumnID{1}, 2, ColumnID{0}});
+  return join_graph;
+}
+
+}  // namespace
+
+// Joins the facts with the small dimension first, which keeps every fact in the intermediate result, and then with the
+// filtered large dimension
+static void BM_StarJoinInQueryOrder(benchmark::State& state) {
+  using ColumnIDPairs = std::vector<std::pair<ColumnID, ColumnID>>;
+  const auto join_graph = create_star_join_graph();
+
+  for (auto _ : state) {
+    auto facts = std::make_shared<TableWrapper>(join_graph.vertices[0].table);
+    auto small = std::make_shared<TableWrapper>(join_graph.vertices[1].table);
+    auto large = std::make_shared<TableWrapper>(join_graph.vertices[2].table);
+    auto large_scan = std::make_shared<TableScan>(large, ColumnID{1}, ScanType::OpEquals, 4'200);
+    auto first_join = std::make_shared<JoinHash>(facts, small, ColumnIDPairs{{ColumnID{0}, ColumnID{0}}});
+    auto second_join = std::make_shared<JoinHash>(first_join, large_scan, ColumnIDPairs{{ColumnID{1}, ColumnID{0}}});
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{facts, small, large, large_scan, first_join,
+                                                                           second_join}) {
+      op->execute();
+    }
+    benchmark::DoNotOptimize(second_join->get_output()->row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+BENCHMARK(BM_StarJoinInQueryOrder);
+
+// Lets the JoinOrderOptimizer choose the order, which joins the facts with the filtered large dimension first. The
+// optimization is part of the measured time.
+static void BM_StarJoinInOptimizedOrder(benchmark::State& state) {
+  const auto join_graph = create_star_join_graph();
+
+  for (auto _ : state) {
+    const auto plan = JoinOrderOptimizer{}.optimize(join_graph);
+    benchmark::DoNotOptimize(plan.execute()->row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+BENCHMARK(BM_StarJoinInOptimizedOrder);
+
+}  // namespace opossum
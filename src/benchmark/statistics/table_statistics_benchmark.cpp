@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <unordered_set>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+// Counts the distinct values of a column exactly, which needs to look at every row
+static void BM_ExactDistinctCount(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 100'000, state.range(0));
+
+  for (auto _ : state) {
+    auto distinct_values = std::unordered_set<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto column = table->get_chunk(chunk_id).get_column(ColumnID{0});
+      const auto& values = static_cast<const ValueColumn<int32_t>&>(*column).values();
+      distinct_values.insert(values.begin(), values.end());
+    }
+    benchmark::DoNotOptimize(distinct_values.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExactDistinctCount)->ArgName("rows")->Arg(BENCHMARK_ROW_COUNT)->Arg(10 * BENCHMARK_ROW_COUNT);
+
+// Estimates the distinct values of a column from the table's statistics, which only merges the sketch of the last chunk
+static void BM_EstimatedDistinctCount(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 100'000, state.range(0));
+  table->enable_statistics();
+  table->seal_last_chunk();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table->table_statistics()->estimate_distinct_count(ColumnID{0}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EstimatedDistinctCount)->ArgName("rows")->Arg(BENCHMARK_ROW_COUNT)->Arg(10 * BENCHMARK_ROW_COUNT);
+
+// Appends rows to a table, where the first argument toggles the statistics that are built when chunks are sealed
+static void BM_TableAppendWithStatistics(benchmark::State& state) {
+  for (auto _ : state) {
+    auto table = Table{10'000};
+    table.add_column("a", "int");
+    if (state.range(0)) table.enable_statistics();
+    for (auto index = int64_t{0}; index < BENCHMARK_ROW_COUNT; ++index) {
+      table.append_compact({CompactValue{static_cast<int32_t>(index)}});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+BENCHMARK(BM_TableAppendWithStatistics)->ArgName("statistics")->Arg(0)->Arg(1);
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/arrow_converter.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Exports every chunk of a table as a record batch and releases it
+template <typename T>
+void BM_ArrowExport(benchmark::State& state) {
+  const auto table = create_benchmark_table(column_type_string<T>(), 10'000, BENCHMARK_ROW_COUNT);
+
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      auto batch = ArrowArray{};
+      ArrowConverter::export_chunk(table->get_chunk(chunk_id), &batch);
+      benchmark::DoNotOptimize(batch.children[0]->buffers[1]);
+      batch.release(&batch);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+// Imports the record batches of a table, which is compared to appending its rows in BM_TableAppend
+template <typename T>
+void BM_ArrowImport(benchmark::State& state) {
+  const auto table = create_benchmark_table(column_type_string<T>(), 10'000, BENCHMARK_ROW_COUNT);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto schema = ArrowSchema{};
+    ArrowConverter::export_schema(*table, &schema);
+    auto batches = std::vector<ArrowArray>(table->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      ArrowConverter::export_chunk(table->get_chunk(chunk_id), &batches[chunk_id]);
+    }
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(ArrowConverter::import_table(&schema, batches));
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+static const auto registered_export = register_for_all_column_types(
+    "BM_ArrowExport", [](auto type) { return &BM_ArrowExport<typename decltype(type)::type>; }, [](auto*) {});
+
+static const auto registered_import = register_for_all_column_types(
+    "BM_ArrowImport", [](auto type) { return &BM_ArrowImport<typename decltype(type)::type>; }, [](auto*) {});
+
+}  // namespace opossum
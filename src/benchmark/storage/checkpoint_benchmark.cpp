@@ -0,0 +1,94 @@
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/checkpoint.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::string checkpoint_benchmark_directory() {
+  const auto temp_directory = std::getenv("TMPDIR");
+  const auto base_directory = std::string{temp_directory && *temp_directory ? temp_directory : "/tmp"};
+  return base_directory + "/hyrise_checkpoint_benchmark_" + std::to_string(getpid());
+}
+
+void remove_checkpoint_benchmark_directory(const std::string& path) {
+  if (const auto directory = opendir(path.c_str())) {
+    while (const auto entry = readdir(directory)) {
+      std::remove((path + "/" + entry->d_name).c_str());
+    }
+    closedir(directory);
+  }
+  rmdir(path.c_str());
+}
+
+// Registers a table of 100 sealed chunks and an unsealed one, as left behind by ongoing ingest
+void add_checkpoint_benchmark_table() {
+  StorageManager::reset();
+  auto table = create_benchmark_table("int", 10'000, 1'005'000);
+  StorageManager::get().add_table("benchmark", table);
+}
+
+}  // namespace
+
+// Writes a checkpoint into an empty directory, or (if incremental) into one that already holds the sealed chunks
+static void BM_CheckpointWrite(benchmark::State& state) {
+  const auto incremental = state.range(0) != 0;
+  const auto directory = checkpoint_benchmark_directory();
+  remove_checkpoint_benchmark_directory(directory);
+  add_checkpoint_benchmark_table();
+  if (incremental) Checkpoint{directory}.write();
+
+  for (auto _ : state) {
+    if (!incremental) {
+      state.PauseTiming();
+      remove_checkpoint_benchmark_directory(directory);
+      state.ResumeTiming();
+    }
+    Checkpoint{directory}.write();
+  }
+
+  remove_checkpoint_benchmark_directory(directory);
+  StorageManager::reset();
+}
+BENCHMARK(BM_CheckpointWrite)->ArgName("incremental")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Restarts from a checkpoint. Sealed chunks are loaded lazily, unless all of them are accessed right away (touch_all).
+static void BM_CheckpointLoad(benchmark::State& state) {
+  const auto touch_all = state.range(0) != 0;
+  const auto directory = checkpoint_benchmark_directory();
+  remove_checkpoint_benchmark_directory(directory);
+  add_checkpoint_benchmark_table();
+  Checkpoint{directory}.write();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    StorageManager::reset();
+    state.ResumeTiming();
+
+    Checkpoint::load(directory);
+    if (touch_all) {
+      const auto table = StorageManager::get().get_table("benchmark");
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        benchmark::DoNotOptimize(table->get_chunk(chunk_id).get_column(ColumnID{0}));
+      }
+    }
+  }
+
+  remove_checkpoint_benchmark_directory(directory);
+  StorageManager::reset();
+}
+BENCHMARK(BM_CheckpointLoad)->ArgName("touch_all")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
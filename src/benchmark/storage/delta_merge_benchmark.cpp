@@ -0,0 +1,56 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "storage/delta_merge.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Encodes the lineitems of scale factor 0.01 (about 60'000 rows in 16 columns) with the given number of workers
+static void BM_DeltaMerge(benchmark::State& state) {
+  const auto line_items = TpchTableGenerator{0.01, 10'000}.generate_table(TpchTable::LineItem);
+  for (auto _ : state) {
+    auto delta_merge = DeltaMerge{*line_items, ChunkID{0}};
+    delta_merge.encode(static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(delta_merge.chunk_count());
+  }
+  state.SetItemsProcessed(state.iterations() * line_items->row_count());
+}
+BENCHMARK(BM_DeltaMerge)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+// Appends the lineitems row by row, where the first argument is the number of sealed chunks after which the delta is
+// merged in the background (0 for never)
+static void BM_TableAppendWithDeltaMerge(benchmark::State& state) {
+  const auto line_items = TpchTableGenerator{0.01, 5'000, 1}.generate_table(TpchTable::LineItem);
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  rows.reserve(line_items->row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < line_items->chunk_count(); ++chunk_id) {
+    const auto& chunk = line_items->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      auto& row = rows.emplace_back();
+      for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+        row.push_back((*chunk.get_column(column_id))[chunk_offset]);
+      }
+    }
+  }
+
+  for (auto _ : state) {
+    auto table = Table{5'000};
+    for (auto column_id = ColumnID{0}; column_id < line_items->col_count(); ++column_id) {
+      table.add_column(line_items->column_name(column_id), line_items->column_data_type(column_id));
+    }
+    if (state.range(0)) table.enable_delta_merge(ChunkID{static_cast<ChunkID::base_type>(state.range(0))});
+    for (const auto& row : rows) {
+      table.append(row);
+    }
+    benchmark::DoNotOptimize(table.main_chunk_count());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_TableAppendWithDeltaMerge)->ArgName("max_delta_chunks")->Arg(0)->Arg(2)->Arg(4)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/hash_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of keys that are looked up per benchmark iteration, in random order so that most lookups miss the caches
+constexpr size_t LOOKUP_COUNT = 10'000;
+
+std::vector<int32_t> generate_lookup_keys(const int64_t row_count) {
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, static_cast<int32_t>(row_count - 1)};
+  auto keys = std::vector<int32_t>(LOOKUP_COUNT);
+  std::generate(keys.begin(), keys.end(), [&]() { return distribution(random_engine); });
+  return keys;
+}
+
+}  // namespace
+
+// Looks up unique keys one by one in the index of a table with the given number of rows
+static void BM_HashIndexLookup(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 100'000, state.range(0));
+  table->enable_hash_index(ColumnID{0});
+  const auto& hash_index = static_cast<const HashIndex<int32_t>&>(*table->get_hash_index(ColumnID{0}));
+  const auto keys = generate_lookup_keys(state.range(0));
+
+  auto row_ids = PosList{};
+  row_ids.reserve(keys.size());
+  for (auto _ : state) {
+    row_ids.clear();
+    for (const auto key : keys) {
+      hash_index.lookup(key, row_ids);
+    }
+    benchmark::DoNotOptimize(row_ids.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_HashIndexLookup)->ArgName("rows")->Arg(BENCHMARK_ROW_COUNT)->Arg(10 * BENCHMARK_ROW_COUNT);
+
+// Same as BM_HashIndexLookup, but probes all keys at once so that their cache misses overlap
+static void BM_HashIndexBatchedLookup(benchmark::State& state) {
+  const auto table = create_benchmark_table("int", 100'000, state.range(0));
+  table->enable_hash_index(ColumnID{0});
+  const auto& hash_index = static_cast<const HashIndex<int32_t>&>(*table->get_hash_index(ColumnID{0}));
+  const auto keys = generate_lookup_keys(state.range(0));
+
+  auto row_ids = PosList{};
+  auto row_id_ends = std::vector<size_t>{};
+  row_ids.reserve(keys.size());
+  row_id_ends.reserve(keys.size());
+  for (auto _ : state) {
+    row_ids.clear();
+    row_id_ends.clear();
+    hash_index.lookup(keys, row_ids, row_id_ends);
+    benchmark::DoNotOptimize(row_ids.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_HashIndexBatchedLookup)->ArgName("rows")->Arg(BENCHMARK_ROW_COUNT)->Arg(10 * BENCHMARK_ROW_COUNT);
+
+// Appends rows to a table with an index, where the first argument toggles the index
+static void BM_TableAppendWithHashIndex(benchmark::State& state) {
+  for (auto _ : state) {
+    auto table = Table{10'000};
+    table.add_column("a", "int");
+    if (state.range(0)) table.enable_hash_index(ColumnID{0});
+    for (auto index = int64_t{0}; index < BENCHMARK_ROW_COUNT; ++index) {
+      table.append_compact({CompactValue{static_cast<int32_t>(index)}});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+BENCHMARK(BM_TableAppendWithHashIndex)->ArgName("hash_index")->Arg(0)->Arg(1);
+
+}  // namespace opossum
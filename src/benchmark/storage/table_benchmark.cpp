@@ -0,0 +1,92 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+void BM_TableAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto row = std::vector<AllTypeVariant>{generate_benchmark_value<T>(42), generate_benchmark_value<T>(43)};
+  const auto type_string = column_type_string<T>();
+
+  for (auto _ : state) {
+    auto table = Table{chunk_size};
+    table.add_column("a", type_string);
+    table.add_column("b", type_string);
+    for (auto index = int64_t{0}; index < BENCHMARK_ROW_COUNT; ++index) {
+      table.append(row);
+    }
+    benchmark::DoNotOptimize(table.chunk_count());
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+// Iterates over all values of a table using the generic (and slow) BaseColumn::operator[]
+template <typename T>
+void BM_TableIteration(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto type_string = column_type_string<T>();
+  const auto table = create_benchmark_table(type_string, chunk_size, BENCHMARK_ROW_COUNT);
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      const auto column = chunk.get_column(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto value = (*column)[chunk_offset];
+        benchmark::DoNotOptimize(value);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+// Iterates over all values of a table by resolving the column type once per chunk
+template <typename T>
+void BM_TableIterationResolved(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto table = create_benchmark_table(column_type_string<T>(), chunk_size, BENCHMARK_ROW_COUNT);
+
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto column = table->get_chunk(chunk_id).get_column(ColumnID{0});
+      resolve_column_type(*column, [&](auto type, const auto& typed_column) {
+        // The table is not merged, so all of its columns are ValueColumns
+        if constexpr (!is_dictionary_column<decltype(typed_column)>::value) {
+          for (const auto& value : typed_column.values()) {
+            benchmark::DoNotOptimize(value);
+          }
+        }
+      });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_ROW_COUNT);
+}
+
+static const auto configure_chunk_sizes = [](auto* benchmark) {
+  for (const auto chunk_size : BENCHMARK_CHUNK_SIZES) {
+    benchmark->Arg(chunk_size);
+  }
+};
+
+static const auto registered_append = register_for_all_column_types(
+    "BM_TableAppend", [](auto type) { return &BM_TableAppend<typename decltype(type)::type>; }, configure_chunk_sizes);
+
+static const auto registered_iteration = register_for_all_column_types(
+    "BM_TableIteration", [](auto type) { return &BM_TableIteration<typename decltype(type)::type>; },
+    configure_chunk_sizes);
+
+static const auto registered_iteration_resolved = register_for_all_column_types(
+    "BM_TableIterationResolved", [](auto type) { return &BM_TableIterationResolved<typename decltype(type)::type>; },
+    configure_chunk_sizes);
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/value_column.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+void BM_ValueColumnAppend(benchmark::State& state) {
+  const auto value = AllTypeVariant{generate_benchmark_value<T>(42)};
+  const auto row_count = state.range(0);
+
+  for (auto _ : state) {
+    auto column = ValueColumn<T>{};
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      column.append(value);
+    }
+    benchmark::DoNotOptimize(column.size());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+template <typename T>
+void BM_ValueColumnAppendPresized(benchmark::State& state) {
+  const auto value = AllTypeVariant{generate_benchmark_value<T>(42)};
+  const auto row_count = state.range(0);
+
+  for (auto _ : state) {
+    auto column = ValueColumn<T>{{}, static_cast<size_t>(row_count)};
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      column.append(value);
+    }
+    benchmark::DoNotOptimize(column.size());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+template <typename T>
+void BM_ValueColumnSubscriptOperator(benchmark::State& state) {
+  const auto row_count = state.range(0);
+  auto column = ValueColumn<T>{};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    column.append(generate_benchmark_value<T>(index));
+  }
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  for (auto _ : state) {
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      auto value = column[index];
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+template <typename T>
+void BM_ValueColumnCompactValueAt(benchmark::State& state) {
+  const auto row_count = state.range(0);
+  auto column = ValueColumn<T>{};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    column.append(generate_benchmark_value<T>(index));
+  }
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  for (auto _ : state) {
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      auto value = column.compact_value_at(index);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+template <typename T>
+void BM_ValueColumnAppendCompactValue(benchmark::State& state) {
+  const auto value = CompactValue{generate_benchmark_value<T>(42)};
+  const auto row_count = state.range(0);
+
+  for (auto _ : state) {
+    auto column = ValueColumn<T>{};
+    for (auto index = int64_t{0}; index < row_count; ++index) {
+      column.append(value);
+    }
+    benchmark::DoNotOptimize(column.size());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+static const auto registered_append =
+    register_for_all_column_types("BM_ValueColumnAppend",
+                                  [](auto type) { return &BM_ValueColumnAppend<typename decltype(type)::type>; },
+                                  [](auto* benchmark) { benchmark->Arg(BENCHMARK_ROW_COUNT); });
+
+static const auto registered_append_presized = register_for_all_column_types(
+    "BM_ValueColumnAppendPresized",
+    [](auto type) { return &BM_ValueColumnAppendPresized<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(BENCHMARK_ROW_COUNT); });
+
+static const auto registered_subscript_operator = register_for_all_column_types(
+    "BM_ValueColumnSubscriptOperator",
+    [](auto type) { return &BM_ValueColumnSubscriptOperator<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(BENCHMARK_ROW_COUNT); });
+
+static const auto registered_compact_value_at = register_for_all_column_types(
+    "BM_ValueColumnCompactValueAt",
+    [](auto type) { return &BM_ValueColumnCompactValueAt<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(BENCHMARK_ROW_COUNT); });
+
+static const auto registered_append_compact_value = register_for_all_column_types(
+    "BM_ValueColumnAppendCompactValue",
+    [](auto type) { return &BM_ValueColumnAppendCompactValue<typename decltype(type)::type>; },
+    [](auto* benchmark) { benchmark->Arg(BENCHMARK_ROW_COUNT); });
+
+}  // namespace opossum
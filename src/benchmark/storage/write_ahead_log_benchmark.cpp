@@ -0,0 +1,98 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/write_ahead_log.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<Table> create_write_ahead_log_benchmark_table() {
+  auto table = std::make_shared<Table>(10'000);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  table->add_column("c", "double");
+  return table;
+}
+
+std::vector<std::vector<AllTypeVariant>> create_write_ahead_log_benchmark_batch(const int64_t row_count) {
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    rows.push_back({static_cast<int32_t>(index), generate_benchmark_value<std::string>(index), 0.5});
+  }
+  return rows;
+}
+
+}  // namespace
+
+// Baseline for BM_WriteAheadLogAppend: appends the same batches without logging them. As Table::append is not
+// thread-safe, concurrent appenders are serialized.
+static void BM_TableAppendBatch(benchmark::State& state) {
+  static std::shared_ptr<Table> table;
+  static std::mutex mutex;
+  if (state.thread_index() == 0) table = create_write_ahead_log_benchmark_table();
+  const auto rows = create_write_ahead_log_benchmark_batch(state.range(0));
+
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+  }
+
+  if (state.thread_index() == 0) table = nullptr;
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableAppendBatch)
+    ->ArgName("batch_size")
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(1'000)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Appends batches durably, i.e., each append waits for its flush, which concurrent appenders share
+static void BM_WriteAheadLogAppend(benchmark::State& state) {
+  static std::unique_ptr<WriteAheadLog> log;
+  const auto temp_directory = std::getenv("TMPDIR");
+  const auto base_directory = std::string{temp_directory && *temp_directory ? temp_directory : "/tmp"};
+  const auto path = base_directory + "/hyrise_wal_benchmark_" + std::to_string(getpid());
+  if (state.thread_index() == 0) {
+    std::remove(path.c_str());
+    StorageManager::reset();
+    log = std::make_unique<WriteAheadLog>(path);
+    log->add_table("benchmark", create_write_ahead_log_benchmark_table());
+  }
+  const auto rows = create_write_ahead_log_benchmark_batch(state.range(0));
+
+  for (auto _ : state) {
+    log->append("benchmark", rows);
+  }
+
+  if (state.thread_index() == 0) {
+    log = nullptr;
+    StorageManager::reset();
+    std::remove(path.c_str());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteAheadLogAppend)
+    ->ArgName("batch_size")
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(1'000)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace opossum
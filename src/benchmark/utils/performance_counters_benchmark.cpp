@@ -0,0 +1,21 @@
+#include "benchmark/benchmark.h"
+
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+static void BM_PerformanceCount(benchmark::State& state) {
+  for (auto _ : state) {
+    PerformanceCount("BM_PerformanceCount");
+  }
+}
+BENCHMARK(BM_PerformanceCount)->ThreadRange(1, 4);
+
+static void BM_PerformanceTimerScope(benchmark::State& state) {
+  for (auto _ : state) {
+    PerformanceTimerScope("BM_PerformanceTimerScope");
+  }
+}
+BENCHMARK(BM_PerformanceTimerScope);
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "../lib/storage/checkpoint.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/tpch/tpch_table_generator.hpp"
+
+// Generates the TPC-H tables and, if a directory is given, writes them to a checkpoint, which Checkpoint::load reads.
+int main(int argc, char* argv[]) {
+  if (argc > 4) {
+    std::cerr << "Usage: " << argv[0] << " [scale factor = 0.1] [chunk size = 100000] [checkpoint directory]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto scale_factor = argc > 1 ? std::stod(argv[1]) : 0.1;
+  const auto chunk_size = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : uint32_t{100'000};
+
+  const auto start = std::chrono::steady_clock::now();
+  opossum::TpchTableGenerator{scale_factor, chunk_size}.generate_and_store();
+  const auto generated = std::chrono::steady_clock::now();
+
+  auto& storage_manager = opossum::StorageManager::get();
+  for (const auto& name : storage_manager.table_names()) {
+    const auto table = storage_manager.get_table(name);
+    std::cout << name << ": " << table->row_count() << " rows in " << table->chunk_count() << " chunks" << std::endl;
+  }
+  std::cout << "Generated in " << std::chrono::duration<double>(generated - start).count() << " s" << std::endl;
+
+  if (argc > 3) {
+    opossum::Checkpoint{argv[3]}.write();
+    const auto written = std::chrono::steady_clock::now();
+    std::cout << "Written to " << argv[3] << " in " << std::chrono::duration<double>(written - generated).count()
+              << " s" << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
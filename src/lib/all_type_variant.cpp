@@ -0,0 +1,33 @@
+#include "all_type_variant.hpp"
+
+#include <boost/hana/unpack.hpp>
+
+#include <array>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Holds the type strings in the order of DataType, e.g., data_type_strings[DataType::Long] == "long"
+const auto data_type_strings =
+    hana::unpack(detail::type_strings, [](auto... type_string) { return std::array<std::string, sizeof...(type_string)>{
+                                                                     {std::string{type_string}...}}; });
+
+}  // namespace
+
+const std::string& data_type_to_string(const DataType data_type) {
+  return data_type_strings.at(static_cast<size_t>(data_type));
+}
+
+DataType data_type_from_string(const std::string& type_string) {
+  for (auto index = size_t{0}; index < data_type_strings.size(); ++index) {
+    if (data_type_strings[index] == type_string) return static_cast<DataType>(index);
+  }
+  Fail("Unknown data type " + type_string);
+  return DataType::Int;
+}
+
+}  // namespace opossum
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <boost/hana/equal.hpp>
 #include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/index_if.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
@@ -16,6 +19,7 @@
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "types.hpp"
@@ -24,6 +28,13 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
+/**
+ * DataType identifies one of the COLUMN_TYPES without the need for string comparisons. The n-th entry of DataType
+ * corresponds to the n-th entry of COLUMN_TYPES (see below). Use resolve_data_type() in resolve_type.hpp to get the
+ * actual type.
+ */
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
@@ -70,6 +81,22 @@ static constexpr auto column_types = detail::column_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+static_assert(static_cast<size_t>(DataType::String) + 1 == decltype(hana::size(types))::value,
+              "DataType has to have one entry per entry in COLUMN_TYPES");
+
+// returns the DataType of a C++ type in COLUMN_TYPES, e.g., DataType::Int for int32_t
+template <typename T>
+constexpr DataType data_type_from_type() {
+  constexpr auto index = std::decay_t<decltype(hana::index_if(types, hana::equal.to(hana::type_c<T>)).value())>::value;
+  return static_cast<DataType>(index);
+}
+
+// returns the string representation of a DataType, e.g., "int" for DataType::Int
+const std::string& data_type_to_string(DataType data_type);
+
+// returns the DataType for its string representation. Fails for unknown types.
+DataType data_type_from_string(const std::string& type_string);
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
@@ -0,0 +1,112 @@
+#include "compact_value.hpp"
+
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+CompactValue::CompactValue(std::string_view value) : CompactValue(Tag::InlineString) {
+  if (value.size() <= INLINE_CAPACITY) {
+    std::memcpy(_bytes, value.data(), value.size());
+    _inline_size = static_cast<uint8_t>(value.size());
+    return;
+  }
+
+  auto data = std::allocator<char>{}.allocate(value.size());
+  std::memcpy(data, value.data(), value.size());
+  _store_string_reference(data, value.size());
+  _tag = Tag::OwnedString;
+}
+
+CompactValue::CompactValue(const std::string& value) : CompactValue(std::string_view{value}) {}
+
+CompactValue::CompactValue(const char* value) : CompactValue(std::string_view{value}) {}
+
+CompactValue::CompactValue(const AllTypeVariant& value) : CompactValue() {
+  resolve_data_type(static_cast<DataType>(value.which()), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    *this = CompactValue{boost::get<Type>(value)};
+  });
+}
+
+CompactValue CompactValue::view(std::string_view value) {
+  auto compact_value = CompactValue{Tag::StringView};
+  compact_value._store_string_reference(value.data(), value.size());
+  return compact_value;
+}
+
+CompactValue& CompactValue::operator=(const CompactValue& other) {
+  if (this == &other) return *this;
+  _release();
+  _copy_from(other);
+  return *this;
+}
+
+CompactValue& CompactValue::operator=(CompactValue&& other) noexcept {
+  if (this == &other) return *this;
+  _release();
+  _move_from(other);
+  return *this;
+}
+
+bool CompactValue::is_view() const { return _tag == Tag::StringView; }
+
+AllTypeVariant CompactValue::to_variant() const {
+  auto variant = AllTypeVariant{};
+  visit([&](const auto& value) {
+    if constexpr (std::is_same<std::decay_t<decltype(value)>, std::string_view>::value) {
+      variant = std::string{value};
+    } else {
+      variant = value;
+    }
+  });
+  return variant;
+}
+
+bool CompactValue::operator==(const CompactValue& other) const {
+  if (data_type() != other.data_type()) return false;
+
+  auto equal = false;
+  visit([&](const auto& value) { equal = value == other.get<std::decay_t<decltype(value)>>(); });
+  return equal;
+}
+
+bool CompactValue::operator!=(const CompactValue& other) const { return !(*this == other); }
+
+bool CompactValue::operator<(const CompactValue& other) const {
+  if (data_type() != other.data_type()) return data_type() < other.data_type();
+
+  auto less = false;
+  visit([&](const auto& value) { less = value < other.get<std::decay_t<decltype(value)>>(); });
+  return less;
+}
+
+std::ostream& operator<<(std::ostream& stream, const CompactValue& value) {
+  value.visit([&](const auto& typed_value) { stream << typed_value; });
+  return stream;
+}
+
+void CompactValue::_store_string_reference(const char* data, size_t size) {
+  Assert(size <= std::numeric_limits<uint32_t>::max(), "String too long for CompactValue");
+  _store(data);
+  _store(static_cast<uint32_t>(size), STRING_SIZE_OFFSET);
+}
+
+void CompactValue::_copy_owned_string_from(const CompactValue& other) {
+  const auto string = other.get<std::string_view>();
+  auto data = std::allocator<char>{}.allocate(string.size());
+  std::memcpy(data, string.data(), string.size());
+  _store_string_reference(data, string.size());
+  _tag = Tag::OwnedString;
+}
+
+void CompactValue::_release_owned_string() {
+  std::allocator<char>{}.deallocate(_load<char*>(), _load<uint32_t>(STRING_SIZE_OFFSET));
+  _tag = Tag::Int;
+}
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * CompactValue holds a single value of any of the COLUMN_TYPES in 16 bytes. It is meant for row-oriented code paths
+ * (e.g., Table::append, BaseColumn::compact_value_at) where AllTypeVariant is too heavy: an AllTypeVariant embeds a
+ * std::string (40 bytes) and every copy of a string value allocates memory.
+ *
+ * Strings are stored in one of three ways:
+ *  - inline, if they have at most INLINE_CAPACITY characters (small string optimization)
+ *  - owned, i.e., in a heap allocation that is copied together with the CompactValue
+ *  - as a non-owning view (see CompactValue::view), e.g., when reading from a column. Such a value is only valid as
+ *    long as the referenced string is neither modified nor destroyed. Copies of a view are views as well.
+ *
+ * The constructors are explicit so that overloads taking AllTypeVariant remain unambiguous.
+ * Like AllTypeVariant, values are ordered by their type first and by their value second.
+ */
+class CompactValue {
+ public:
+  static constexpr size_t INLINE_CAPACITY = 14;
+
+  // Same as a default-constructed AllTypeVariant, i.e., int32_t{0}
+  CompactValue() : CompactValue(int32_t{0}) {}
+
+  // Numbers are constructed inline as they are created on hot paths, e.g., in BaseColumn::compact_value_at
+  explicit CompactValue(int32_t value) : CompactValue(Tag::Int) { _store(value); }
+  explicit CompactValue(int64_t value) : CompactValue(Tag::Long) { _store(value); }
+  explicit CompactValue(float value) : CompactValue(Tag::Float) { _store(value); }
+  explicit CompactValue(double value) : CompactValue(Tag::Double) { _store(value); }
+
+  // copies the string, either inline or into a heap allocation
+  explicit CompactValue(std::string_view value);
+  explicit CompactValue(const std::string& value);
+  explicit CompactValue(const char* value);
+
+  explicit CompactValue(const AllTypeVariant& value);
+
+  // creates a CompactValue that references, but does not own the string
+  static CompactValue view(std::string_view value);
+
+  CompactValue(const CompactValue& other) : CompactValue(Tag::Int) { _copy_from(other); }
+  CompactValue(CompactValue&& other) noexcept : CompactValue(Tag::Int) { _move_from(other); }
+  CompactValue& operator=(const CompactValue& other);
+  CompactValue& operator=(CompactValue&& other) noexcept;
+  ~CompactValue() { _release(); }
+
+  DataType data_type() const { return _tag <= Tag::Double ? static_cast<DataType>(_tag) : DataType::String; }
+
+  // returns true if the value is a string that is not owned by this CompactValue
+  bool is_view() const;
+
+  // returns the value, which needs to be of type T. Strings are returned as std::string_view.
+  template <typename T>
+  T get() const;
+
+  AllTypeVariant to_variant() const;
+
+  // Calls func with the value as int32_t, int64_t, float, double, or std::string_view
+  template <typename Functor>
+  void visit(const Functor& func) const;
+
+  bool operator==(const CompactValue& other) const;
+  bool operator!=(const CompactValue& other) const;
+  bool operator<(const CompactValue& other) const;
+
+  friend std::ostream& operator<<(std::ostream& stream, const CompactValue& value);
+
+ protected:
+  // The first four entries match those of DataType
+  enum class Tag : uint8_t { Int, Long, Float, Double, InlineString, OwnedString, StringView };
+
+  explicit CompactValue(Tag tag) : _bytes{}, _inline_size{0}, _tag{tag} {}
+
+  template <typename T>
+  void _store(const T& value, const size_t offset = 0) {
+    static_assert(sizeof(T) <= INLINE_CAPACITY, "Value does not fit");
+    std::memcpy(_bytes + offset, &value, sizeof(T));
+  }
+
+  template <typename T>
+  T _load(const size_t offset = 0) const {
+    auto value = T{};
+    std::memcpy(&value, _bytes + offset, sizeof(T));
+    return value;
+  }
+
+  // Non-inline strings store their pointer at offset 0 and their size at offset STRING_SIZE_OFFSET
+  static constexpr size_t STRING_SIZE_OFFSET = sizeof(const char*);
+
+  void _store_string_reference(const char* data, size_t size);
+
+  void _copy_bytes_from(const CompactValue& other) {
+    std::memcpy(_bytes, other._bytes, INLINE_CAPACITY);
+    _inline_size = other._inline_size;
+    _tag = other._tag;
+  }
+
+  void _copy_from(const CompactValue& other) {
+    if (other._tag == Tag::OwnedString) {
+      _copy_owned_string_from(other);
+    } else {
+      _copy_bytes_from(other);
+    }
+  }
+
+  // The owned string (if any) changes hands, other is reset to a number so that it does not release it
+  void _move_from(CompactValue& other) {
+    _copy_bytes_from(other);
+    other._tag = Tag::Int;
+  }
+
+  void _release() {
+    if (_tag == Tag::OwnedString) _release_owned_string();
+  }
+
+  void _copy_owned_string_from(const CompactValue& other);
+  void _release_owned_string();
+
+  // Holds numbers, inline strings, or the pointer and size of other strings
+  alignas(8) char _bytes[INLINE_CAPACITY];
+  uint8_t _inline_size;
+  Tag _tag;
+};
+
+static_assert(sizeof(CompactValue) == 16, "CompactValue is supposed to fit into 16 bytes");
+
+template <typename T>
+T CompactValue::get() const {
+  // The parentheses keep the commas of the template arguments from being read as macro argument separators
+  DebugAssert((data_type() ==
+               data_type_from_type<std::conditional_t<std::is_same<T, std::string_view>::value, std::string, T>>()),
+              "CompactValue holds a different type");
+  if constexpr (std::is_same<T, std::string_view>::value) {
+    if (_tag == Tag::InlineString) return std::string_view{_bytes, _inline_size};
+    return std::string_view{_load<const char*>(), _load<uint32_t>(STRING_SIZE_OFFSET)};
+  } else {
+    return _load<T>();
+  }
+}
+
+template <typename Functor>
+void CompactValue::visit(const Functor& func) const {
+  switch (_tag) {
+    case Tag::Int:
+      func(get<int32_t>());
+      return;
+    case Tag::Long:
+      func(get<int64_t>());
+      return;
+    case Tag::Float:
+      func(get<float>());
+      return;
+    case Tag::Double:
+      func(get<double>());
+      return;
+    case Tag::InlineString:
+    case Tag::OwnedString:
+    case Tag::StringView:
+      func(get<std::string_view>());
+      return;
+  }
+  Fail("Unknown tag");
+}
+
+}  // namespace opossum
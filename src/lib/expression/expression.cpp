@@ -0,0 +1,120 @@
+#include "expression.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Expression::Expression(ConstructorKey, const ExpressionType type, const ColumnID column_id, const AllTypeVariant& value,
+                       const std::shared_ptr<const Expression>& left, const std::shared_ptr<const Expression>& right)
+    : _type(type), _column_id(column_id), _value(value), _left(left), _right(right) {}
+
+std::shared_ptr<const Expression> Expression::column(const ColumnID column_id) {
+  return std::make_shared<const Expression>(ConstructorKey{}, ExpressionType::Column, column_id, AllTypeVariant{},
+                                            nullptr, nullptr);
+}
+
+std::shared_ptr<const Expression> Expression::literal(const AllTypeVariant& value) {
+  return std::make_shared<const Expression>(ConstructorKey{}, ExpressionType::Literal, ColumnID{0}, value, nullptr,
+                                            nullptr);
+}
+
+std::shared_ptr<const Expression> Expression::binary(const ExpressionType type,
+                                                     const std::shared_ptr<const Expression>& left,
+                                                     const std::shared_ptr<const Expression>& right) {
+  Assert(type != ExpressionType::Column && type != ExpressionType::Literal, "Expected an arithmetic operation");
+  Assert(left && right, "Arithmetic operations need two operands");
+  return std::make_shared<const Expression>(ConstructorKey{}, type, ColumnID{0}, AllTypeVariant{}, left, right);
+}
+
+ExpressionType Expression::type() const { return _type; }
+
+bool Expression::is_arithmetic_operation() const {
+  return _type != ExpressionType::Column && _type != ExpressionType::Literal;
+}
+
+ColumnID Expression::column_id() const {
+  DebugAssert(_type == ExpressionType::Column, "Expression is not a column");
+  return _column_id;
+}
+
+const AllTypeVariant& Expression::value() const {
+  DebugAssert(_type == ExpressionType::Literal, "Expression is not a literal");
+  return _value;
+}
+
+const std::shared_ptr<const Expression>& Expression::left() const { return _left; }
+
+const std::shared_ptr<const Expression>& Expression::right() const { return _right; }
+
+DataType Expression::data_type(const Table& table) const {
+  switch (_type) {
+    case ExpressionType::Column:
+      return table.column_data_type(_column_id);
+    case ExpressionType::Literal:
+      return static_cast<DataType>(_value.which());
+    default:
+      break;
+  }
+
+  auto result_data_type = DataType::Int;
+  resolve_data_type(_left->data_type(table), [&](auto left_type) {
+    resolve_data_type(_right->data_type(table), [&](auto right_type) {
+      using LeftType = typename decltype(left_type)::type;
+      using RightType = typename decltype(right_type)::type;
+      if constexpr (std::is_arithmetic<LeftType>::value && std::is_arithmetic<RightType>::value) {
+        result_data_type = data_type_from_type<std::common_type_t<LeftType, RightType>>();
+      } else {
+        Fail("Arithmetic operations are not supported for strings");
+      }
+    });
+  });
+  return result_data_type;
+}
+
+std::string Expression::description() const {
+  switch (_type) {
+    case ExpressionType::Column:
+      return "#" + std::to_string(_column_id);
+    case ExpressionType::Literal:
+      return to_string(_value);
+    case ExpressionType::Addition:
+      return "(" + _left->description() + " + " + _right->description() + ")";
+    case ExpressionType::Subtraction:
+      return "(" + _left->description() + " - " + _right->description() + ")";
+    case ExpressionType::Multiplication:
+      return "(" + _left->description() + " * " + _right->description() + ")";
+    case ExpressionType::Division:
+      return "(" + _left->description() + " / " + _right->description() + ")";
+  }
+  Fail("Unknown expression type");
+  return "";
+}
+
+std::shared_ptr<const Expression> operator+(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right) {
+  return Expression::binary(ExpressionType::Addition, left, right);
+}
+
+std::shared_ptr<const Expression> operator-(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right) {
+  return Expression::binary(ExpressionType::Subtraction, left, right);
+}
+
+std::shared_ptr<const Expression> operator*(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right) {
+  return Expression::binary(ExpressionType::Multiplication, left, right);
+}
+
+std::shared_ptr<const Expression> operator/(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right) {
+  return Expression::binary(ExpressionType::Division, left, right);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ExpressionType : uint8_t { Column, Literal, Addition, Subtraction, Multiplication, Division };
+
+/**
+ * Expression is a node of an arithmetic expression tree, e.g., price * (1 - discount). Leaves are columns of the input
+ * table or literals, inner nodes are arithmetic operations. Expressions are immutable and are built using the static
+ * factory methods or the arithmetic operators:
+ *
+ *   const auto price = Expression::column(ColumnID{0});
+ *   const auto discount = Expression::column(ColumnID{1});
+ *   const auto discounted_price = price * (Expression::literal(1) - discount);
+ *
+ * Like in C++, the result of an operation has the common type of its operands, e.g., int + float yields a float.
+ * Expressions are evaluated by the Projection operator.
+ */
+class Expression {
+ protected:
+  // Lets only the factory methods call the public constructor, which std::make_shared needs
+  struct ConstructorKey {};
+
+ public:
+  Expression(ConstructorKey, const ExpressionType type, const ColumnID column_id, const AllTypeVariant& value,
+             const std::shared_ptr<const Expression>& left, const std::shared_ptr<const Expression>& right);
+
+  static std::shared_ptr<const Expression> column(const ColumnID column_id);
+  static std::shared_ptr<const Expression> literal(const AllTypeVariant& value);
+  static std::shared_ptr<const Expression> binary(const ExpressionType type,
+                                                  const std::shared_ptr<const Expression>& left,
+                                                  const std::shared_ptr<const Expression>& right);
+
+  ExpressionType type() const;
+  bool is_arithmetic_operation() const;
+
+  // only valid for columns
+  ColumnID column_id() const;
+
+  // only valid for literals
+  const AllTypeVariant& value() const;
+
+  // only valid for arithmetic operations
+  const std::shared_ptr<const Expression>& left() const;
+  const std::shared_ptr<const Expression>& right() const;
+
+  // returns the type of the expression's result when it is evaluated on table
+  DataType data_type(const Table& table) const;
+
+  // returns the expression in infix notation, e.g., "(#0 * (1 - #1))", where #n refers to the n-th column
+  std::string description() const;
+
+ protected:
+  const ExpressionType _type;
+  const ColumnID _column_id;
+  const AllTypeVariant _value;
+  const std::shared_ptr<const Expression> _left;
+  const std::shared_ptr<const Expression> _right;
+};
+
+std::shared_ptr<const Expression> operator+(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right);
+std::shared_ptr<const Expression> operator-(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right);
+std::shared_ptr<const Expression> operator*(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right);
+std::shared_ptr<const Expression> operator/(const std::shared_ptr<const Expression>& left,
+                                            const std::shared_ptr<const Expression>& right);
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include "abstract_operator.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "result_cache.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
+                                   const std::shared_ptr<const AbstractOperator> right)
+    : _input_left(left), _input_right(right) {}
+
+void AbstractOperator::execute() {
+  _performance_data = OperatorPerformanceData{};
+  for (const auto& input_table : {_input_table_left(), _input_table_right()}) {
+    if (!input_table) continue;
+    _performance_data.input_row_count += input_table->row_count();
+    _performance_data.input_chunk_count += input_table->chunk_count();
+    // Estimating the memory usage is linear in the number of strings, which is too expensive for every execution
+    if (HardwareCounterProfiling::is_enabled()) _performance_data.input_bytes += input_table->estimate_memory_usage();
+  }
+
+  if (HardwareCounterProfiling::is_enabled()) {
+    HardwareCounters hardware_counters;
+    const auto begin = std::chrono::steady_clock::now();
+    hardware_counters.start();
+    _output = ResultCache::get().execute(*this);
+    _performance_data.hardware_counters = hardware_counters.stop();
+    _performance_data.walltime = std::chrono::steady_clock::now() - begin;
+  } else {
+    const auto begin = std::chrono::steady_clock::now();
+    _output = ResultCache::get().execute(*this);
+    _performance_data.walltime = std::chrono::steady_clock::now() - begin;
+  }
+
+  if (_output) {
+    _performance_data.output_row_count = _output->row_count();
+    _performance_data.output_chunk_count = _output->chunk_count();
+  }
+}
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const { return _output; }
+
+const std::string AbstractOperator::description() const { return name(); }
+
+std::string AbstractOperator::_cache_key() const { return ""; }
+
+bool AbstractOperator::_is_chunk_wise() const { return false; }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_left() const {
+  return _input_left ? _input_left->get_output() : nullptr;
+}
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_right() const {
+  return _input_right ? _input_right->get_output() : nullptr;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+void AbstractOperator::print_performance_report(std::ostream& out) const { _print_performance_report(out, ""); }
+
+void AbstractOperator::_print_performance_report(std::ostream& out, const std::string& indentation) const {
+  const auto& data = _performance_data;
+  out << indentation << description() << ": "
+      << std::chrono::duration_cast<std::chrono::microseconds>(data.walltime).count() << " us, in: "
+      << data.input_row_count << " rows / " << data.input_chunk_count << " chunks / " << data.input_bytes
+      << " bytes, out: " << data.output_row_count << " rows / " << data.output_chunk_count << " chunks";
+
+  for (auto event_index = size_t{0}; event_index < HARDWARE_EVENT_COUNT; ++event_index) {
+    const auto& value = data.hardware_counters.values[event_index];
+    if (!value) continue;
+    out << ", " << hardware_event_to_string(static_cast<HardwareEvent>(event_index)) << ": " << *value;
+  }
+  out << std::endl;
+
+  for (const auto& input : {_input_left, _input_right}) {
+    if (input) input->_print_performance_report(out, indentation + "  ");
+  }
+}
+
+}  // namespace opossum
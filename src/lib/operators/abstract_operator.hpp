@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Measurements taken during the execution of an operator, see AbstractOperator::performance_data
+struct OperatorPerformanceData {
+  std::chrono::nanoseconds walltime{0};
+
+  // summed up over both inputs
+  uint64_t input_row_count = 0;
+  ChunkID input_chunk_count{0};
+
+  // estimated memory usage of the input tables, i.e., an upper bound of the bytes the operator touches. Only measured
+  // while HardwareCounterProfiling is enabled.
+  size_t input_bytes = 0;
+
+  uint64_t output_row_count = 0;
+  ChunkID output_chunk_count{0};
+
+  // Only measured while HardwareCounterProfiling is enabled and if the kernel grants access. Includes the threads that
+  // the operator joins before it returns, but not threads that outlive it, e.g., a background delta merge.
+  HardwareCounterValues hardware_counters;
+};
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input tables and one output table.
+// Their lifecycle has three phases:
+// 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
+// call get_output in their constructor
+// 2. The execute method is called from the outside. This is where the heavy lifting is done.
+// By now, the input operators have already executed.
+// 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
+// succeed if execute was called before. Otherwise, a nullptr is returned.
+//
+// Operators shall not be executed twice. While the ResultCache is enabled, execute may return the output of an earlier
+// execution of an equal operator on the same, unchanged inputs, see ResultCache.
+class AbstractOperator : private Noncopyable {
+ public:
+  AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                   const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractOperator(AbstractOperator&&) = default;
+  AbstractOperator& operator=(AbstractOperator&&) = default;
+
+  // executes the operator, or takes its output from the ResultCache, and records its performance data
+  void execute();
+
+  // returns the result of the operator
+  std::shared_ptr<const Table> get_output() const;
+
+  // returns the name of the operator, e.g., "GetTable"
+  virtual const std::string name() const = 0;
+
+  // returns the name and the parameters of the operator, e.g., "GetTable (customer)"
+  virtual const std::string description() const;
+
+  // Get the input operators.
+  std::shared_ptr<const AbstractOperator> input_left() const;
+  std::shared_ptr<const AbstractOperator> input_right() const;
+
+  // returns the measurements of the last execution
+  const OperatorPerformanceData& performance_data() const;
+
+  // prints the performance data of this operator and, indented, of its inputs, e.g., for slow query logs
+  void print_performance_report(std::ostream& out = std::cout) const;
+
+ protected:
+  friend class ResultCache;
+
+  // abstract method to actually execute the operator
+  // execute and get_output are split into two methods to allow for easier
+  // asynchronous execution
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // Returns a string that identifies the operator and all of its parameters, such that operators with equal keys
+  // compute equal outputs from equal inputs, or an empty string if the output must not be cached. See ResultCache.
+  virtual std::string _cache_key() const;
+
+  // Returns true if the operator processes the chunks of its left input independently and in order, so that the output
+  // chunks of an input chunk precede those of the next one. Such operators only process the input chunks from
+  // _input_chunk_begin to _input_chunk_end, which lets the ResultCache reuse the output of unchanged chunks.
+  virtual bool _is_chunk_wise() const;
+
+  std::shared_ptr<const Table> _input_table_left() const;
+  std::shared_ptr<const Table> _input_table_right() const;
+
+  void _print_performance_report(std::ostream& out, const std::string& indentation) const;
+
+  // Shared pointers to input operators, can be nullptr.
+  std::shared_ptr<const AbstractOperator> _input_left;
+  std::shared_ptr<const AbstractOperator> _input_right;
+
+  // Is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+
+  ChunkID _input_chunk_begin{0};
+  ChunkID _input_chunk_end{std::numeric_limits<ChunkID::base_type>::max()};
+
+  OperatorPerformanceData _performance_data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,245 @@
+#include "join_hash.hpp"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto NO_ROW = std::numeric_limits<size_t>::max();
+
+// The rows of a join input are numbered across its chunks. The matches are pairs of such row numbers.
+struct Matches {
+  std::vector<size_t> left_rows;
+  std::vector<size_t> right_rows;
+};
+
+// Returns the positions of the rows of the table in the order in which they are numbered
+PosList row_positions(const Table& table) {
+  auto positions = PosList{};
+  positions.reserve(table.row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_size = table.get_chunk(chunk_id).size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      positions.push_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  return positions;
+}
+
+// Returns the values of the column for all rows of the table, which may consist of any kind of column
+template <typename T>
+std::vector<T> gather_values(const Table& table, const ColumnID column_id) {
+  auto values = std::vector<T>{};
+  values.reserve(table.row_count());
+
+  // The chunks of a TableScan output usually refer to the same column, whose chunks are thus resolved only once
+  auto referenced_values = ReferencedValuesByColumn{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    const auto column = chunk.get_column(column_id);
+
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      const auto& values_by_chunk = referenced_values.get<T>(*reference_column);
+      for (const auto& row_id : *reference_column->pos_list()) {
+        values.push_back(values_by_chunk[row_id]);
+      }
+    } else if (column->encoding_type() == EncodingType::Dictionary) {
+      const auto& dictionary_column = static_cast<const DictionaryColumn<T>&>(*column);
+      const auto& dictionary = dictionary_column.dictionary();
+      resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+        for (const auto value_id : attribute_vector.value_ids()) {
+          values.push_back(dictionary[value_id]);
+        }
+      });
+    } else {
+      const auto& column_values = static_cast<const ValueColumn<T>&>(*column).values();
+      values.insert(values.end(), column_values.begin(), column_values.end());
+    }
+  }
+  return values;
+}
+
+// Finds the pairs of equal values by building a hash table on build_values and probing it with probe_values. The
+// matches are ordered by the probing row and, for each of them, by the building row.
+template <typename T>
+void hash_join(const std::vector<T>& build_values, const std::vector<T>& probe_values, std::vector<size_t>& build_rows,
+               std::vector<size_t>& probe_rows) {
+  // The rows holding the same value form a chain: the map points to the first of them, next_rows to the following
+  auto first_rows = std::unordered_map<T, size_t>{};
+  first_rows.reserve(build_values.size());
+  auto next_rows = std::vector<size_t>(build_values.size(), NO_ROW);
+  for (auto row = build_values.size(); row-- > 0;) {
+    const auto emplace_result = first_rows.try_emplace(build_values[row], row);
+    if (!emplace_result.second) {
+      next_rows[row] = emplace_result.first->second;
+      emplace_result.first->second = row;
+    }
+  }
+
+  for (auto probe_row = size_t{0}; probe_row < probe_values.size(); ++probe_row) {
+    const auto iter = first_rows.find(probe_values[probe_row]);
+    if (iter == first_rows.end()) continue;
+    for (auto build_row = iter->second; build_row != NO_ROW; build_row = next_rows[build_row]) {
+      build_rows.push_back(build_row);
+      probe_rows.push_back(probe_row);
+    }
+  }
+}
+
+// Adds the columns of input_table to output_chunk as ReferenceColumns that hold the given rows of input_table
+void add_output_columns(const std::shared_ptr<const Table>& input_table, const std::vector<size_t>& rows,
+                        Chunk& output_chunk) {
+  const auto input_positions = row_positions(*input_table);
+
+  // The columns of a data table share one position list. ReferenceColumns share one if they refer to the same position
+  // lists in all chunks, which is the case for columns that stem from the same table.
+  auto pos_lists = std::map<std::vector<const PosList*>, std::shared_ptr<PosList>>{};
+  for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+    // Empty for data tables, otherwise the position list of every chunk, which is nullptr for empty chunks
+    auto input_pos_lists = std::vector<const PosList*>{};
+    auto referenced_table = input_table;
+    auto referenced_column_id = column_id;
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+      if (!reference_column) break;
+
+      if (input_pos_lists.empty()) {
+        input_pos_lists.resize(input_table->chunk_count());
+        referenced_table = reference_column->referenced_table();
+        referenced_column_id = reference_column->referenced_column_id();
+      }
+      Assert(reference_column->referenced_table() == referenced_table &&
+                 reference_column->referenced_column_id() == referenced_column_id,
+             "All chunks need to reference the same tables");
+      input_pos_lists[chunk_id] = reference_column->pos_list().get();
+    }
+
+    auto& pos_list = pos_lists[input_pos_lists];
+    if (!pos_list) {
+      pos_list = std::make_shared<PosList>();
+      pos_list->reserve(rows.size());
+      for (const auto row : rows) {
+        const auto& row_id = input_positions[row];
+        pos_list->push_back(input_pos_lists.empty() ? row_id
+                                                    : (*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+    }
+    output_chunk.add_column(std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right,
+                   const std::vector<std::pair<ColumnID, ColumnID>>& column_id_pairs)
+    : AbstractOperator(left, right), _column_id_pairs(column_id_pairs) {
+  Assert(!_column_id_pairs.empty(), "JoinHash needs at least one pair of columns");
+}
+
+const std::vector<std::pair<ColumnID, ColumnID>>& JoinHash::column_id_pairs() const { return _column_id_pairs; }
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+const std::string JoinHash::description() const {
+  auto description = name() + " (";
+  for (auto index = size_t{0}; index < _column_id_pairs.size(); ++index) {
+    if (index > 0) description += " AND ";
+    description += "left column " + std::to_string(_column_id_pairs[index].first) + " = right column " +
+                   std::to_string(_column_id_pairs[index].second);
+  }
+  return description + ")";
+}
+
+std::string JoinHash::_cache_key() const { return description(); }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& input_table : {left_table, right_table}) {
+    for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+      output_table->add_column_definition(input_table->column_name(column_id),
+                                          input_table->column_data_type(column_id));
+    }
+  }
+
+  for (const auto& [left_column_id, right_column_id] : _column_id_pairs) {
+    Assert(left_column_id < left_table->col_count() && right_column_id < right_table->col_count(),
+           "Column does not exist");
+    Assert(left_table->column_data_type(left_column_id) == right_table->column_data_type(right_column_id),
+           "Joined columns need to have the same type");
+  }
+
+  auto matches = Matches{};
+  const auto first_left_column_id = _column_id_pairs.front().first;
+  const auto first_right_column_id = _column_id_pairs.front().second;
+  resolve_data_type(left_table->column_data_type(first_left_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto left_values = gather_values<ColumnDataType>(*left_table, first_left_column_id);
+    const auto right_values = gather_values<ColumnDataType>(*right_table, first_right_column_id);
+
+    // The hash table is built on the smaller input, as it is more expensive to insert a row than to look it up
+    if (left_values.size() < right_values.size()) {
+      hash_join(left_values, right_values, matches.left_rows, matches.right_rows);
+    } else {
+      hash_join(right_values, left_values, matches.right_rows, matches.left_rows);
+    }
+  });
+
+  for (auto pair_index = size_t{1}; pair_index < _column_id_pairs.size(); ++pair_index) {
+    const auto left_column_id = _column_id_pairs[pair_index].first;
+    const auto right_column_id = _column_id_pairs[pair_index].second;
+    resolve_data_type(left_table->column_data_type(left_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto left_values = gather_values<ColumnDataType>(*left_table, left_column_id);
+      const auto right_values = gather_values<ColumnDataType>(*right_table, right_column_id);
+
+      auto match_count = size_t{0};
+      for (auto index = size_t{0}; index < matches.left_rows.size(); ++index) {
+        const auto left_row = matches.left_rows[index];
+        const auto right_row = matches.right_rows[index];
+        if (left_values[left_row] != right_values[right_row]) continue;
+        matches.left_rows[match_count] = left_row;
+        matches.right_rows[match_count] = right_row;
+        ++match_count;
+      }
+      matches.left_rows.resize(match_count);
+      matches.right_rows.resize(match_count);
+    });
+  }
+
+  if (matches.left_rows.empty()) return output_table;
+
+  auto output_chunk = Chunk{};
+  add_output_columns(left_table, matches.left_rows, output_chunk);
+  add_output_columns(right_table, matches.right_rows, output_chunk);
+  output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
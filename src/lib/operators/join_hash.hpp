@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinHash returns the pairs of rows of its inputs for which the values in every pair of columns are equal (an inner
+// equi-join). The first pair of columns is joined by a hash table built on the smaller input and probed with the
+// other one, the remaining pairs are checked for each match. The columns of each pair need to have the same type.
+//
+// The output holds the columns of the left input followed by those of the right input as ReferenceColumns, which point
+// to the tables that the inputs refer to. Hence, unlike in the output of a TableScan, the ReferenceColumns of a chunk
+// do not share a single position list, but one per input table. Scans are thus executed before joins, see
+// JoinOrderOptimizer.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::vector<std::pair<ColumnID, ColumnID>>& column_id_pairs);
+
+  const std::vector<std::pair<ColumnID, ColumnID>>& column_id_pairs() const;
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::string _cache_key() const override;
+
+  const std::vector<std::pair<ColumnID, ColumnID>> _column_id_pairs;
+};
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include "materialize.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of positions that values are prefetched ahead of the one being gathered
+constexpr size_t PREFETCH_DISTANCE = 16;
+
+// The values of every chunk are looked up once by values_by_chunk, so that gathering a value only means following two
+// pointers (three for DictionaryColumns)
+template <typename T>
+pmr_vector<T> gather_values(const ReferencedValues<T>& values_by_chunk, const PosList& positions,
+                            const PolymorphicAllocator<T>& alloc) {
+  pmr_vector<T> values(alloc);
+  values.reserve(positions.size());
+
+  const auto position_count = positions.size();
+  for (auto index = size_t{0}; index < position_count; ++index) {
+    if (index + PREFETCH_DISTANCE < position_count) {
+      values_by_chunk.prefetch(positions[index + PREFETCH_DISTANCE]);
+    }
+
+    values.push_back(values_by_chunk[positions[index]]);
+  }
+
+  return values;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {}
+
+const std::string Materialize::name() const { return "Materialize"; }
+
+std::shared_ptr<BaseColumn> Materialize::gather(const Table& table, const ColumnID column_id,
+                                                const PosList& positions, const PolymorphicAllocator<Chunk>& alloc) {
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto values_by_chunk = ReferencedValues<ColumnDataType>{table, column_id};
+    column = std::make_shared<ValueColumn<ColumnDataType>>(
+        gather_values(values_by_chunk, positions, PolymorphicAllocator<ColumnDataType>{alloc}));
+  });
+  return column;
+}
+
+std::shared_ptr<BaseColumn> Materialize::share_or_copy(const Chunk& chunk, const ColumnID column_id) {
+  const auto column = chunk.get_column(column_id);
+  DebugAssert(column->encoding_type() != EncodingType::Reference, "ReferenceColumns need to be gathered");
+  if (chunk.is_sealed() || column->encoding_type() != EncodingType::Unencoded) return column;
+
+  std::shared_ptr<BaseColumn> copy;
+  resolve_data_type(column->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& values = static_cast<const ValueColumn<ColumnDataType>&>(*column).values();
+    copy = std::make_shared<ValueColumn<ColumnDataType>>(
+        pmr_vector<ColumnDataType>(values, PolymorphicAllocator<ColumnDataType>{chunk.get_allocator()}));
+  });
+  return copy;
+}
+
+std::string Materialize::_cache_key() const { return name(); }
+
+bool Materialize::_is_chunk_wise() const { return true; }
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_data_type(column_id));
+  }
+
+  // shared by all chunks, whose ReferenceColumns usually refer to the same columns
+  auto referenced_values = ReferencedValuesByColumn{};
+
+  const auto chunk_end = std::min(_input_chunk_end, input_table->chunk_count());
+  for (auto chunk_id = _input_chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+    const auto& input_chunk = input_table->get_chunk(chunk_id);
+    if (input_chunk.size() == 0) continue;
+
+    auto output_chunk = Chunk{input_chunk.get_allocator()};
+    for (auto column_id = ColumnID{0}; column_id < input_chunk.col_count(); ++column_id) {
+      const auto reference_column =
+          std::dynamic_pointer_cast<const ReferenceColumn>(input_chunk.get_column(column_id));
+      if (!reference_column) {
+        output_chunk.add_column(share_or_copy(input_chunk, column_id));
+        continue;
+      }
+
+      resolve_data_type(reference_column->data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        output_chunk.add_column(std::make_shared<ValueColumn<ColumnDataType>>(
+            gather_values(referenced_values.get<ColumnDataType>(*reference_column), *reference_column->pos_list(),
+                          PolymorphicAllocator<ColumnDataType>{input_chunk.get_allocator()})));
+      });
+    }
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
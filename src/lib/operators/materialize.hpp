@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+// Materialize replaces the ReferenceColumns of its input by ValueColumns holding the referenced values.
+// DictionaryColumns and the ValueColumns of sealed chunks are passed through without copying, see share_or_copy.
+// Values are gathered column by column into presized ValueColumns, so the cost is proportional to the size of the
+// output rather than to rows times columns times AllTypeVariant conversions.
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in);
+
+  const std::string name() const override;
+
+  // returns a ValueColumn holding the values at the given positions in column column_id of table
+  static std::shared_ptr<BaseColumn> gather(const Table& table, const ColumnID column_id, const PosList& positions,
+                                            const PolymorphicAllocator<Chunk>& alloc = {});
+
+  // Returns the non-reference column column_id of chunk if it cannot change anymore, i.e., if it is a DictionaryColumn
+  // or the chunk is sealed. Otherwise, returns a ValueColumn holding a copy of its values, as later appends to the
+  // chunk would also show up in an output that shares the column.
+  static std::shared_ptr<BaseColumn> share_or_copy(const Chunk& chunk, const ColumnID column_id);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::string _cache_key() const override;
+  bool _is_chunk_wise() const override;
+};
+
+}  // namespace opossum
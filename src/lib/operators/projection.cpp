@@ -0,0 +1,235 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "materialize.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Calls func with the function object that corresponds to the arithmetic operation expression_type
+template <typename Functor>
+void resolve_arithmetic_operator(const ExpressionType expression_type, const Functor& func) {
+  switch (expression_type) {
+    case ExpressionType::Addition:
+      func(std::plus<>{});
+      return;
+    case ExpressionType::Subtraction:
+      func(std::minus<>{});
+      return;
+    case ExpressionType::Multiplication:
+      func(std::multiplies<>{});
+      return;
+    case ExpressionType::Division:
+      func(std::divides<>{});
+      return;
+    default:
+      Fail("Expected an arithmetic operation");
+  }
+}
+
+// Operands of an arithmetic operation are either a value per row or, for literals, a single value for all rows. The
+// flags are template parameters, so that each combination becomes a loop without branches and the compiler can
+// vectorize it.
+template <bool left_is_literal, bool right_is_literal, typename Result, typename Left, typename Right,
+          typename Operator>
+void evaluate_operation(const Left* __restrict left, const Right* __restrict right, Result* __restrict result,
+                        const size_t size, const Operator& op) {
+  for (auto index = size_t{0}; index < size; ++index) {
+    result[index] = static_cast<Result>(op(static_cast<Result>(left[left_is_literal ? 0 : index]),
+                                           static_cast<Result>(right[right_is_literal ? 0 : index])));
+  }
+}
+
+// The values of an operand: a pointer to a single value for literals or to size values otherwise. column keeps the
+// values alive.
+template <typename T>
+struct Operand {
+  std::shared_ptr<const BaseColumn> column;
+  T literal_value;
+  const T* values;
+  bool is_literal;
+};
+
+std::shared_ptr<BaseColumn> evaluate(const Expression& expression, const Table& table, const Chunk& chunk);
+
+template <typename T>
+void prepare_operand(const Expression& expression, const Table& table, const Chunk& chunk, Operand<T>& operand) {
+  if (expression.type() == ExpressionType::Literal) {
+    operand.literal_value = type_cast<T>(expression.value());
+    operand.values = &operand.literal_value;
+    operand.is_literal = true;
+    return;
+  }
+
+  // DictionaryColumns are decoded, so that the operation loops over plain values
+  operand.column = decode_dictionary_column(evaluate(expression, table, chunk));
+  operand.values = static_cast<const ValueColumn<T>&>(*operand.column).values().data();
+  operand.is_literal = false;
+}
+
+std::shared_ptr<BaseColumn> evaluate_arithmetic_operation(const Expression& expression, const Table& table,
+                                                          const Chunk& chunk) {
+  std::shared_ptr<BaseColumn> result_column;
+
+  resolve_data_type(expression.left()->data_type(table), [&](auto left_type) {
+    resolve_data_type(expression.right()->data_type(table), [&](auto right_type) {
+      using LeftType = typename decltype(left_type)::type;
+      using RightType = typename decltype(right_type)::type;
+
+      if constexpr (std::is_arithmetic<LeftType>::value && std::is_arithmetic<RightType>::value) {
+        using ResultType = std::common_type_t<LeftType, RightType>;
+
+        Operand<LeftType> left;
+        Operand<RightType> right;
+        prepare_operand(*expression.left(), table, chunk, left);
+        prepare_operand(*expression.right(), table, chunk, right);
+
+        const auto size = chunk.size();
+        if constexpr (std::is_integral<ResultType>::value) {
+          if (expression.type() == ExpressionType::Division) {
+            const auto right_size = right.is_literal ? size_t{1} : size_t{size};
+            Assert(std::find(right.values, right.values + right_size, RightType{0}) == right.values + right_size,
+                   "Division by zero");
+          }
+        }
+
+        pmr_vector<ResultType> values(size, PolymorphicAllocator<ResultType>{chunk.get_allocator()});
+        resolve_arithmetic_operator(expression.type(), [&](auto op) {
+          if (left.is_literal && right.is_literal) {
+            evaluate_operation<true, true>(left.values, right.values, values.data(), size, op);
+          } else if (left.is_literal) {
+            evaluate_operation<true, false>(left.values, right.values, values.data(), size, op);
+          } else if (right.is_literal) {
+            evaluate_operation<false, true>(left.values, right.values, values.data(), size, op);
+          } else {
+            evaluate_operation<false, false>(left.values, right.values, values.data(), size, op);
+          }
+        });
+        result_column = std::make_shared<ValueColumn<ResultType>>(std::move(values));
+      } else {
+        Fail("Arithmetic operations are not supported for strings");
+      }
+    });
+  });
+
+  return result_column;
+}
+
+// Returns a ValueColumn holding the values of expression for the rows of chunk
+std::shared_ptr<BaseColumn> evaluate(const Expression& expression, const Table& table, const Chunk& chunk) {
+  switch (expression.type()) {
+    case ExpressionType::Column: {
+      const auto reference_column =
+          std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(expression.column_id()));
+      if (!reference_column) return Materialize::share_or_copy(chunk, expression.column_id());
+      return Materialize::gather(*reference_column->referenced_table(), reference_column->referenced_column_id(),
+                                 *reference_column->pos_list(), chunk.get_allocator());
+    }
+
+    case ExpressionType::Literal: {
+      // Only reached if a literal is projected on its own, operations handle literal operands themselves
+      std::shared_ptr<BaseColumn> column;
+      resolve_data_type(expression.data_type(table), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        column = std::make_shared<ValueColumn<ColumnDataType>>(
+            pmr_vector<ColumnDataType>(chunk.size(), type_cast<ColumnDataType>(expression.value()),
+                                       PolymorphicAllocator<ColumnDataType>{chunk.get_allocator()}));
+      });
+      return column;
+    }
+
+    default:
+      return evaluate_arithmetic_operation(expression, table, chunk);
+  }
+}
+
+// Same as Expression::description, but literals are prefixed with their type, which decides the type of the result,
+// and strings with their length, so that different expressions have different keys
+std::string expression_cache_key(const Expression& expression) {
+  switch (expression.type()) {
+    case ExpressionType::Column:
+      return "#" + std::to_string(expression.column_id());
+    case ExpressionType::Literal: {
+      const auto value = to_string(expression.value());
+      return data_type_to_string(static_cast<DataType>(expression.value().which())) + ":" +
+             std::to_string(value.size()) + ":" + value;
+    }
+    default:
+      const auto operation = std::to_string(static_cast<int>(expression.type()));
+      return "(" + expression_cache_key(*expression.left()) + " " + operation + " " +
+             expression_cache_key(*expression.right()) + ")";
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<ProjectionDefinition>& definitions)
+    : AbstractOperator(in), _definitions(definitions) {}
+
+const std::vector<ProjectionDefinition>& Projection::definitions() const { return _definitions; }
+
+const std::string Projection::name() const { return "Projection"; }
+
+const std::string Projection::description() const {
+  auto description = name() + " (";
+  for (auto index = size_t{0}; index < _definitions.size(); ++index) {
+    if (index > 0) description += ", ";
+    description += _definitions[index].expression->description() + " AS " + _definitions[index].name;
+  }
+  return description + ")";
+}
+
+std::string Projection::_cache_key() const {
+  auto key = name();
+  for (const auto& definition : _definitions) {
+    key += " " + expression_cache_key(*definition.expression) + " AS " + std::to_string(definition.name.size()) + ":" +
+           definition.name;
+  }
+  return key;
+}
+
+bool Projection::_is_chunk_wise() const { return true; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  // Checks the expressions and determines the types of the output columns before any value is computed
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (const auto& definition : _definitions) {
+    Assert(definition.expression, "Projection needs an expression for every output column");
+    output_table->add_column_definition(definition.name, definition.expression->data_type(*input_table));
+  }
+
+  const auto chunk_end = std::min(_input_chunk_end, input_table->chunk_count());
+  for (auto chunk_id = _input_chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+    const auto& input_chunk = input_table->get_chunk(chunk_id);
+    if (input_chunk.size() == 0) continue;
+
+    auto output_chunk = Chunk{input_chunk.get_allocator()};
+    for (const auto& definition : _definitions) {
+      output_chunk.add_column(evaluate(*definition.expression, *input_table, input_chunk));
+    }
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "expression/expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Describes one output column of a Projection: the expression computing its values and the column's name
+struct ProjectionDefinition {
+  std::shared_ptr<const Expression> expression;
+  std::string name;
+};
+
+// Projection computes one output column per ProjectionDefinition. Expressions are evaluated a chunk at a time: each
+// arithmetic operation runs one tight loop over the values of its operands, which is instantiated for every
+// combination of operand types and operators, so that no type dispatch or interpretation happens per row and the
+// compiler can vectorize the loop. Intermediate results are ValueColumns.
+//
+// Expressions that only refer to a column pass the column through without copying unless it may still change, see
+// Materialize::share_or_copy. ReferenceColumns are materialized and DictionaryColumns are decoded before they are used
+// as an operand, so the output consists of ValueColumns and passed-through DictionaryColumns.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ProjectionDefinition>& definitions);
+
+  const std::vector<ProjectionDefinition>& definitions() const;
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::string _cache_key() const override;
+  bool _is_chunk_wise() const override;
+
+  const std::vector<ProjectionDefinition> _definitions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,182 @@
+#include "result_cache.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool has_rows(const std::shared_ptr<const Table>& table) { return table && table->row_count() > 0; }
+
+// Appends the non-empty chunks of suffix to those of prefix, which are outputs of the same operator and thus have the
+// same column definitions. The chunks are shared rather than copied. Returns one of the tables if the other is empty.
+std::shared_ptr<const Table> concatenate(const std::shared_ptr<const Table>& prefix,
+                                         const std::shared_ptr<const Table>& suffix) {
+  if (!has_rows(suffix)) return prefix ? prefix : suffix;
+  if (!has_rows(prefix)) return suffix;
+
+  auto table = std::make_shared<Table>(prefix->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < prefix->col_count(); ++column_id) {
+    table->add_column_definition(prefix->column_name(column_id), prefix->column_data_type(column_id));
+  }
+  for (const auto& part : {prefix, suffix}) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < part->chunk_count(); ++chunk_id) {
+      const auto& chunk = part->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      auto shared_chunk = Chunk{chunk.get_allocator()};
+      for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+        shared_chunk.add_column(chunk.get_column(column_id));
+      }
+      table->emplace_chunk(std::move(shared_chunk));
+    }
+  }
+  return table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ResultCache& ResultCache::get() {
+  static ResultCache instance;
+  return instance;
+}
+
+void ResultCache::set_memory_budget(const size_t bytes) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = bytes;
+  _evict_if_necessary();
+}
+
+size_t ResultCache::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+size_t ResultCache::cached_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cached_bytes;
+}
+
+size_t ResultCache::entry_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.size();
+}
+
+void ResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _lru_keys.clear();
+  _cached_bytes = 0;
+}
+
+std::shared_ptr<const Table> ResultCache::execute(AbstractOperator& op) {
+  if (!op._input_left || memory_budget() == 0) return op._on_execute();
+  const auto operator_key = op._cache_key();
+  if (operator_key.empty()) return op._on_execute();
+
+  const auto left_input = op._input_table_left();
+  const auto right_input = op._input_table_right();
+  const auto key = operator_key + '\0' + std::to_string(reinterpret_cast<uintptr_t>(left_input.get())) + '\0' +
+                   std::to_string(reinterpret_cast<uintptr_t>(right_input.get()));
+
+  // The output of the input chunks that were sealed when a previous output was cached
+  auto sealed_input_chunk_count = ChunkID{0};
+  auto sealed_output = std::shared_ptr<const Table>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto iter = _entries.find(key);
+    if (iter != _entries.end() && iter->second.left_input.lock() == left_input &&
+        iter->second.right_input.lock() == right_input) {
+      auto& entry = iter->second;
+      if (entry.left_version == left_input->version() &&
+          (!right_input || entry.right_version == right_input->version())) {
+        _lru_keys.splice(_lru_keys.begin(), _lru_keys, entry.lru_position);
+        PerformanceCount("result cache hit");
+        return entry.output;
+      }
+      sealed_input_chunk_count = entry.sealed_input_chunk_count;
+      sealed_output = entry.sealed_output;
+    }
+  }
+
+  const auto execute_chunks = [&](const ChunkID begin, const ChunkID end) {
+    op._input_chunk_begin = begin;
+    op._input_chunk_end = end;
+    auto output = op._on_execute();
+    op._input_chunk_begin = ChunkID{0};
+    op._input_chunk_end = ChunkID{std::numeric_limits<ChunkID::base_type>::max()};
+    return output;
+  };
+
+  auto entry = Entry{};
+  entry.left_input = left_input;
+  entry.right_input = right_input;
+  entry.left_version = left_input->version();
+  entry.right_version = right_input ? right_input->version() : 0;
+  if (!right_input && op._is_chunk_wise()) {
+    // Chunks sealed since the previous execution are processed apart from the rest, so that their output can be kept
+    const auto chunk_count = left_input->chunk_count();
+    auto new_sealed_input_chunk_count = sealed_input_chunk_count;
+    while (new_sealed_input_chunk_count < chunk_count &&
+           left_input->get_chunk(new_sealed_input_chunk_count).is_sealed()) {
+      ++new_sealed_input_chunk_count;
+    }
+    if (sealed_output) PerformanceCount("result cache partial hit");
+
+    if (sealed_input_chunk_count < new_sealed_input_chunk_count) {
+      sealed_output =
+          concatenate(sealed_output, execute_chunks(sealed_input_chunk_count, new_sealed_input_chunk_count));
+    }
+    entry.output = sealed_output;
+    if (!entry.output || new_sealed_input_chunk_count < chunk_count) {
+      entry.output = concatenate(sealed_output, execute_chunks(new_sealed_input_chunk_count, chunk_count));
+    }
+    entry.sealed_input_chunk_count = new_sealed_input_chunk_count;
+    entry.sealed_output = std::move(sealed_output);
+  } else {
+    entry.output = op._on_execute();
+  }
+  entry.bytes = entry.output->estimate_memory_usage();
+  const auto output = entry.output;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _erase(key);
+  if (entry.bytes > _memory_budget) return output;
+
+  _lru_keys.push_front(key);
+  entry.lru_position = _lru_keys.begin();
+  _cached_bytes += entry.bytes;
+  _entries.emplace(key, std::move(entry));
+  _evict_if_necessary();
+  return output;
+}
+
+void ResultCache::_erase(const std::string& key) {
+  const auto iter = _entries.find(key);
+  if (iter == _entries.end()) return;
+
+  _cached_bytes -= iter->second.bytes;
+  _lru_keys.erase(iter->second.lru_position);
+  _entries.erase(iter);
+}
+
+void ResultCache::_evict_if_necessary() {
+  while (_cached_bytes > _memory_budget && !_lru_keys.empty()) {
+    const auto key = _lru_keys.back();
+    _erase(key);
+    PerformanceCount("result cache entry evicted");
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * The ResultCache is a singleton that keeps the outputs of operators, so that executing an operator again on the same
+ * inputs returns the cached output as long as the inputs have not changed (see AbstractOperator::execute). Entries are
+ * keyed by the operator and its parameters (see AbstractOperator::_cache_key) as well as by the input tables, and are
+ * valid while the versions of the input tables (see Table::version) stay the same. Once the estimated memory usage of
+ * the cached outputs exceeds the budget, the least recently used entries are evicted. A budget of 0, the default,
+ * disables the cache.
+ *
+ * Sealed chunks never change. Hence, if the input of a chunk-wise operator (see AbstractOperator::_is_chunk_wise) has
+ * changed, the output of the input chunks that were sealed when the entry was created is reused, and only the
+ * remaining chunks are processed. The output is a new table in that case, so that operators consuming it are executed
+ * again, while cache hits return the cached table itself, so that the operators consuming it hit the cache as well.
+ *
+ * All methods are thread-safe.
+ */
+class ResultCache : private Noncopyable {
+ public:
+  static ResultCache& get();
+
+  // sets the budget for the cached outputs in bytes and evicts entries if it is exceeded. 0 disables the cache.
+  void set_memory_budget(size_t bytes);
+  size_t memory_budget() const;
+
+  // returns the estimated number of bytes occupied by the cached outputs
+  size_t cached_bytes() const;
+
+  size_t entry_count() const;
+
+  // removes all entries
+  void clear();
+
+  // returns the output of the operator, whose inputs need to be executed, from the cache if possible, and caches it
+  std::shared_ptr<const Table> execute(AbstractOperator& op);
+
+  ResultCache(ResultCache&&) = delete;
+
+ protected:
+  ResultCache() = default;
+
+  struct Entry {
+    // As the key holds the addresses of the input tables, the entry is only valid while these tables exist
+    std::weak_ptr<const Table> left_input;
+    std::weak_ptr<const Table> right_input;
+    uint64_t left_version = 0;
+    uint64_t right_version = 0;
+
+    std::shared_ptr<const Table> output;
+
+    // Only set for chunk-wise operators: the number of leading sealed chunks of the input when the entry was created,
+    // and the output of these chunks. The output shares its chunks with the complete output.
+    ChunkID sealed_input_chunk_count{0};
+    std::shared_ptr<const Table> sealed_output;
+
+    size_t bytes = 0;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  // Removes the entry of the key if there is one. Expects _mutex to be locked.
+  void _erase(const std::string& key);
+
+  // removes the least recently used entries until the cached outputs fit into the budget. Expects _mutex to be locked.
+  void _evict_if_necessary();
+
+  mutable std::mutex _mutex;
+  size_t _memory_budget = 0;
+  size_t _cached_bytes = 0;
+  std::unordered_map<std::string, Entry> _entries;
+
+  // the keys of the entries from the most to the least recently used one
+  std::list<std::string> _lru_keys;
+};
+
+}  // namespace opossum
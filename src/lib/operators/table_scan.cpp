@@ -0,0 +1,420 @@
+#include "table_scan.hpp"
+
+#include <optional>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/hash_index.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/trigram_index.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/like_matcher.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Calls func with the comparator that corresponds to scan_type
+template <typename Functor>
+void resolve_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      func(std::equal_to<>{});
+      return;
+    case ScanType::OpNotEquals:
+      func(std::not_equal_to<>{});
+      return;
+    case ScanType::OpLessThan:
+      func(std::less<>{});
+      return;
+    case ScanType::OpLessThanEquals:
+      func(std::less_equal<>{});
+      return;
+    case ScanType::OpGreaterThan:
+      func(std::greater<>{});
+      return;
+    case ScanType::OpGreaterThanEquals:
+      func(std::greater_equal<>{});
+      return;
+    case ScanType::OpLike:
+      break;
+  }
+  Fail("Unknown scan type");
+}
+
+// The elements of a sorted sequence that fulfill a predicate form a single range [begin, end) or, for OpNotEquals, its
+// complement. The sequence is either the values of a sorted chunk or the dictionary of a DictionaryColumn.
+struct MatchingRange {
+  uint32_t begin;
+  uint32_t end;
+  bool is_negated;
+
+  bool matches_none(const uint32_t size) const { return is_negated ? end - begin == size : begin == end; }
+  bool matches_all(const uint32_t size) const { return is_negated ? begin == end : end - begin == size; }
+};
+
+// Determines the matching range from the bounds of the search value in a sorted sequence of the given size, i.e., from
+// the first element that is not smaller (lower_bound) and the first element that is greater (upper_bound)
+MatchingRange matching_range(const ScanType scan_type, const uint32_t lower_bound, const uint32_t upper_bound,
+                             const uint32_t size) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {lower_bound, upper_bound, false};
+    case ScanType::OpNotEquals:
+      return {lower_bound, upper_bound, true};
+    case ScanType::OpLessThan:
+      return {0, lower_bound, false};
+    case ScanType::OpLessThanEquals:
+      return {0, upper_bound, false};
+    case ScanType::OpGreaterThan:
+      return {upper_bound, size, false};
+    case ScanType::OpGreaterThanEquals:
+      return {lower_bound, size, false};
+    case ScanType::OpLike:
+      break;
+  }
+  Fail("Unknown scan type");
+  return {};
+}
+
+// Appends the positions in the range of offsets (or, if it is negated, the others) of a chunk with chunk_size rows
+void append_positions(const ChunkID chunk_id, const MatchingRange& range, const ChunkOffset chunk_size,
+                      PosList& pos_list) {
+  const auto append_range = [&](const ChunkOffset begin, const ChunkOffset end) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      pos_list.push_back(RowID{chunk_id, chunk_offset});
+    }
+  };
+
+  if (range.is_negated) {
+    pos_list.reserve(pos_list.size() + chunk_size - (range.end - range.begin));
+    append_range(0, range.begin);
+    append_range(range.end, chunk_size);
+  } else {
+    pos_list.reserve(pos_list.size() + (range.end - range.begin));
+    append_range(range.begin, range.end);
+  }
+}
+
+// Scans a ValueColumn of a chunk that is sorted by it (see Table::enable_clustering) using binary search
+template <typename T>
+void scan_sorted_value_column(const pmr_vector<T>& values, const ScanType scan_type, const T& search_value,
+                              const ChunkID chunk_id, PosList& pos_list) {
+  PerformanceCount("sorted chunk scanned by binary search");
+  const auto lower_bound = std::lower_bound(values.cbegin(), values.cend(), search_value);
+  const auto upper_bound = std::upper_bound(lower_bound, values.cend(), search_value);
+  const auto chunk_size = static_cast<ChunkOffset>(values.size());
+  const auto range = matching_range(scan_type, static_cast<uint32_t>(lower_bound - values.cbegin()),
+                                    static_cast<uint32_t>(upper_bound - values.cbegin()), chunk_size);
+  append_positions(chunk_id, range, chunk_size, pos_list);
+}
+
+// Scans a DictionaryColumn by comparing value ids instead of values. As the dictionary is sorted, the matching value
+// ids form a MatchingRange. If the chunk is sorted by the column, so are the value ids, and the matching positions are
+// found using binary search.
+template <typename T>
+void scan_dictionary_column(const DictionaryColumn<T>& column, const ScanType scan_type, const T& search_value,
+                            const ChunkID chunk_id, const bool is_sorted, PosList& pos_list) {
+  const auto unique_values_count = static_cast<uint32_t>(column.unique_values_count());
+  const auto value_id_range = matching_range(scan_type, static_cast<uint32_t>(column.lower_bound(search_value)),
+                                             static_cast<uint32_t>(column.upper_bound(search_value)),
+                                             unique_values_count);
+
+  const auto chunk_size = static_cast<ChunkOffset>(column.size());
+  if (value_id_range.matches_none(unique_values_count)) {
+    PerformanceCount("chunk skipped by dictionary");
+    return;
+  }
+  if (value_id_range.matches_all(unique_values_count)) {
+    PerformanceCount("all rows of dictionary column match");
+    append_positions(chunk_id, {0, chunk_size, false}, chunk_size, pos_list);
+    return;
+  }
+
+  resolve_attribute_vector(column.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.value_ids();
+    if (is_sorted) {
+      PerformanceCount("sorted chunk scanned by binary search");
+      const auto begin = std::lower_bound(value_ids.cbegin(), value_ids.cend(), value_id_range.begin);
+      const auto end = std::lower_bound(begin, value_ids.cend(), value_id_range.end);
+      append_positions(chunk_id,
+                       {static_cast<uint32_t>(begin - value_ids.cbegin()),
+                        static_cast<uint32_t>(end - value_ids.cbegin()), value_id_range.is_negated},
+                       chunk_size, pos_list);
+      return;
+    }
+
+    const auto range_size = value_id_range.end - value_id_range.begin;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      // A single unsigned comparison checks both bounds of the range
+      if ((static_cast<uint32_t>(value_ids[chunk_offset] - value_id_range.begin) < range_size) !=
+          value_id_range.is_negated) {
+        pos_list.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+  });
+}
+
+// Scans a DictionaryColumn for the values that match a LIKE pattern. The pattern is checked once per entry of the
+// dictionary, so that the rows are selected by looking up whether their value id matches.
+template <typename Kernel>
+void scan_dictionary_column_like(const DictionaryColumn<std::string>& column, const Kernel& matches,
+                                 const ChunkID chunk_id, PosList& pos_list) {
+  const auto& dictionary = column.dictionary();
+  auto value_id_matches = std::vector<uint8_t>(dictionary.size());
+  auto matching_value_id_count = size_t{0};
+  for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+    value_id_matches[value_id] = matches(dictionary[value_id]);
+    matching_value_id_count += value_id_matches[value_id];
+  }
+
+  const auto chunk_size = static_cast<ChunkOffset>(column.size());
+  if (matching_value_id_count == 0) {
+    PerformanceCount("chunk skipped by dictionary");
+    return;
+  }
+  if (matching_value_id_count == dictionary.size()) {
+    PerformanceCount("all rows of dictionary column match");
+    append_positions(chunk_id, {0, chunk_size, false}, chunk_size, pos_list);
+    return;
+  }
+
+  resolve_attribute_vector(column.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.value_ids();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (value_id_matches[value_ids[chunk_offset]]) pos_list.push_back(RowID{chunk_id, chunk_offset});
+    }
+  });
+}
+
+// Scans a string column for the values that match a LIKE pattern using the kernel of the pattern (see
+// LikeMatcher::resolve_kernel). If the chunk has a TrigramIndex on the column, only the rows that contain all trigrams
+// of the pattern are checked. Otherwise, a DictionaryColumn is scanned by the value ids that match. The values of a
+// ReferenceColumn are looked up through referenced_values.
+void scan_like(const BaseColumn& column, const TrigramIndex* trigram_index, const LikeMatcher& like_matcher,
+               const ChunkID chunk_id, ReferencedValuesByColumn& referenced_values, PosList& pos_list) {
+  const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column);
+  const auto candidates =
+      trigram_index && !reference_column ? trigram_index->candidates(like_matcher.pattern()) : std::nullopt;
+  if (candidates && candidates->empty()) {
+    PerformanceCount("chunk skipped by trigram index");
+    return;
+  }
+  if (candidates) PerformanceCount("chunk scanned using trigram index");
+
+  like_matcher.resolve_kernel([&](const auto& matches) {
+    if (reference_column) {
+      const auto& values_by_chunk = referenced_values.get<std::string>(*reference_column);
+      for (const auto& row_id : *reference_column->pos_list()) {
+        if (matches(values_by_chunk[row_id])) pos_list.push_back(row_id);
+      }
+      return;
+    }
+
+    const auto scan_values = [&](const auto& value_at) {
+      if (candidates) {
+        for (const auto chunk_offset : *candidates) {
+          if (matches(value_at(chunk_offset))) pos_list.push_back(RowID{chunk_id, chunk_offset});
+        }
+        return;
+      }
+      const auto chunk_size = static_cast<ChunkOffset>(column.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (matches(value_at(chunk_offset))) pos_list.push_back(RowID{chunk_id, chunk_offset});
+      }
+    };
+
+    if (column.encoding_type() == EncodingType::Dictionary) {
+      const auto& dictionary_column = static_cast<const DictionaryColumn<std::string>&>(column);
+      if (!candidates) {
+        scan_dictionary_column_like(dictionary_column, matches, chunk_id, pos_list);
+        return;
+      }
+
+      // The candidates are fewer than the rows and possibly than the dictionary entries, so they are checked directly
+      const auto& dictionary = dictionary_column.dictionary();
+      resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.value_ids();
+        scan_values([&](const ChunkOffset chunk_offset) -> const std::string& {
+          return dictionary[value_ids[chunk_offset]];
+        });
+      });
+    } else {
+      const auto& values = static_cast<const ValueColumn<std::string>&>(column).values();
+      scan_values([&](const ChunkOffset chunk_offset) -> const std::string& { return values[chunk_offset]; });
+    }
+  });
+}
+
+std::string scan_type_to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+    case ScanType::OpLike:
+      return "LIKE";
+  }
+  Fail("Unknown scan type");
+  return "";
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+const std::string TableScan::description() const {
+  return name() + " (column " + std::to_string(_column_id) + " " + scan_type_to_string(_scan_type) + " " +
+         to_string(_search_value) + ")";
+}
+
+std::string TableScan::_cache_key() const {
+  // The description does not tell the type of the search value, e.g., whether 1 is an int or a string
+  return description() + " " + data_type_to_string(static_cast<DataType>(_search_value.which()));
+}
+
+bool TableScan::_is_chunk_wise() const {
+  return _scan_type != ScanType::OpEquals || !_input_table_left()->get_hash_index(_column_id);
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(_column_id < input_table->col_count(), "Column does not exist");
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_data_type(column_id));
+  }
+
+  auto like_matcher = std::optional<LikeMatcher>{};
+  if (_scan_type == ScanType::OpLike) {
+    Assert(input_table->column_data_type(_column_id) == DataType::String, "LIKE needs a string column");
+    like_matcher.emplace(type_cast<std::string>(_search_value));
+  }
+
+  resolve_data_type(input_table->column_data_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto search_value = type_cast<ColumnDataType>(_search_value);
+
+    // A HashIndex yields the matching positions of all chunks at once, which are sorted to keep the order of a scan
+    const auto hash_index = _scan_type == ScanType::OpEquals ? input_table->get_hash_index(_column_id) : nullptr;
+    if (hash_index) {
+      PerformanceCount("scan answered by hash index");
+      auto pos_list = std::make_shared<PosList>();
+      static_cast<const HashIndex<ColumnDataType>&>(*hash_index).lookup(search_value, *pos_list);
+      if (pos_list->empty()) return;
+
+      std::sort(pos_list->begin(), pos_list->end());
+      auto output_chunk = Chunk{};
+      for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+        output_chunk.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, pos_list));
+      }
+      output_table->emplace_chunk(std::move(output_chunk));
+      return;
+    }
+
+    // The chunks of a reference input usually refer to the same column, whose chunks are thus resolved only once
+    auto referenced_values = ReferencedValuesByColumn{};
+
+    const auto chunk_end = std::min(_input_chunk_end, input_table->chunk_count());
+    for (auto chunk_id = _input_chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      if (_scan_type == ScanType::OpEquals) {
+        const auto bloom_filter = chunk.get_bloom_filter(_column_id);
+        if (bloom_filter && !bloom_filter->contains(search_value)) {
+          PerformanceCount("chunk skipped by Bloom filter");
+          continue;
+        }
+      }
+
+      auto pos_list = std::make_shared<PosList>();
+      const auto column = chunk.get_column(_column_id);
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+
+      if (like_matcher) {
+        scan_like(*column, chunk.get_trigram_index(_column_id).get(), *like_matcher, chunk_id, referenced_values,
+                  *pos_list);
+      } else if (column->encoding_type() == EncodingType::Dictionary) {
+        scan_dictionary_column(static_cast<const DictionaryColumn<ColumnDataType>&>(*column), _scan_type, search_value,
+                               chunk_id, chunk.is_sorted_by(_column_id), *pos_list);
+      } else if (!reference_column && chunk.is_sorted_by(_column_id)) {
+        scan_sorted_value_column(static_cast<const ValueColumn<ColumnDataType>&>(*column).values(), _scan_type,
+                                 search_value, chunk_id, *pos_list);
+      } else {
+        resolve_comparator(_scan_type, [&](auto comparator) {
+          if (reference_column) {
+            // Positions are looked up in the referenced table, whose positions are passed on to the output
+            const auto& values_by_chunk = referenced_values.get<ColumnDataType>(*reference_column);
+            for (const auto& row_id : *reference_column->pos_list()) {
+              if (comparator(values_by_chunk[row_id], search_value)) {
+                pos_list->push_back(row_id);
+              }
+            }
+          } else {
+            const auto& values = static_cast<const ValueColumn<ColumnDataType>&>(*column).values();
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+              if (comparator(values[chunk_offset], search_value)) {
+                pos_list->push_back(RowID{chunk_id, chunk_offset});
+              }
+            }
+          }
+        });
+      }
+
+      if (pos_list->empty()) continue;
+
+      auto output_chunk = Chunk{};
+      for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+        if (!reference_column) {
+          output_chunk.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, pos_list));
+          continue;
+        }
+
+        const auto input_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+        Assert(input_column && input_column->pos_list() == reference_column->pos_list(),
+               "All columns of a reference chunk need to share the same position list");
+        output_chunk.add_column(std::make_shared<ReferenceColumn>(input_column->referenced_table(),
+                                                                  input_column->referenced_column_id(), pos_list));
+      }
+      output_table->emplace_chunk(std::move(output_chunk));
+    }
+  });
+
+  return output_table;
+}
+
+}  // namespace opossum
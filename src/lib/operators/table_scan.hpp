@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TableScan returns the rows of its input for which the value in column_id fulfills the predicate given by scan_type
+// and search_value. The output consists of ReferenceColumns, which point to the input table or, if the input consists
+// of ReferenceColumns itself, to the table referenced by those.
+//
+// For OpEquals, chunks whose Bloom filter (see Table::enable_bloom_filter) rules out search_value are skipped without
+// looking at their values. Chunks that are sorted by column_id (see Table::enable_clustering) are scanned using binary
+// search. If the input table has a HashIndex on column_id (see Table::enable_hash_index), OpEquals looks up the rows
+// in it instead of scanning, and the output holds a single chunk. For OpLike, whose search value is the pattern, chunks
+// with a TrigramIndex on column_id (see Table::enable_trigram_index) only check the rows that contain all trigrams of
+// the pattern.
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::string _cache_key() const override;
+  bool _is_chunk_wise() const override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// operator to wrap a table so that it can be used as the input of other operators
+class TableWrapper : public AbstractOperator {
+ public:
+  explicit TableWrapper(const std::shared_ptr<const Table> table);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::shared_ptr<const Table> _table;
+};
+
+}  // namespace opossum
@@ -0,0 +1,244 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Splitting the input among threads only pays off if every thread has a reasonable amount of work
+constexpr size_t MIN_ROWS_PER_WORKER = 100'000;
+
+template <typename T>
+struct Candidate {
+  T value;
+  RowID row_id;
+};
+
+/**
+ * Keeps the k best candidates seen so far in a heap whose top is the worst of them. A candidate is better than another
+ * one if its value comes first according to Comparator or, for equal values, if its position is smaller.
+ */
+template <typename T, typename Comparator>
+class BoundedHeap {
+ public:
+  // row_count is an upper bound of the number of rows that will be offered, so that a k larger than the input does not
+  // reserve memory for candidates that will never exist
+  BoundedHeap(const size_t k, const size_t row_count) : _k(k) { _candidates.reserve(std::min(k, row_count)); }
+
+  bool is_full() const { return _candidates.size() == _k; }
+
+  // only valid if the heap is full
+  const T& worst_value() const { return _candidates.front().value; }
+
+  void offer(const T& value, const RowID& row_id) {
+    if (_candidates.size() < _k) {
+      _candidates.push_back({value, row_id});
+      std::push_heap(_candidates.begin(), _candidates.end(), &is_better);
+      return;
+    }
+
+    // Compares the values before constructing a candidate, so that rejecting a row does not copy its value
+    const auto& worst = _candidates.front();
+    if (Comparator{}(value, worst.value) || (!Comparator{}(worst.value, value) && row_id < worst.row_id)) {
+      std::pop_heap(_candidates.begin(), _candidates.end(), &is_better);
+      _candidates.back() = {value, row_id};
+      std::push_heap(_candidates.begin(), _candidates.end(), &is_better);
+    }
+  }
+
+  std::vector<Candidate<T>>& candidates() { return _candidates; }
+
+  static bool is_better(const Candidate<T>& lhs, const Candidate<T>& rhs) {
+    return Comparator{}(lhs.value, rhs.value) || (!Comparator{}(rhs.value, lhs.value) && lhs.row_id < rhs.row_id);
+  }
+
+ protected:
+  size_t _k;
+  std::vector<Candidate<T>> _candidates;
+};
+
+// Offers all rows of the chunks in [begin, end) to heap. Chunks are visited in ascending order.
+template <typename T, typename Comparator>
+void find_top_k_in_chunks(const Table& table, const ColumnID column_id, const ChunkID begin, const ChunkID end,
+                          BoundedHeap<T, Comparator>& heap) {
+  const auto comparator = Comparator{};
+
+  // Every worker resolves the referenced chunks that its positions refer to once
+  auto referenced_values = ReferencedValuesByColumn{};
+
+  for (auto chunk_id = begin; chunk_id < end; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    const auto column = chunk.get_column(column_id);
+
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      const auto& values_by_chunk = referenced_values.get<T>(*reference_column);
+      for (const auto& row_id : *reference_column->pos_list()) {
+        heap.offer(values_by_chunk[row_id], row_id);
+      }
+      continue;
+    }
+
+    // All candidates in the heap stem from earlier chunks, i.e., they have smaller positions. Thus, a row of this
+    // chunk only makes it into the heap if its value is strictly better than the worst value in the heap.
+    const auto& min_max = chunk.get_min_max(column_id);
+    if (min_max && heap.is_full()) {
+      const auto& best_value = std::is_same<Comparator, std::less<>>::value ? min_max->min : min_max->max;
+      if (!comparator(type_cast<T>(best_value), heap.worst_value())) {
+        PerformanceCount("chunk skipped by TopK");
+        continue;
+      }
+    }
+
+    if (column->encoding_type() == EncodingType::Dictionary) {
+      const auto& dictionary_column = static_cast<const DictionaryColumn<T>&>(*column);
+      const auto& dictionary = dictionary_column.dictionary();
+      resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.value_ids();
+        const auto value_count = value_ids.size();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_count; ++chunk_offset) {
+          heap.offer(dictionary[value_ids[chunk_offset]], RowID{chunk_id, chunk_offset});
+        }
+      });
+      continue;
+    }
+
+    const auto& values = static_cast<const ValueColumn<T>&>(*column).values();
+    const auto value_count = values.size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_count; ++chunk_offset) {
+      heap.offer(values[chunk_offset], RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
+template <typename T, typename Comparator>
+PosList find_top_k(const Table& table, const ColumnID column_id, const size_t k) {
+  using Heap = BoundedHeap<T, Comparator>;
+
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto max_worker_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto worker_count =
+      std::clamp(table.row_count() / MIN_ROWS_PER_WORKER, size_t{1}, std::min(max_worker_count, chunk_count));
+
+  std::vector<Heap> heaps(worker_count, Heap{k, table.row_count()});
+  const auto chunk_range = [&](const size_t worker_id) {
+    return std::make_pair(ChunkID{static_cast<ChunkID>(chunk_count * worker_id / worker_count)},
+                          ChunkID{static_cast<ChunkID>(chunk_count * (worker_id + 1) / worker_count)});
+  };
+
+  parallel_for(worker_count, worker_count, [&](const size_t worker_id) {
+    const auto range = chunk_range(worker_id);
+    find_top_k_in_chunks(table, column_id, range.first, range.second, heaps[worker_id]);
+  });
+
+  // Every heap holds the k best rows of its chunks, so the k best rows overall are among them
+  auto& candidates = heaps[0].candidates();
+  for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+    auto& worker_candidates = heaps[worker_id].candidates();
+    std::move(worker_candidates.begin(), worker_candidates.end(), std::back_inserter(candidates));
+  }
+  const auto result_size = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + result_size, candidates.end(), &Heap::is_better);
+
+  PosList pos_list;
+  pos_list.reserve(result_size);
+  for (auto index = size_t{0}; index < result_size; ++index) {
+    pos_list.push_back(candidates[index].row_id);
+  }
+  return pos_list;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t k)
+    : AbstractOperator(in), _column_id(column_id), _order_by_mode(order_by_mode), _k(k) {}
+
+ColumnID TopK::column_id() const { return _column_id; }
+
+OrderByMode TopK::order_by_mode() const { return _order_by_mode; }
+
+size_t TopK::k() const { return _k; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::string TopK::description() const {
+  return name() + " (column " + std::to_string(_column_id) +
+         (_order_by_mode == OrderByMode::Ascending ? " ascending" : " descending") + ", k = " + std::to_string(_k) +
+         ")";
+}
+
+std::string TopK::_cache_key() const { return description(); }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(_column_id < input_table->col_count(), "Column does not exist");
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->col_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_data_type(column_id));
+  }
+
+  // The output references a single table per column: either the input table or, if the input consists of
+  // ReferenceColumns, the tables referenced by them
+  auto referenced_columns = std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    auto chunk_referenced_columns = std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>{};
+    for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+      if (reference_column) {
+        chunk_referenced_columns.emplace_back(reference_column->referenced_table(),
+                                              reference_column->referenced_column_id());
+      } else {
+        chunk_referenced_columns.emplace_back(input_table, column_id);
+      }
+    }
+
+    if (referenced_columns.empty()) referenced_columns = chunk_referenced_columns;
+    Assert(referenced_columns == chunk_referenced_columns, "All chunks need to reference the same tables");
+  }
+
+  if (_k == 0 || referenced_columns.empty()) return output_table;
+
+  auto pos_list = std::make_shared<PosList>();
+  resolve_data_type(input_table->column_data_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (_order_by_mode == OrderByMode::Ascending) {
+      *pos_list = find_top_k<ColumnDataType, std::less<>>(*input_table, _column_id, _k);
+    } else {
+      *pos_list = find_top_k<ColumnDataType, std::greater<>>(*input_table, _column_id, _k);
+    }
+  });
+
+  auto output_chunk = Chunk{};
+  for (const auto& referenced_column : referenced_columns) {
+    output_chunk.add_column(
+        std::make_shared<ReferenceColumn>(referenced_column.first, referenced_column.second, pos_list));
+  }
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TopK returns the k rows of its input with the smallest (OrderByMode::Ascending) or largest (OrderByMode::Descending)
+// values in column_id, ordered by these values, i.e., it computes ORDER BY column_id LIMIT k without sorting the
+// input. Rows with equal values are ordered by their position, so the result does not depend on the number of threads.
+//
+// The chunks are split among worker threads. Each worker keeps a bounded heap of its k best rows and skips sealed
+// chunks whose minimum (or maximum) cannot beat the k-th row found so far (see Chunk::get_min_max). In the end, the
+// heaps are merged. Like TableScan, the output is a single chunk of ReferenceColumns; use Materialize on top of it to
+// obtain a small table of values.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+       const size_t k);
+
+  ColumnID column_id() const;
+  OrderByMode order_by_mode() const;
+  size_t k() const;
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::string _cache_key() const override;
+
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  const size_t _k;
+};
+
+}  // namespace opossum
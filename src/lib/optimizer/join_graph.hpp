@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A predicate that a TableScan evaluates on a single column, e.g., l_quantity < 24
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant value;
+};
+
+// A table of a query together with the predicates on its columns
+struct JoinVertex {
+  std::shared_ptr<const Table> table;
+  std::vector<ScanPredicate> predicates;
+};
+
+// An equality predicate between a column of one vertex and a column of another, e.g., l_orderkey = o_orderkey
+struct JoinEdge {
+  size_t left_vertex_id;
+  ColumnID left_column_id;
+  size_t right_vertex_id;
+  ColumnID right_column_id;
+};
+
+/**
+ * JoinGraph describes a query that joins tables by equality predicates and filters them by scan predicates, leaving the
+ * order of the operations to the JoinOrderOptimizer. For example, the tables of TPC-H Q3 are the vertices, each with
+ * its filters, and the predicates c_custkey = o_custkey and l_orderkey = o_orderkey are the edges. The graph needs to
+ * be connected.
+ */
+struct JoinGraph {
+  std::vector<JoinVertex> vertices;
+  std::vector<JoinEdge> edges;
+};
+
+}  // namespace opossum
@@ -0,0 +1,371 @@
+#include "join_order_optimizer.hpp"
+
+// the linter wants this to be above everything else
+#include <optional>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The dynamic programming keeps an entry per subset of vertices
+constexpr size_t MAX_DYNAMIC_PROGRAMMING_VERTEX_COUNT = 20;
+
+constexpr auto NO_NODE = std::numeric_limits<size_t>::max();
+
+// A vertex after its scans or the join of two subplans
+struct PlanNode {
+  double row_count;
+  double cost;
+
+  // only set for joins
+  size_t left_node_id;
+  size_t right_node_id;
+
+  // only set for vertices
+  size_t vertex_id;
+  std::vector<ScanPredicate> predicates;
+};
+
+double estimate_selectivity(const TableStatistics* statistics, const ScanPredicate& predicate) {
+  if (statistics) return statistics->estimate_selectivity(predicate.column_id, predicate.scan_type, predicate.value);
+
+  switch (predicate.scan_type) {
+    case ScanType::OpEquals:
+      return JoinOrderOptimizer::DEFAULT_EQUALS_SELECTIVITY;
+    case ScanType::OpNotEquals:
+      return 1.0 - JoinOrderOptimizer::DEFAULT_EQUALS_SELECTIVITY;
+    case ScanType::OpLike:
+      return TableStatistics::DEFAULT_LIKE_SELECTIVITY;
+    default:
+      return TableStatistics::DEFAULT_RANGE_SELECTIVITY;
+  }
+}
+
+// Orders the scans of the vertex and estimates their output and cost. Without an index, every scan processes the
+// output of the previous one, so the most selective scans come first. A scan answered by a HashIndex only touches the
+// rows that it returns, but only the first scan reads the table, so every scan is tried as the first one.
+PlanNode plan_vertex(const JoinVertex& vertex, const size_t vertex_id) {
+  const auto& table = *vertex.table;
+  const auto statistics = table.table_statistics();
+  const auto row_count = static_cast<double>(table.row_count());
+
+  auto predicates = std::vector<std::pair<double, ScanPredicate>>{};
+  for (const auto& predicate : vertex.predicates) {
+    Assert(predicate.column_id < table.col_count(), "Column does not exist");
+    predicates.emplace_back(estimate_selectivity(statistics.get(), predicate), predicate);
+  }
+  std::stable_sort(predicates.begin(), predicates.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto output_row_count = row_count;
+  for (const auto& predicate : predicates) {
+    output_row_count *= predicate.first;
+  }
+
+  // Scans cost the number of their input and output rows
+  auto best_first_index = size_t{0};
+  auto best_cost = std::numeric_limits<double>::infinity();
+  for (auto first_index = size_t{0}; first_index < predicates.size(); ++first_index) {
+    const auto& [first_selectivity, first_predicate] = predicates[first_index];
+    const auto is_indexed =
+        first_predicate.scan_type == ScanType::OpEquals && table.get_hash_index(first_predicate.column_id);
+    auto input_row_count = row_count * first_selectivity;
+    auto cost = (is_indexed ? input_row_count : row_count) + input_row_count;
+    for (auto index = size_t{0}; index < predicates.size(); ++index) {
+      if (index == first_index) continue;
+      cost += input_row_count + input_row_count * predicates[index].first;
+      input_row_count *= predicates[index].first;
+    }
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_first_index = first_index;
+    }
+  }
+
+  auto node = PlanNode{output_row_count, predicates.empty() ? 0.0 : best_cost, NO_NODE, NO_NODE, vertex_id, {}};
+  if (!predicates.empty()) node.predicates.push_back(predicates[best_first_index].second);
+  for (auto index = size_t{0}; index < predicates.size(); ++index) {
+    if (index != best_first_index) node.predicates.push_back(predicates[index].second);
+  }
+  return node;
+}
+
+// Returns the estimated fraction of the pairs of rows of the two vertices that fulfill the edge
+double estimate_edge_selectivity(const JoinGraph& join_graph, const std::vector<PlanNode>& vertex_nodes,
+                                 const JoinEdge& edge) {
+  const auto distinct_count = [&](const size_t vertex_id, const ColumnID column_id) {
+    const auto& table = *join_graph.vertices[vertex_id].table;
+    const auto statistics = table.table_statistics();
+    const auto table_distinct_count =
+        statistics ? statistics->estimate_distinct_count(column_id) : static_cast<double>(table.row_count());
+    // The scans of the vertex leave at most as many distinct values as rows
+    return std::min(table_distinct_count, vertex_nodes[vertex_id].row_count);
+  };
+
+  return 1.0 / std::max({distinct_count(edge.left_vertex_id, edge.left_column_id),
+                         distinct_count(edge.right_vertex_id, edge.right_column_id), 1.0});
+}
+
+// Returns the root of the cheapest plan that joins all vertices, whose nodes come first in nodes
+size_t optimize_dynamic_programming(const JoinGraph& join_graph, const std::vector<double>& edge_selectivities,
+                                    std::vector<PlanNode>& nodes) {
+  const auto vertex_count = join_graph.vertices.size();
+  const auto set_count = size_t{1} << vertex_count;
+
+  auto neighbors = std::vector<size_t>(vertex_count);
+  for (const auto& edge : join_graph.edges) {
+    neighbors[edge.left_vertex_id] |= size_t{1} << edge.right_vertex_id;
+    neighbors[edge.right_vertex_id] |= size_t{1} << edge.left_vertex_id;
+  }
+
+  // The row count of a set of vertices does not depend on the order in which they are joined. It is derived from the
+  // set without its lowest vertex.
+  auto row_counts = std::vector<double>(set_count, 1.0);
+  auto best_node_ids = std::vector<size_t>(set_count, NO_NODE);
+  for (auto vertex_set = size_t{1}; vertex_set < set_count; ++vertex_set) {
+    const auto vertex_id = static_cast<size_t>(__builtin_ctzll(vertex_set));
+    const auto rest = vertex_set & (vertex_set - 1);
+    row_counts[vertex_set] = row_counts[rest] * nodes[vertex_id].row_count;
+    for (auto edge_id = size_t{0}; edge_id < join_graph.edges.size(); ++edge_id) {
+      const auto& edge = join_graph.edges[edge_id];
+      if ((edge.left_vertex_id == vertex_id && (rest >> edge.right_vertex_id & 1)) ||
+          (edge.right_vertex_id == vertex_id && (rest >> edge.left_vertex_id & 1))) {
+        row_counts[vertex_set] *= edge_selectivities[edge_id];
+      }
+    }
+  }
+
+  for (auto vertex_set = size_t{1}; vertex_set < set_count; ++vertex_set) {
+    if (!(vertex_set & (vertex_set - 1))) {
+      best_node_ids[vertex_set] = static_cast<size_t>(__builtin_ctzll(vertex_set));
+      continue;
+    }
+
+    // Every split into two connected subsets that are connected to each other is considered once, i.e., with the
+    // lowest vertex in the left subset
+    const auto lowest_vertex = vertex_set & (~vertex_set + 1);
+    auto best_cost = std::numeric_limits<double>::infinity();
+    auto best_split = std::pair<size_t, size_t>{NO_NODE, NO_NODE};
+    for (auto left_set = (vertex_set - 1) & vertex_set; left_set > 0; left_set = (left_set - 1) & vertex_set) {
+      if (!(left_set & lowest_vertex)) continue;
+      const auto right_set = vertex_set ^ left_set;
+      const auto left_node_id = best_node_ids[left_set];
+      const auto right_node_id = best_node_ids[right_set];
+      if (left_node_id == NO_NODE || right_node_id == NO_NODE) continue;
+
+      auto left_neighbors = size_t{0};
+      for (auto vertices = left_set; vertices; vertices &= vertices - 1) {
+        left_neighbors |= neighbors[__builtin_ctzll(vertices)];
+      }
+      if (!(left_neighbors & right_set)) continue;
+
+      const auto cost = nodes[left_node_id].cost + nodes[right_node_id].cost + row_counts[left_set] +
+                        row_counts[right_set] + row_counts[vertex_set];
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_split = {left_node_id, right_node_id};
+      }
+    }
+    if (best_split.first == NO_NODE) continue;
+
+    best_node_ids[vertex_set] = nodes.size();
+    nodes.push_back(PlanNode{row_counts[vertex_set], best_cost, best_split.first, best_split.second, 0, {}});
+  }
+
+  Assert(best_node_ids[set_count - 1] != NO_NODE, "The join graph needs to be connected");
+  return best_node_ids[set_count - 1];
+}
+
+// Returns the root of a plan that joins all vertices, whose nodes come first in nodes, by repeatedly joining the two
+// connected subplans whose join yields the fewest rows
+size_t optimize_greedily(const JoinGraph& join_graph, const std::vector<double>& edge_selectivities,
+                         std::vector<PlanNode>& nodes) {
+  const auto vertex_count = join_graph.vertices.size();
+
+  // the root of every subplan and the subplan of every vertex
+  auto subplan_node_ids = std::vector<size_t>(vertex_count);
+  auto vertex_subplans = std::vector<size_t>(vertex_count);
+  for (auto vertex_id = size_t{0}; vertex_id < vertex_count; ++vertex_id) {
+    subplan_node_ids[vertex_id] = vertex_id;
+    vertex_subplans[vertex_id] = vertex_id;
+  }
+
+  while (subplan_node_ids.size() > 1) {
+    // the product of the selectivities of the edges between every pair of subplans
+    auto selectivities = std::map<std::pair<size_t, size_t>, double>{};
+    for (auto edge_id = size_t{0}; edge_id < join_graph.edges.size(); ++edge_id) {
+      const auto& edge = join_graph.edges[edge_id];
+      const auto left_subplan = vertex_subplans[edge.left_vertex_id];
+      const auto right_subplan = vertex_subplans[edge.right_vertex_id];
+      if (left_subplan == right_subplan) continue;
+
+      const auto subplans = std::minmax(left_subplan, right_subplan);
+      const auto iter = selectivities.try_emplace(subplans, 1.0).first;
+      iter->second *= edge_selectivities[edge_id];
+    }
+    Assert(!selectivities.empty(), "The join graph needs to be connected");
+
+    auto best_pair = std::pair<size_t, size_t>{};
+    auto best_row_count = std::numeric_limits<double>::infinity();
+    for (const auto& [subplans, selectivity] : selectivities) {
+      const auto row_count = nodes[subplan_node_ids[subplans.first]].row_count *
+                             nodes[subplan_node_ids[subplans.second]].row_count * selectivity;
+      if (row_count < best_row_count) {
+        best_row_count = row_count;
+        best_pair = subplans;
+      }
+    }
+
+    const auto& left_node = nodes[subplan_node_ids[best_pair.first]];
+    const auto& right_node = nodes[subplan_node_ids[best_pair.second]];
+    const auto cost = left_node.cost + right_node.cost + left_node.row_count + right_node.row_count + best_row_count;
+    nodes.push_back(
+        PlanNode{best_row_count, cost, subplan_node_ids[best_pair.first], subplan_node_ids[best_pair.second], 0, {}});
+
+    // The joined subplans are replaced by their join
+    subplan_node_ids[best_pair.first] = nodes.size() - 1;
+    subplan_node_ids.erase(subplan_node_ids.begin() + best_pair.second);
+    for (auto& subplan : vertex_subplans) {
+      if (subplan == best_pair.second) {
+        subplan = best_pair.first;
+      } else if (subplan > best_pair.second) {
+        --subplan;
+      }
+    }
+  }
+
+  return subplan_node_ids.front();
+}
+
+// Creates the operators of the plan rooted at node_id and appends them to plan.operators. Returns the vertices of the
+// plan in the order of their columns in its output.
+std::vector<size_t> build_operators(const JoinGraph& join_graph, const std::vector<double>& edge_selectivities,
+                                    const std::vector<PlanNode>& nodes, const size_t node_id, JoinPlan& plan) {
+  const auto& node = nodes[node_id];
+  if (node.left_node_id == NO_NODE) {
+    std::shared_ptr<AbstractOperator> op = std::make_shared<TableWrapper>(join_graph.vertices[node.vertex_id].table);
+    plan.operators.push_back(op);
+    for (const auto& predicate : node.predicates) {
+      op = std::make_shared<TableScan>(op, predicate.column_id, predicate.scan_type, predicate.value);
+      plan.operators.push_back(op);
+    }
+    return {node.vertex_id};
+  }
+
+  auto left_vertex_ids = build_operators(join_graph, edge_selectivities, nodes, node.left_node_id, plan);
+  const auto left_op = plan.operators.back();
+  const auto right_vertex_ids = build_operators(join_graph, edge_selectivities, nodes, node.right_node_id, plan);
+  const auto right_op = plan.operators.back();
+
+  // the first column of every vertex in the output of its side, if it is on that side
+  const auto first_column_ids = [&](const std::vector<size_t>& vertex_ids) {
+    auto column_ids = std::vector<std::optional<ColumnID>>(join_graph.vertices.size());
+    auto column_id = ColumnID{0};
+    for (const auto vertex_id : vertex_ids) {
+      column_ids[vertex_id] = column_id;
+      column_id = static_cast<ColumnID>(column_id + join_graph.vertices[vertex_id].table->col_count());
+    }
+    return column_ids;
+  };
+  const auto left_column_ids = first_column_ids(left_vertex_ids);
+  const auto right_column_ids = first_column_ids(right_vertex_ids);
+
+  // The most selective edge is joined by the hash table, so that the fewest matches need to be checked for the others
+  auto column_id_pairs = std::vector<std::pair<double, std::pair<ColumnID, ColumnID>>>{};
+  const auto add_column_id_pair = [&](const size_t edge_id, const size_t left_vertex_id, const ColumnID left_column_id,
+                                      const size_t right_vertex_id, const ColumnID right_column_id) {
+    if (!left_column_ids[left_vertex_id] || !right_column_ids[right_vertex_id]) return;
+    column_id_pairs.push_back({edge_selectivities[edge_id],
+                               {static_cast<ColumnID>(*left_column_ids[left_vertex_id] + left_column_id),
+                                static_cast<ColumnID>(*right_column_ids[right_vertex_id] + right_column_id)}});
+  };
+  for (auto edge_id = size_t{0}; edge_id < join_graph.edges.size(); ++edge_id) {
+    const auto& edge = join_graph.edges[edge_id];
+    add_column_id_pair(edge_id, edge.left_vertex_id, edge.left_column_id, edge.right_vertex_id, edge.right_column_id);
+    add_column_id_pair(edge_id, edge.right_vertex_id, edge.right_column_id, edge.left_vertex_id, edge.left_column_id);
+  }
+  std::stable_sort(column_id_pairs.begin(), column_id_pairs.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto join_column_id_pairs = std::vector<std::pair<ColumnID, ColumnID>>{};
+  for (const auto& column_id_pair : column_id_pairs) {
+    join_column_id_pairs.push_back(column_id_pair.second);
+  }
+  plan.operators.push_back(std::make_shared<JoinHash>(left_op, right_op, join_column_id_pairs));
+
+  left_vertex_ids.insert(left_vertex_ids.end(), right_vertex_ids.begin(), right_vertex_ids.end());
+  return left_vertex_ids;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const Table> JoinPlan::execute() const {
+  for (const auto& op : operators) {
+    op->execute();
+  }
+  return operators.back()->get_output();
+}
+
+JoinOrderOptimizer::JoinOrderOptimizer(const size_t max_dynamic_programming_vertex_count)
+    : _max_dynamic_programming_vertex_count(max_dynamic_programming_vertex_count) {
+  Assert(max_dynamic_programming_vertex_count <= MAX_DYNAMIC_PROGRAMMING_VERTEX_COUNT,
+         "Dynamic programming is limited to " + std::to_string(MAX_DYNAMIC_PROGRAMMING_VERTEX_COUNT) + " vertices");
+}
+
+JoinPlan JoinOrderOptimizer::optimize(const JoinGraph& join_graph) const {
+  const auto vertex_count = join_graph.vertices.size();
+  Assert(vertex_count > 0, "The join graph needs at least one vertex");
+
+  auto nodes = std::vector<PlanNode>{};
+  for (auto vertex_id = size_t{0}; vertex_id < vertex_count; ++vertex_id) {
+    Assert(join_graph.vertices[vertex_id].table, "Every vertex needs a table");
+    nodes.push_back(plan_vertex(join_graph.vertices[vertex_id], vertex_id));
+  }
+
+  auto edge_selectivities = std::vector<double>{};
+  for (const auto& edge : join_graph.edges) {
+    Assert(edge.left_vertex_id < vertex_count && edge.right_vertex_id < vertex_count, "Vertex does not exist");
+    Assert(edge.left_vertex_id != edge.right_vertex_id, "Edges need to connect two different vertices");
+    const auto& left_table = *join_graph.vertices[edge.left_vertex_id].table;
+    const auto& right_table = *join_graph.vertices[edge.right_vertex_id].table;
+    Assert(edge.left_column_id < left_table.col_count() && edge.right_column_id < right_table.col_count(),
+           "Column does not exist");
+    edge_selectivities.push_back(estimate_edge_selectivity(join_graph, nodes, edge));
+  }
+
+  const auto root_node_id = vertex_count <= _max_dynamic_programming_vertex_count
+                                ? optimize_dynamic_programming(join_graph, edge_selectivities, nodes)
+                                : optimize_greedily(join_graph, edge_selectivities, nodes);
+
+  auto plan = JoinPlan{};
+  plan.estimated_row_count = nodes[root_node_id].row_count;
+  plan.estimated_cost = nodes[root_node_id].cost;
+  const auto vertex_ids = build_operators(join_graph, edge_selectivities, nodes, root_node_id, plan);
+
+  plan.first_column_ids.resize(vertex_count);
+  auto column_id = ColumnID{0};
+  for (const auto vertex_id : vertex_ids) {
+    plan.first_column_ids[vertex_id] = column_id;
+    column_id = static_cast<ColumnID>(column_id + join_graph.vertices[vertex_id].table->col_count());
+  }
+  return plan;
+}
+
+}  // namespace opossum
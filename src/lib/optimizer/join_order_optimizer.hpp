@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "join_graph.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// The operators that the JoinOrderOptimizer chose for a JoinGraph
+struct JoinPlan {
+  // the operators in an order in which they can be executed, the last one being the root of the plan
+  std::vector<std::shared_ptr<AbstractOperator>> operators;
+
+  // The output column of the first column of every vertex. The output holds the columns of all vertices, but in the
+  // order in which the vertices are joined.
+  std::vector<ColumnID> first_column_ids;
+
+  double estimated_row_count = 0.0;
+
+  // the estimated number of rows that the operators process and produce, see JoinOrderOptimizer
+  double estimated_cost = 0.0;
+
+  // executes the operators and returns the output of the root
+  std::shared_ptr<const Table> execute() const;
+};
+
+/**
+ * JoinOrderOptimizer chooses the order of the scans and joins of a JoinGraph, based on the cardinalities that the
+ * statistics of the tables (see Table::enable_statistics) estimate.
+ *
+ * The cardinality of a scan is the number of its input rows times the selectivity of its predicate, see
+ * TableStatistics::estimate_selectivity, where predicates are assumed to be independent. The cardinality of a join is
+ * the product of the cardinalities of its inputs divided by the larger number of distinct values of the joined columns
+ * for every edge between them, i.e., every value of the column with fewer distinct values is assumed to find its
+ * partners. Tables without statistics are assumed to hold distinct keys and predicates to have fixed selectivities.
+ *
+ * The cost of a plan is the number of rows that its operators take as input and produce, which is dominated by the
+ * size of the intermediate results, i.e., the position lists of the joins. The scans of every table are executed before
+ * its joins, most selective first, unless another one is answered by a HashIndex (see Table::enable_hash_index), which
+ * only helps if it comes first. Join graphs with up to max_dynamic_programming_vertex_count vertices are optimized by
+ * dynamic programming over all connected subsets of vertices, which finds the cheapest bushy plan in O(3^n). For larger
+ * graphs, the two subplans whose join yields the fewest rows are joined until one plan is left (greedy operator
+ * ordering), in O(n^3).
+ */
+class JoinOrderOptimizer {
+ public:
+  static constexpr size_t DEFAULT_MAX_DYNAMIC_PROGRAMMING_VERTEX_COUNT = 12;
+
+  explicit JoinOrderOptimizer(
+      size_t max_dynamic_programming_vertex_count = DEFAULT_MAX_DYNAMIC_PROGRAMMING_VERTEX_COUNT);
+
+  JoinPlan optimize(const JoinGraph& join_graph) const;
+
+  // used for predicates on tables without statistics
+  static constexpr double DEFAULT_EQUALS_SELECTIVITY = 0.1;
+
+ protected:
+  const size_t _max_dynamic_programming_vertex_count;
+};
+
+}  // namespace opossum
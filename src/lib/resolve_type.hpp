@@ -3,15 +3,18 @@
 #include <boost/hana/equal.hpp>
 #include <boost/hana/for_each.hpp>
 #include <boost/hana/size.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
 
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/dictionary_column.hpp"
 #include "storage/value_column.hpp"
 
 namespace opossum {
@@ -19,60 +22,9 @@ namespace opossum {
 namespace hana = boost::hana;
 
 /**
- * Resolves a type string by creating an instance of a templated class and
- * returning it as a unique_ptr of its non-templated base class.
- *
- * @param type is a string representation of any of the supported column types
- * @param args is a list of constructor arguments
- *
- *
- * Example:
- *
- *   class BaseImpl {
- *    public:
- *     virtual void execute() = 0;
- *   };
- *
- *   template <typename T>
- *   class Impl : public BaseImpl {
- *    public:
- *     Impl(int var) : _var{var} { ... }
- *
- *     void execute() override { ... }
- *   };
- *
- *   constexpr auto var = 12;
- *   auto impl = make_unique_by_column_type<BaseImpl, Impl>("string", var);
- *   impl->execute();
- */
-template <class Base, template <typename...> class Impl, class... TemplateArgs, typename... ConstructorArgs>
-std::unique_ptr<Base> make_unique_by_column_type(const std::string& type, ConstructorArgs&&... args) {
-  std::unique_ptr<Base> ret = nullptr;
-  hana::for_each(column_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type) {
-      // The + before hana::second - which returns a reference - converts its return value
-      // into a value so that we can access ::type
-      using ColumnType = typename decltype(+hana::second(x))::type;
-      ret = std::make_unique<Impl<ColumnType, TemplateArgs...>>(std::forward<ConstructorArgs>(args)...);
-      return;
-    }
-  });
-  DebugAssert(static_cast<bool>(ret), "unknown type " + type);
-  return ret;
-}
-
-/**
- * Convenience function. Calls make_unique_by_column_type and casts the result into a shared_ptr.
- */
-template <class Base, template <typename...> class impl, class... TemplateArgs, class... ConstructorArgs>
-std::shared_ptr<Base> make_shared_by_column_type(const std::string& type, ConstructorArgs&&... args) {
-  return make_unique_by_column_type<Base, impl, TemplateArgs...>(type, std::forward<ConstructorArgs>(args)...);
-}
-
-/**
- * Resolves a type string by passing a hana::type object on to a generic lambda
+ * Resolves a data type by passing a hana::type object on to a generic lambda
  *
- * @param type_string is a string representation of any of the supported column types
+ * @param data_type is any of the supported column types
  * @param func is a generic lambda or similar accepting a hana::type object
  *
  *
@@ -110,7 +62,7 @@ std::shared_ptr<Base> make_shared_by_column_type(const std::string& type, Constr
  *   template <typename T>
  *   process_type(hana::basic_type<T> type);  // note: parameter type needs to be hana::basic_type not hana::type!
  *
- *   resolve_data_type(type_string, [&](auto type) {
+ *   resolve_data_type(data_type, [&](auto type) {
  *     using Type = typename decltype(type)::type;
  *     const auto var = type_cast<Type>(variant_from_elsewhere);
  *     process_variant(var);
@@ -118,14 +70,133 @@ std::shared_ptr<Base> make_shared_by_column_type(const std::string& type, Constr
  *     process_type(type);
  *   });
  */
+#define RESOLVE_DATA_TYPE_CASE(r, func, index, type) \
+  case static_cast<DataType>(index):                 \
+    func(hana::type_c<type>);                        \
+    return;
+
+template <typename Functor>
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  // Expands to one case per entry of COLUMN_TYPES, so that the type is resolved using a single jump
+  switch (data_type) { BOOST_PP_SEQ_FOR_EACH_I(RESOLVE_DATA_TYPE_CASE, func, COLUMN_TYPES) }
+  Fail("Unknown data type");
+}
+
+#undef RESOLVE_DATA_TYPE_CASE
+
+/**
+ * Same as above, but takes the string representation of the type. Prefer the DataType version in hot paths, as this
+ * one needs to compare strings.
+ */
 template <typename Functor>
 void resolve_data_type(const std::string& type_string, const Functor& func) {
-  hana::for_each(column_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type_string) {
-      // The + before hana::second - which returns a reference - converts its return value into a value
-      func(+hana::second(x));
-      return;
+  resolve_data_type(data_type_from_string(type_string), func);
+}
+
+/**
+ * Resolves a data type by creating an instance of a templated class and
+ * returning it as a unique_ptr of its non-templated base class.
+ *
+ * @param data_type is any of the supported column types
+ * @param args is a list of constructor arguments
+ *
+ *
+ * Example:
+ *
+ *   class BaseImpl {
+ *    public:
+ *     virtual void execute() = 0;
+ *   };
+ *
+ *   template <typename T>
+ *   class Impl : public BaseImpl {
+ *    public:
+ *     Impl(int var) : _var{var} { ... }
+ *
+ *     void execute() override { ... }
+ *   };
+ *
+ *   constexpr auto var = 12;
+ *   auto impl = make_unique_by_column_type<BaseImpl, Impl>(DataType::String, var);
+ *   impl->execute();
+ */
+template <class Base, template <typename...> class Impl, class... TemplateArgs, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_by_column_type(const DataType data_type, ConstructorArgs&&... args) {
+  std::unique_ptr<Base> ret = nullptr;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnType = typename decltype(type)::type;
+    ret = std::make_unique<Impl<ColumnType, TemplateArgs...>>(std::forward<ConstructorArgs>(args)...);
+  });
+  return ret;
+}
+
+/**
+ * Same as above, but takes the string representation of the type. Prefer the DataType version in hot paths, as this
+ * one needs to compare strings.
+ */
+template <class Base, template <typename...> class Impl, class... TemplateArgs, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_by_column_type(const std::string& type, ConstructorArgs&&... args) {
+  return make_unique_by_column_type<Base, Impl, TemplateArgs...>(data_type_from_string(type),
+                                                                  std::forward<ConstructorArgs>(args)...);
+}
+
+/**
+ * Convenience function. Calls make_unique_by_column_type and casts the result into a shared_ptr.
+ */
+template <class Base, template <typename...> class impl, class... TemplateArgs, class TypeOrString,
+          class... ConstructorArgs>
+std::shared_ptr<Base> make_shared_by_column_type(const TypeOrString& type, ConstructorArgs&&... args) {
+  return make_unique_by_column_type<Base, impl, TemplateArgs...>(type, std::forward<ConstructorArgs>(args)...);
+}
+
+namespace detail {
+
+template <typename Column>
+struct is_dictionary_column_impl : std::false_type {};
+
+template <typename T>
+struct is_dictionary_column_impl<DictionaryColumn<T>> : std::true_type {};
+
+}  // namespace detail
+
+// Tells the column classes that resolve_column_type passes on apart, also if they are qualified, e.g., const Column&
+template <typename Column>
+struct is_dictionary_column : detail::is_dictionary_column_impl<std::decay_t<Column>> {};
+
+/**
+ * Resolves the type of a column by passing a hana::type object and the column, cast to its concrete class (ValueColumn
+ * or DictionaryColumn), on to a generic lambda. The lambda is instantiated for every column type and encoding, so it
+ * should be kept small or call other templated functions.
+ *
+ * Example:
+ *
+ *   resolve_column_type(*column, [&](auto type, const auto& typed_column) {
+ *     using Type = typename decltype(type)::type;
+ *     if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+ *       const auto& dictionary = typed_column.dictionary();  // const pmr_vector<Type>&
+ *       ...
+ *     } else {
+ *       const auto& values = typed_column.values();  // const pmr_vector<Type>&
+ *       ...
+ *     }
+ *   });
+ */
+template <typename Functor>
+void resolve_column_type(const BaseColumn& column, const Functor& func) {
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (column.encoding_type()) {
+      case EncodingType::Unencoded:
+        func(type, static_cast<const ValueColumn<ColumnDataType>&>(column));
+        return;
+      case EncodingType::Dictionary:
+        func(type, static_cast<const DictionaryColumn<ColumnDataType>&>(column));
+        return;
+      case EncodingType::Reference:
+        Fail("ReferenceColumns cannot be resolved, materialize them first (see Materialize)");
     }
+    Fail("Unknown encoding type");
   });
 }
 
@@ -0,0 +1,50 @@
+#include "chunk_statistics.hpp"
+
+#include <memory>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+std::shared_ptr<ChunkStatistics> ChunkStatistics::build(const Chunk& chunk) {
+  auto chunk_statistics = std::make_shared<ChunkStatistics>();
+  chunk_statistics->_row_count = chunk.size();
+  chunk_statistics->_distinct_values.resize(chunk.col_count());
+  for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+    auto& distinct_values = chunk_statistics->_distinct_values[column_id];
+    resolve_column_type(*chunk.get_column(column_id), [&](auto, const auto& typed_column) {
+      // The dictionary holds every distinct value once
+      if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+        for (const auto& value : typed_column.dictionary()) {
+          distinct_values.insert(value);
+        }
+      } else {
+        for (const auto& value : typed_column.values()) {
+          distinct_values.insert(value);
+        }
+      }
+    });
+  }
+  return chunk_statistics;
+}
+
+uint32_t ChunkStatistics::row_count() const { return _row_count; }
+
+const HyperLogLog& ChunkStatistics::distinct_values(const ColumnID column_id) const {
+  return _distinct_values.at(column_id);
+}
+
+double ChunkStatistics::estimate_distinct_count(const ColumnID column_id) const {
+  return distinct_values(column_id).estimate();
+}
+
+size_t ChunkStatistics::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  for (const auto& distinct_values : _distinct_values) {
+    bytes += distinct_values.estimate_memory_usage();
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// The statistics of a sealed chunk: a HyperLogLog of every column, which TableStatistics merge. Tables build them when
+// they seal chunks if statistics are enabled, see Table::enable_statistics.
+class ChunkStatistics : private Noncopyable {
+ public:
+  // builds the statistics of the chunk, whose columns need to be ValueColumns or DictionaryColumns
+  static std::shared_ptr<ChunkStatistics> build(const Chunk& chunk);
+
+  uint32_t row_count() const;
+
+  const HyperLogLog& distinct_values(ColumnID column_id) const;
+
+  // returns the estimated number of distinct values of the column
+  double estimate_distinct_count(ColumnID column_id) const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  uint32_t _row_count = 0;
+  std::vector<HyperLogLog> _distinct_values;
+};
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#include "count_min_sketch.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CountMinSketch::CountMinSketch(const size_t width, const size_t depth) : _width(width), _depth(depth) {
+  Assert(width > 0 && (width & (width - 1)) == 0, "Width needs to be a power of two");
+  Assert(depth > 0, "Depth needs to be positive");
+  _counters.resize(width * depth);
+}
+
+uint64_t CountMinSketch::estimate_hash(const uint64_t hash) const {
+  auto estimate = std::numeric_limits<uint64_t>::max();
+  for (auto row = size_t{0}; row < _depth; ++row) {
+    estimate = std::min(estimate, _counters[_counter_index(hash, row)]);
+  }
+  return estimate;
+}
+
+void CountMinSketch::merge(const CountMinSketch& other) {
+  Assert(other._width == _width && other._depth == _depth, "Only sketches with the same dimensions can be merged");
+  for (auto counter_index = size_t{0}; counter_index < _counters.size(); ++counter_index) {
+    _counters[counter_index] += other._counters[counter_index];
+  }
+  _total_count += other._total_count;
+}
+
+uint64_t CountMinSketch::total_count() const { return _total_count; }
+
+size_t CountMinSketch::estimate_memory_usage() const {
+  return sizeof(*this) + _counters.capacity() * sizeof(uint64_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/bloom_filter.hpp"
+
+namespace opossum {
+
+/**
+ * CountMinSketch estimates how often values occur in a multiset (Cormode and Muthukrishnan, 2005). It consists of depth
+ * rows of width counters, and inserting a value increments one counter per row, which the value's hash selects. The
+ * estimate is the minimum of these counters: it is never too small, and with a probability of 1 - e^-depth, it is too
+ * large by at most e / width times the number of inserted values. With the defaults, that is 0.13% of the rows with a
+ * probability of 98%, at 64 KB. Frequent values, i.e., heavy hitters, are thus estimated precisely relative to their
+ * count, while the estimates of rare values are dominated by the error.
+ *
+ * Sketches with the same dimensions can be merged by adding their counters. Values are hashed with
+ * BloomFilter::hash_value, i.e., according to their type, and the counters of a value are derived from a single hash.
+ */
+class CountMinSketch {
+ public:
+  static constexpr size_t DEFAULT_WIDTH = 2048;
+  static constexpr size_t DEFAULT_DEPTH = 4;
+
+  // width needs to be a power of two
+  explicit CountMinSketch(size_t width = DEFAULT_WIDTH, size_t depth = DEFAULT_DEPTH);
+
+  template <typename T>
+  void insert(const T& value, const uint64_t count = 1) {
+    insert_hash(BloomFilter::hash_value(value), count);
+  }
+
+  void insert_hash(const uint64_t hash, const uint64_t count = 1) {
+    for (auto row = size_t{0}; row < _depth; ++row) {
+      _counters[_counter_index(hash, row)] += count;
+    }
+    _total_count += count;
+  }
+
+  // returns an estimate of how often the value has been inserted, which is never too small
+  template <typename T>
+  uint64_t estimate(const T& value) const {
+    return estimate_hash(BloomFilter::hash_value(value));
+  }
+
+  uint64_t estimate_hash(uint64_t hash) const;
+
+  // adds the values of other, which needs to have the same dimensions, to this sketch
+  void merge(const CountMinSketch& other);
+
+  // returns the number of inserted values, i.e., the sum of their counts
+  uint64_t total_count() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // The rows use the hashes h1 + row * h2 derived from the two halves of the hash (Kirsch and Mitzenmacher, 2006)
+  size_t _counter_index(const uint64_t hash, const size_t row) const {
+    const auto row_hash = static_cast<uint32_t>(hash) + row * ((hash >> 32) | 1);
+    return row * _width + (row_hash & (_width - 1));
+  }
+
+  size_t _width;
+  size_t _depth;
+  std::vector<uint64_t> _counters;
+  uint64_t _total_count = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,179 @@
+#include "equi_height_histogram.hpp"
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of bytes after the common prefix of the bounds by which strings are positioned within a bin
+constexpr size_t STRING_POSITION_BYTES = 6;
+
+// Maps the bytes of value after offset to a number, so that strings with a common prefix can be interpolated
+double string_to_number(const std::string& value, const size_t offset) {
+  auto number = 0.0;
+  for (auto index = offset; index < offset + STRING_POSITION_BYTES; ++index) {
+    number = number * 256 + (index < value.size() ? static_cast<unsigned char>(value[index]) : 0);
+  }
+  return number;
+}
+
+// Returns where value lies between lower and upper, which are different, as a fraction in [0, 1]
+template <typename T>
+double interpolate(const T& lower, const T& upper, const T& value) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(lower.begin(), lower.end(), upper.begin(), upper.end()).first - lower.begin());
+    const auto lower_number = string_to_number(lower, prefix_length);
+    const auto upper_number = string_to_number(upper, prefix_length);
+    // value is in [lower, upper], so it shares their common prefix
+    const auto value_number = string_to_number(value, prefix_length);
+    if (upper_number <= lower_number) return 0.5;
+    return std::clamp((value_number - lower_number) / (upper_number - lower_number), 0.0, 1.0);
+  } else {
+    return std::clamp((static_cast<double>(value) - static_cast<double>(lower)) /
+                          (static_cast<double>(upper) - static_cast<double>(lower)),
+                      0.0, 1.0);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+EquiHeightHistogram<T>::EquiHeightHistogram(std::vector<T> sample, const double distinct_count,
+                                            const size_t max_bin_count) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin");
+  if (sample.empty()) return;
+
+  std::sort(sample.begin(), sample.end());
+  const auto sample_size = sample.size();
+  const auto bin_height = (sample_size + max_bin_count - 1) / max_bin_count;
+
+  auto sample_distinct_count = 0.0;
+  for (auto bin_begin = size_t{0}; bin_begin < sample_size;) {
+    // Equal values belong to the same bin, which thus may hold more than bin_height values
+    auto bin_end = std::min(bin_begin + bin_height, sample_size);
+    bin_end = static_cast<size_t>(std::upper_bound(sample.begin() + bin_end - 1, sample.end(), sample[bin_end - 1]) -
+                                  sample.begin());
+
+    _lower_bounds.push_back(sample[bin_begin]);
+    _upper_bounds.push_back(sample[bin_end - 1]);
+    _cumulative_fractions.push_back(static_cast<double>(bin_end) / sample_size);
+    const auto bin_distinct_count =
+        std::unique(sample.begin() + bin_begin, sample.begin() + bin_end) - (sample.begin() + bin_begin);
+    _distinct_counts.push_back(static_cast<double>(bin_distinct_count));
+    sample_distinct_count += bin_distinct_count;
+    bin_begin = bin_end;
+  }
+
+  const auto scale = std::max(1.0, distinct_count / sample_distinct_count);
+  for (auto& bin_distinct_count : _distinct_counts) {
+    bin_distinct_count *= scale;
+  }
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& value) const {
+  return estimate_selectivity(scan_type, type_cast<T>(value));
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::estimate_selectivity(const ScanType scan_type, const T& value) const {
+  if (_lower_bounds.empty()) return 0.0;
+
+  const auto bin_id = _bin_id(value);
+  const auto equal_fraction = _estimate_equal_fraction(value, bin_id);
+  const auto less_fraction = _estimate_less_fraction(value, bin_id, equal_fraction);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return equal_fraction;
+    case ScanType::OpNotEquals:
+      return 1.0 - equal_fraction;
+    case ScanType::OpLessThan:
+      return less_fraction;
+    case ScanType::OpLessThanEquals:
+      return less_fraction + equal_fraction;
+    case ScanType::OpGreaterThan:
+      return 1.0 - less_fraction - equal_fraction;
+    case ScanType::OpGreaterThanEquals:
+      return 1.0 - less_fraction;
+    case ScanType::OpLike:
+      break;
+  }
+  Fail("Histograms do not support this scan type");
+  return 0.0;
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::bin_count() const {
+  return _lower_bounds.size();
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + (_lower_bounds.capacity() + _upper_bounds.capacity()) * sizeof(T) +
+               (_cumulative_fractions.capacity() + _distinct_counts.capacity()) * sizeof(double);
+  if constexpr (std::is_same<T, std::string>::value) {
+    for (const auto& bounds : {&_lower_bounds, &_upper_bounds}) {
+      for (const auto& bound : *bounds) {
+        if (bound.capacity() > std::string{}.capacity()) bytes += bound.capacity() + 1;
+      }
+    }
+  }
+  return bytes;
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::min() const {
+  Assert(!_lower_bounds.empty(), "The histogram is empty");
+  return _lower_bounds.front();
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::max() const {
+  Assert(!_upper_bounds.empty(), "The histogram is empty");
+  return _upper_bounds.back();
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_equal_fraction(const T& value, const size_t bin_id) const {
+  if (bin_id == bin_count() || value < _lower_bounds[bin_id]) return 0.0;
+
+  const auto bin_fraction = _cumulative_fractions[bin_id] - (bin_id > 0 ? _cumulative_fractions[bin_id - 1] : 0.0);
+  return bin_fraction / _distinct_counts[bin_id];
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_less_fraction(const T& value, const size_t bin_id,
+                                                       const double equal_fraction) const {
+  if (bin_id == bin_count()) return 1.0;
+
+  const auto fraction_before = bin_id > 0 ? _cumulative_fractions[bin_id - 1] : 0.0;
+  const auto& lower_bound = _lower_bounds[bin_id];
+  const auto& upper_bound = _upper_bounds[bin_id];
+  if (!(lower_bound < value)) return fraction_before;
+
+  // The values equal to value, which is at most the upper bound, are not less than it
+  const auto bin_fraction = _cumulative_fractions[bin_id] - fraction_before;
+  const auto position = interpolate(lower_bound, upper_bound, value);
+  return fraction_before + std::min(bin_fraction * position, bin_fraction - equal_fraction);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::_bin_id(const T& value) const {
+  return static_cast<size_t>(std::lower_bound(_upper_bounds.begin(), _upper_bounds.end(), value) -
+                             _upper_bounds.begin());
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(EquiHeightHistogram);
+
+}  // namespace opossum
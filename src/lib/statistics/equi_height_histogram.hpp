@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseHistogram is the type-independent interface of EquiHeightHistogram, through which TableStatistics use them
+class BaseHistogram : private Noncopyable {
+ public:
+  virtual ~BaseHistogram() = default;
+
+  // Returns the estimated fraction of rows whose value fulfills the predicate, where value is converted to the type of
+  // the column. OpLike is not supported.
+  virtual double estimate_selectivity(ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  virtual size_t bin_count() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+/**
+ * EquiHeightHistogram summarizes the distribution of a column's values by bins that hold about the same number of
+ * values each, so that frequent values get narrow bins and skewed distributions are captured where it matters. It is
+ * built from a sample of the values (see TableStatistics::build_histograms): the sorted sample is cut into
+ * max_bin_count bins, where equal values are never split across bins. Every bin keeps its bounds, the fraction of the
+ * values that it holds, and the number of distinct values in it.
+ *
+ * Within a bin, values are assumed to be spread uniformly between the bounds, i.e., range predicates interpolate
+ * linearly, and every distinct value is assumed to occur equally often. The distinct values of the sample are scaled
+ * to the estimated distinct count of the whole column, as a sample misses most of the rare values.
+ */
+template <typename T>
+class EquiHeightHistogram : public BaseHistogram {
+ public:
+  static constexpr size_t DEFAULT_BIN_COUNT = 64;
+
+  EquiHeightHistogram(std::vector<T> sample, double distinct_count, size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  double estimate_selectivity(ScanType scan_type, const AllTypeVariant& value) const override;
+  double estimate_selectivity(ScanType scan_type, const T& value) const;
+
+  size_t bin_count() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  const T& min() const;
+  const T& max() const;
+
+ protected:
+  // returns the estimated fractions of values that are equal to and less than value
+  double _estimate_equal_fraction(const T& value, size_t bin_id) const;
+  double _estimate_less_fraction(const T& value, size_t bin_id, double equal_fraction) const;
+
+  // returns the first bin whose upper bound is not less than value, or bin_count() if there is none
+  size_t _bin_id(const T& value) const;
+
+  std::vector<T> _lower_bounds;
+  std::vector<T> _upper_bounds;
+
+  // the fraction of the values in the bin and all before it
+  std::vector<double> _cumulative_fractions;
+
+  std::vector<double> _distinct_counts;
+};
+
+}  // namespace opossum
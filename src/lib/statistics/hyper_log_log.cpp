@@ -0,0 +1,45 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision(precision) {
+  Assert(precision >= 4 && precision <= 18, "Precision needs to be in [4, 18]");
+  _registers.resize(size_t{1} << precision);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(other._precision == _precision, "Only sketches with the same precision can be merged");
+  for (auto register_index = size_t{0}; register_index < _registers.size(); ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    if (rank == 0) ++empty_register_count;
+  }
+
+  // The bias correction for 2^precision >= 128 registers, which is close enough for the smaller ones (see the paper)
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+  if (raw_estimate <= 2.5 * register_count && empty_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(empty_register_count));
+  }
+  // As hashes have 64 bits, collisions do not need to be corrected for
+  return raw_estimate;
+}
+
+uint8_t HyperLogLog::precision() const { return _precision; }
+
+size_t HyperLogLog::estimate_memory_usage() const { return sizeof(*this) + _registers.capacity(); }
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/bloom_filter.hpp"
+
+namespace opossum {
+
+/**
+ * HyperLogLog estimates the number of distinct values of a multiset in constant space (Flajolet et al., 2007). The
+ * first bits of a value's hash select one of 2^precision registers, which keeps the maximum number of leading zeros
+ * (plus one) seen in the remaining bits. The harmonic mean of the registers yields the estimate, whose standard error
+ * is 1.04 / sqrt(2^precision), i.e., about 1.6% for the default precision at 4 KB. Small cardinalities, for which many
+ * registers are still empty, are estimated by linear counting instead.
+ *
+ * Sketches with the same precision can be merged, which yields the sketch of the union of their values. Hence, chunks
+ * keep a sketch per column (see ChunkStatistics) that TableStatistics merge. Values are hashed with
+ * BloomFilter::hash_value, i.e., according to their type.
+ */
+class HyperLogLog {
+ public:
+  static constexpr uint8_t DEFAULT_PRECISION = 12;
+
+  explicit HyperLogLog(uint8_t precision = DEFAULT_PRECISION);
+
+  template <typename T>
+  void insert(const T& value) {
+    insert_hash(BloomFilter::hash_value(value));
+  }
+
+  void insert_hash(const uint64_t hash) {
+    // The guard bit limits the number of leading zeros to the bits that do not select the register
+    const auto register_index = hash >> (64 - _precision);
+    const auto rank_bits = (hash << _precision) | (uint64_t{1} << (_precision - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(rank_bits) + 1);
+    if (rank > _registers[register_index]) _registers[register_index] = rank;
+  }
+
+  // adds the values of other, which needs to have the same precision, to this sketch
+  void merge(const HyperLogLog& other);
+
+  // returns the estimated number of distinct values that have been inserted
+  double estimate() const;
+
+  uint8_t precision() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  uint8_t _precision;
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
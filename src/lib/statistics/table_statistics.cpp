@@ -0,0 +1,181 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "chunk_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Returns the sketch for modification, which is copied first if other copies of the statistics hold it
+template <typename Sketch>
+Sketch& unshared_sketch(std::shared_ptr<Sketch>& sketch) {
+  if (sketch.use_count() > 1) sketch = std::make_shared<Sketch>(*sketch);
+  return *sketch;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const std::vector<DataType>& column_data_types)
+    : _column_data_types(column_data_types), _histograms(column_data_types.size()) {
+  _distinct_values.reserve(col_count());
+  _value_counts.reserve(col_count());
+  for (auto column_id = ColumnID{0}; column_id < col_count(); ++column_id) {
+    _distinct_values.push_back(std::make_shared<HyperLogLog>());
+    _value_counts.push_back(std::make_shared<CountMinSketch>());
+  }
+}
+
+void TableStatistics::add_chunk(const Chunk& chunk, const ChunkStatistics& chunk_statistics) {
+  Assert(chunk.col_count() == col_count(), "Chunk does not match the columns of the statistics");
+  _row_count += chunk.size();
+
+  for (auto column_id = ColumnID{0}; column_id < col_count(); ++column_id) {
+    unshared_sketch(_distinct_values[column_id]).merge(chunk_statistics.distinct_values(column_id));
+
+    auto& value_counts = unshared_sketch(_value_counts[column_id]);
+    resolve_column_type(*chunk.get_column(column_id), [&](auto, const auto& typed_column) {
+      if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+        // The value ids are counted, so that every distinct value is hashed once
+        auto counts = std::vector<uint64_t>(typed_column.unique_values_count());
+        resolve_attribute_vector(typed_column.attribute_vector(), [&](const auto& attribute_vector) {
+          for (const auto value_id : attribute_vector.value_ids()) {
+            ++counts[value_id];
+          }
+        });
+        const auto& dictionary = typed_column.dictionary();
+        for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+          value_counts.insert(dictionary[value_id], counts[value_id]);
+        }
+      } else {
+        for (const auto& value : typed_column.values()) {
+          value_counts.insert(value);
+        }
+      }
+    });
+  }
+}
+
+uint64_t TableStatistics::row_count() const { return _row_count; }
+
+uint16_t TableStatistics::col_count() const { return static_cast<uint16_t>(_column_data_types.size()); }
+
+const HyperLogLog& TableStatistics::distinct_values(const ColumnID column_id) const {
+  return *_distinct_values.at(column_id);
+}
+
+const CountMinSketch& TableStatistics::value_counts(const ColumnID column_id) const {
+  return *_value_counts.at(column_id);
+}
+
+double TableStatistics::estimate_distinct_count(const ColumnID column_id) const {
+  return std::min(distinct_values(column_id).estimate(), static_cast<double>(_row_count));
+}
+
+uint64_t TableStatistics::estimate_count(const ColumnID column_id, const AllTypeVariant& value) const {
+  auto count = uint64_t{0};
+  resolve_data_type(_column_data_types.at(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    count = value_counts(column_id).estimate(type_cast<ColumnDataType>(value));
+  });
+  return count;
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                            const AllTypeVariant& value) const {
+  if (_row_count == 0) return 0.0;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals: {
+      // Unlike the histogram, which only knows the values of its sample, the sketch has seen every row
+      const auto equal_selectivity =
+          std::min(1.0, static_cast<double>(estimate_count(column_id, value)) / static_cast<double>(_row_count));
+      return scan_type == ScanType::OpEquals ? equal_selectivity : 1.0 - equal_selectivity;
+    }
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals: {
+      const auto& histogram = _histograms.at(column_id);
+      return histogram ? histogram->estimate_selectivity(scan_type, value) : DEFAULT_RANGE_SELECTIVITY;
+    }
+    case ScanType::OpLike:
+      return DEFAULT_LIKE_SELECTIVITY;
+  }
+  Fail("Unknown scan type");
+  return 0.0;
+}
+
+void TableStatistics::build_histograms(const Table& table) {
+  auto covered_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (table.get_chunk(chunk_id).get_statistics()) covered_chunk_ids.push_back(chunk_id);
+  }
+  if (covered_chunk_ids.empty()) return;
+
+  // The sampled chunks are spread over the table, so that the sample is not biased towards old or new rows
+  const auto sampled_chunk_count = std::min(covered_chunk_ids.size(), HISTOGRAM_SAMPLE_CHUNK_COUNT);
+  const auto sample_size_per_chunk = HISTOGRAM_SAMPLE_SIZE / sampled_chunk_count;
+  for (auto column_id = ColumnID{0}; column_id < col_count(); ++column_id) {
+    resolve_data_type(_column_data_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto sample = std::vector<ColumnDataType>{};
+      sample.reserve(HISTOGRAM_SAMPLE_SIZE);
+      for (auto index = size_t{0}; index < sampled_chunk_count; ++index) {
+        const auto& chunk = table.get_chunk(covered_chunk_ids[index * covered_chunk_ids.size() / sampled_chunk_count]);
+        const auto column = chunk.get_column(column_id);
+        const auto stride = std::max(size_t{1}, column->size() / sample_size_per_chunk);
+        if (column->encoding_type() == EncodingType::Dictionary) {
+          const auto& dictionary_column = static_cast<const DictionaryColumn<ColumnDataType>&>(*column);
+          const auto& dictionary = dictionary_column.dictionary();
+          resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+            const auto& value_ids = attribute_vector.value_ids();
+            for (auto chunk_offset = size_t{0}; chunk_offset < value_ids.size(); chunk_offset += stride) {
+              sample.push_back(dictionary[value_ids[chunk_offset]]);
+            }
+          });
+        } else {
+          const auto& values = static_cast<const ValueColumn<ColumnDataType>&>(*column).values();
+          for (auto chunk_offset = size_t{0}; chunk_offset < values.size(); chunk_offset += stride) {
+            sample.push_back(values[chunk_offset]);
+          }
+        }
+      }
+
+      _histograms[column_id] =
+          std::make_shared<EquiHeightHistogram<ColumnDataType>>(std::move(sample), estimate_distinct_count(column_id));
+    });
+  }
+  _histogram_row_count = _row_count;
+}
+
+std::shared_ptr<const BaseHistogram> TableStatistics::histogram(const ColumnID column_id) const {
+  return _histograms.at(column_id);
+}
+
+uint64_t TableStatistics::histogram_row_count() const { return _histogram_row_count; }
+
+size_t TableStatistics::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _column_data_types.capacity() * sizeof(DataType);
+  for (auto column_id = ColumnID{0}; column_id < col_count(); ++column_id) {
+    bytes += _distinct_values[column_id]->estimate_memory_usage() + _value_counts[column_id]->estimate_memory_usage();
+    if (_histograms[column_id]) bytes += _histograms[column_id]->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "count_min_sketch.hpp"
+#include "equi_height_histogram.hpp"
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class ChunkStatistics;
+class Table;
+
+/**
+ * TableStatistics summarize the values of a table's columns for query planning and approximate queries: a HyperLogLog
+ * per column, which is merged from those of the chunks (see ChunkStatistics), estimates the number of distinct values,
+ * and a CountMinSketch per column estimates how often a value occurs. Both answer in time independent of the number of
+ * rows. Tables maintain their statistics as they seal chunks, see Table::enable_statistics.
+ *
+ * Chunks only keep HyperLogLogs, as a CountMinSketch of a chunk would be as large as that of the table. Instead, the
+ * values of a chunk are counted into the table's sketches when the chunk is added.
+ *
+ * For range predicates, an EquiHeightHistogram per column is built from a sample of the chunks, which is rebuilt
+ * whenever the table has doubled in size since (see Table::seal_last_chunk). Together, these answer the selectivity of
+ * predicates, from which the JoinOrderOptimizer estimates the cardinality of plans.
+ *
+ * Copies of the statistics share the sketches and histograms of the columns. A sketch is only copied when it is
+ * modified while another copy holds it (copy-on-write), so that a table can replace its statistics when it seals a
+ * chunk without copying sketches that no reader holds.
+ */
+class TableStatistics {
+ public:
+  explicit TableStatistics(const std::vector<DataType>& column_data_types);
+
+  // adds the rows of the chunk, whose columns need to be ValueColumns or DictionaryColumns, given its statistics
+  void add_chunk(const Chunk& chunk, const ChunkStatistics& chunk_statistics);
+
+  uint64_t row_count() const;
+
+  uint16_t col_count() const;
+
+  const HyperLogLog& distinct_values(ColumnID column_id) const;
+  const CountMinSketch& value_counts(ColumnID column_id) const;
+
+  // returns the estimated number of distinct values of the column, which is at most the number of rows
+  double estimate_distinct_count(ColumnID column_id) const;
+
+  // returns an estimate of how often the value, which is converted to the column's type, occurs in the column. The
+  // estimate is never too small, see CountMinSketch.
+  uint64_t estimate_count(ColumnID column_id, const AllTypeVariant& value) const;
+
+  // Returns the estimated fraction of rows that fulfill the predicate. OpEquals and OpNotEquals use the CountMinSketch,
+  // the other comparisons use the histogram, and OpLike as well as predicates on columns without a histogram fall back
+  // to fixed selectivities.
+  double estimate_selectivity(ColumnID column_id, ScanType scan_type, const AllTypeVariant& value) const;
+
+  // (Re)builds the histograms from a sample of up to HISTOGRAM_SAMPLE_SIZE values, which are taken evenly from up to
+  // HISTOGRAM_SAMPLE_CHUNK_COUNT of the chunks that have statistics (see Chunk::get_statistics)
+  void build_histograms(const Table& table);
+
+  // returns the histogram of the column, or nullptr if none has been built
+  std::shared_ptr<const BaseHistogram> histogram(ColumnID column_id) const;
+
+  // returns the number of rows when the histograms were built
+  uint64_t histogram_row_count() const;
+
+  size_t estimate_memory_usage() const;
+
+  static constexpr size_t HISTOGRAM_SAMPLE_CHUNK_COUNT = 16;
+  static constexpr size_t HISTOGRAM_SAMPLE_SIZE = 65'536;
+
+  // used for predicates that the statistics cannot estimate
+  static constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3;
+  static constexpr double DEFAULT_LIKE_SELECTIVITY = 0.1;
+
+ protected:
+  std::vector<DataType> _column_data_types;
+  uint64_t _row_count = 0;
+  // Shared by copies of the statistics, see add_chunk. Only modified while no other copy holds them.
+  std::vector<std::shared_ptr<HyperLogLog>> _distinct_values;
+  std::vector<std::shared_ptr<CountMinSketch>> _value_counts;
+
+  // histograms are immutable, so that copies of the statistics share them
+  std::vector<std::shared_ptr<const BaseHistogram>> _histograms;
+  uint64_t _histogram_row_count = 0;
+};
+
+}  // namespace opossum
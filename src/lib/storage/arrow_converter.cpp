@@ -0,0 +1,281 @@
+#include "arrow_converter.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+#include "utils/aligned_memory_resource.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+const char* arrow_format() {
+  if constexpr (std::is_same<T, int32_t>::value) {
+    return "i";
+  } else if constexpr (std::is_same<T, int64_t>::value) {  // NOLINT
+    return "l";
+  } else if constexpr (std::is_same<T, float>::value) {  // NOLINT
+    return "f";
+  } else if constexpr (std::is_same<T, double>::value) {  // NOLINT
+    return "g";
+  } else {
+    static_assert(std::is_same<T, std::string>::value, "Unsupported type");
+    return "u";
+  }
+}
+
+DataType data_type_from_arrow_format(const std::string& format) {
+  if (format == "i") return DataType::Int;
+  if (format == "l") return DataType::Long;
+  if (format == "f") return DataType::Float;
+  if (format == "g") return DataType::Double;
+  if (format == "u") return DataType::String;
+  Fail("Unsupported Arrow type " + format);
+  return DataType::Int;
+}
+
+// Owned by an exported schema, which points to the strings. Releases the children that have been exported.
+struct ExportedSchema : private Noncopyable {
+  ~ExportedSchema() {
+    for (auto& child : children) {
+      if (child.release) child.release(&child);
+    }
+  }
+
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+void release_schema(ArrowSchema* schema) {
+  // takes back the ownership that the export passed on to private_data
+  const auto exported_schema = std::unique_ptr<ExportedSchema>{static_cast<ExportedSchema*>(schema->private_data)};
+  schema->release = nullptr;
+}
+
+// Owned by an exported array, which points to its buffers. These are either owned by the column or by the array itself.
+// Releases the children that have been exported.
+struct ExportedArray : private Noncopyable {
+  ~ExportedArray() {
+    for (auto& child : children) {
+      if (child.release) child.release(&child);
+    }
+  }
+
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_pointers;
+
+  std::shared_ptr<const BaseColumn> column;
+  pmr_vector<int32_t> offsets{PolymorphicAllocator<int32_t>{&AlignedMemoryResource::cache_line_aligned_resource()}};
+  pmr_vector<char> characters{PolymorphicAllocator<char>{&AlignedMemoryResource::cache_line_aligned_resource()}};
+};
+
+void release_array(ArrowArray* array) {
+  // takes back the ownership that the export passed on to private_data
+  const auto exported_array = std::unique_ptr<ExportedArray>{static_cast<ExportedArray*>(array->private_data)};
+  array->release = nullptr;
+}
+
+// Data buffers must not be null, not even for empty arrays
+alignas(CACHE_LINE_SIZE) const int64_t EMPTY_BUFFER[1] = {0};
+
+void export_column(const std::shared_ptr<const BaseColumn>& encoded_column, ArrowArray* array) {
+  Assert(encoded_column->encoding_type() != EncodingType::Reference, "ReferenceColumns cannot be exported");
+  auto exported_array = std::make_unique<ExportedArray>();
+  exported_array->buffers.push_back(nullptr);
+
+  // DictionaryColumns are exported with their decoded values, as the importer does not support dictionary arrays
+  const auto column = decode_dictionary_column(encoded_column);
+  resolve_data_type(column->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& values = static_cast<const ValueColumn<ColumnDataType>&>(*column).values();
+
+    if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+      auto& offsets = exported_array->offsets;
+      offsets.reserve(values.size() + 1);
+      offsets.push_back(0);
+      auto character_count = size_t{0};
+      for (const auto& value : values) {
+        character_count += value.size();
+        Assert(character_count <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+               "utf8 arrays cannot hold more than 2 GiB of characters");
+        offsets.push_back(static_cast<int32_t>(character_count));
+      }
+
+      auto& characters = exported_array->characters;
+      characters.reserve(std::max(character_count, size_t{1}));
+      for (const auto& value : values) {
+        characters.insert(characters.end(), value.cbegin(), value.cend());
+      }
+
+      exported_array->buffers.push_back(offsets.data());
+      exported_array->buffers.push_back(characters.data());
+    } else {
+      exported_array->column = column;
+      exported_array->buffers.push_back(values.empty() ? static_cast<const void*>(EMPTY_BUFFER) : values.data());
+    }
+  });
+
+  *array = ArrowArray{static_cast<int64_t>(column->size()),
+                      0,
+                      0,
+                      static_cast<int64_t>(exported_array->buffers.size()),
+                      0,
+                      exported_array->buffers.data(),
+                      nullptr,
+                      nullptr,
+                      &release_array,
+                      exported_array.release()};
+}
+
+// Returns whether any of the length values starting at the physical offset is null
+bool has_nulls(const ArrowArray& array, const int64_t offset, const int64_t length) {
+  if (array.null_count == 0 || array.n_buffers == 0 || !array.buffers[0]) return false;
+  if (array.null_count > 0 && offset == array.offset && length == array.length) return true;
+
+  // The null count is unknown or refers to the entire array, so the validity bitmap is checked
+  const auto validity = static_cast<const uint8_t*>(array.buffers[0]);
+  for (auto index = offset; index < offset + length; ++index) {
+    if (!(validity[index / 8] & (1 << (index % 8)))) return true;
+  }
+  return false;
+}
+
+// releases the schema and the batches when the import is finished or fails
+class ReleaseGuard : private Noncopyable {
+ public:
+  ReleaseGuard(ArrowSchema* schema, std::vector<ArrowArray>& batches) : _schema(schema), _batches(batches) {}
+
+  ~ReleaseGuard() {
+    for (auto& batch : _batches) {
+      if (batch.release) batch.release(&batch);
+    }
+    if (_schema->release) _schema->release(_schema);
+  }
+
+ protected:
+  ArrowSchema* const _schema;
+  std::vector<ArrowArray>& _batches;
+};
+
+}  // namespace
+
+namespace opossum {
+
+void ArrowConverter::export_schema(const Table& table, ArrowSchema* schema) {
+  auto exported_schema = std::make_unique<ExportedSchema>();
+  exported_schema->children.resize(table.col_count());
+
+  for (auto column_id = ColumnID{0}; column_id < table.col_count(); ++column_id) {
+    auto exported_child = std::make_unique<ExportedSchema>();
+    exported_child->name = table.column_name(column_id);
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      exported_schema->children[column_id] = ArrowSchema{arrow_format<ColumnDataType>(),
+                                                         exported_child->name.c_str(),
+                                                         nullptr,
+                                                         0,
+                                                         0,
+                                                         nullptr,
+                                                         nullptr,
+                                                         &release_schema,
+                                                         exported_child.release()};
+    });
+    exported_schema->child_pointers.push_back(&exported_schema->children[column_id]);
+  }
+
+  *schema = ArrowSchema{"+s",
+                        exported_schema->name.c_str(),
+                        nullptr,
+                        0,
+                        static_cast<int64_t>(table.col_count()),
+                        exported_schema->child_pointers.data(),
+                        nullptr,
+                        &release_schema,
+                        exported_schema.release()};
+}
+
+void ArrowConverter::export_chunk(const Chunk& chunk, ArrowArray* array) {
+  // If exporting a column fails, the destructor of ExportedArray releases the columns exported before
+  auto exported_array = std::make_unique<ExportedArray>();
+  exported_array->buffers.push_back(nullptr);
+  exported_array->children.resize(chunk.col_count());
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+    export_column(chunk.get_column(column_id), &exported_array->children[column_id]);
+    exported_array->child_pointers.push_back(&exported_array->children[column_id]);
+  }
+
+  *array = ArrowArray{static_cast<int64_t>(chunk.size()),
+                      0,
+                      0,
+                      1,
+                      static_cast<int64_t>(chunk.col_count()),
+                      exported_array->buffers.data(),
+                      exported_array->child_pointers.data(),
+                      nullptr,
+                      &release_array,
+                      exported_array.release()};
+}
+
+std::shared_ptr<Table> ArrowConverter::import_table(ArrowSchema* schema, std::vector<ArrowArray>& batches) {
+  const auto release_guard = ReleaseGuard{schema, batches};
+  Assert(std::string(schema->format) == "+s", "Record batches need to be of struct type");
+
+  auto table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < schema->n_children; ++column_id) {
+    const auto& child = *schema->children[column_id];
+    table->add_column(child.name ? child.name : "", data_type_from_arrow_format(child.format));
+  }
+
+  for (const auto& batch : batches) {
+    Assert(batch.n_children == table->col_count(), "Record batch does not match the schema");
+    Assert(!has_nulls(batch, batch.offset, batch.length), "Null values are not supported");
+    if (batch.length == 0) continue;
+
+    auto chunk = Chunk{};
+    for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+      const auto& child = *batch.children[column_id];
+      const auto offset = batch.offset + child.offset;
+      Assert(child.length >= batch.offset + batch.length, "Child array is shorter than the record batch");
+      Assert(!has_nulls(child, offset, batch.length), "Null values are not supported");
+
+      resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        auto values = pmr_vector<ColumnDataType>(chunk.get_allocator());
+
+        if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+          const auto offsets = static_cast<const int32_t*>(child.buffers[1]) + offset;
+          const auto characters = static_cast<const char*>(child.buffers[2]);
+          values.reserve(batch.length);
+          for (auto index = int64_t{0}; index < batch.length; ++index) {
+            values.emplace_back(characters + offsets[index], offsets[index + 1] - offsets[index]);
+          }
+        } else {
+          const auto data = static_cast<const ColumnDataType*>(child.buffers[1]) + offset;
+          values.assign(data, data + batch.length);
+        }
+
+        chunk.add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+      });
+    }
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow_c_data_interface.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * ArrowConverter exchanges tables with Arrow-based tools through the Arrow C data interface, without going through
+ * rows. A table is described by a schema of struct type whose children are the columns, and every chunk is exported as
+ * a record batch, i.e., a struct array of that type. The COLUMN_TYPES map to the Arrow types int32, int64, float32,
+ * float64 and utf8. All columns are exported as non-nullable.
+ *
+ * Exporting fixed-width columns does not copy: the data buffer of an exported array is the vector of the ValueColumn,
+ * which the array keeps alive until it is released. Buffers are aligned to 64 bytes, as recommended by Arrow, if the
+ * table allocates from AlignedMemoryResource. String columns are converted into Arrow's layout of offsets and
+ * characters, whose buffers are always aligned to 64 bytes. DictionaryColumns are decoded into a new ValueColumn first.
+ *
+ * Importing copies every buffer into a ValueColumn at once, as ValueColumns own their values.
+ */
+class ArrowConverter {
+ public:
+  // describes the columns of the table. The caller has to release the schema.
+  static void export_schema(const Table& table, ArrowSchema* schema);
+
+  // Exports the chunk as a record batch. The caller has to release the array. Fails if the chunk holds
+  // ReferenceColumns. As appending may move the values of a chunk, unsealed chunks must not change until then.
+  static void export_chunk(const Chunk& chunk, ArrowArray* array);
+
+  // Creates a table with one chunk per non-empty record batch. Releases the schema and the batches, also if the import
+  // fails, e.g., because of an unsupported type or null values.
+  static std::shared_ptr<Table> import_table(ArrowSchema* schema, std::vector<ArrowArray>& batches);
+};
+
+}  // namespace opossum
@@ -4,6 +4,8 @@
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "compact_value.hpp"
+#include "encoding_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -23,10 +25,24 @@ class BaseColumn : private Noncopyable {
   // returns the value at a given position
   virtual const AllTypeVariant operator[](const size_t i) const = 0;
 
+  // returns the value at a given position as a CompactValue. Strings are returned as views into the column, which are
+  // only valid as long as the column is not modified. This is cheaper than operator[], but still slow.
+  virtual CompactValue compact_value_at(const size_t i) const = 0;
+
   // appends the value at the end of the column
   virtual void append(const AllTypeVariant& val) = 0;
+  virtual void append(const CompactValue& val) = 0;
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns the type of the values stored in the column
+  virtual DataType data_type() const = 0;
+
+  // returns the physical representation of the column
+  virtual EncodingType encoding_type() const = 0;
+
+  // returns the approximate number of bytes occupied by the column, including heap-allocated payloads (e.g., strings)
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,77 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t value_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False positive rate needs to be in (0, 1)");
+
+  // Bits per value required by a split block Bloom filter that sets one bit in each of its eight words, as given in
+  // the specification of Apache Parquet's Bloom filters
+  const auto bits_per_value = -static_cast<double>(WORDS_PER_BLOCK) /
+                              std::log(1.0 - std::pow(false_positive_rate, 1.0 / static_cast<double>(WORDS_PER_BLOCK)));
+  const auto bits = static_cast<double>(value_count) * bits_per_value;
+  const auto block_count = static_cast<size_t>(std::ceil(bits / static_cast<double>(sizeof(Block) * 8)));
+
+  _blocks.resize(std::max(block_count, size_t{1}));
+}
+
+std::shared_ptr<BloomFilter> BloomFilter::build(const BaseColumn& column, const double false_positive_rate) {
+  std::shared_ptr<BloomFilter> bloom_filter;
+  resolve_column_type(column, [&](auto, const auto& typed_column) {
+    // Every distinct value of a DictionaryColumn is inserted once, so the filter is sized for the dictionary
+    if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+      bloom_filter = std::make_shared<BloomFilter>(typed_column.unique_values_count(), false_positive_rate);
+      for (const auto& value : typed_column.dictionary()) {
+        bloom_filter->insert(value);
+      }
+    } else {
+      bloom_filter = std::make_shared<BloomFilter>(column.size(), false_positive_rate);
+      for (const auto& value : typed_column.values()) {
+        bloom_filter->insert(value);
+      }
+    }
+  });
+  return bloom_filter;
+}
+
+bool BloomFilter::contains(const AllTypeVariant& value, const DataType data_type) const {
+  auto result = true;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    result = contains(type_cast<ColumnDataType>(value));
+  });
+  return result;
+}
+
+size_t BloomFilter::block_count() const { return _blocks.size(); }
+
+size_t BloomFilter::estimate_memory_usage() const { return sizeof(*this) + _blocks.capacity() * sizeof(Block); }
+
+uint64_t BloomFilter::_hash_bytes(const char* data, const size_t size) {
+  // Processes eight bytes at a time and mixes in the size so that, e.g., "a" and "a\0" differ
+  auto hash = _mix(size);
+  auto offset = size_t{0};
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    auto word = uint64_t{0};
+    std::memcpy(&word, data + offset, sizeof(word));
+    hash = _mix(hash ^ word) * 0x9e3779b97f4a7c15ULL;
+  }
+  if (offset < size) {
+    auto word = uint64_t{0};
+    std::memcpy(&word, data + offset, size - offset);
+    hash = _mix(hash ^ word) * 0x9e3779b97f4a7c15ULL;
+  }
+  return _mix(hash);
+}
+
+}  // namespace opossum
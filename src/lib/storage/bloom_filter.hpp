@@ -0,0 +1,120 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+/**
+ * BloomFilter is a split block Bloom filter: it consists of blocks the size of a cache line, and inserting or probing
+ * a value only touches a single block. Each block holds eight 64-bit words and a value sets one bit in each of them.
+ * The eight bit positions are derived from a single hash by multiplying it with eight different odd constants. As the
+ * eight computations are independent, the compiler can turn them into SIMD instructions.
+ *
+ * Values are hashed according to their type, i.e., a probe value needs to have the type of the column (see
+ * contains(const AllTypeVariant&, DataType) for a conversion).
+ */
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr size_t WORDS_PER_BLOCK = 8;
+
+  // creates a filter that has a false positive rate of about false_positive_rate once value_count values are inserted
+  BloomFilter(const size_t value_count, const double false_positive_rate);
+
+  // creates a filter holding all values of column, which needs to be a ValueColumn or a DictionaryColumn
+  static std::shared_ptr<BloomFilter> build(const BaseColumn& column, const double false_positive_rate);
+
+  template <typename T>
+  void insert(const T& value) {
+    const auto hash = hash_value(value);
+    auto& words = _blocks[_block_index(hash)].words;
+    const auto masks = _masks(hash);
+    for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+      words[word_index] |= masks[word_index];
+    }
+  }
+
+  // returns false if the value has definitely not been inserted
+  template <typename T>
+  bool contains(const T& value) const {
+    const auto hash = hash_value(value);
+    const auto& words = _blocks[_block_index(hash)].words;
+    const auto masks = _masks(hash);
+    auto missing_bits = uint64_t{0};
+    for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+      missing_bits |= masks[word_index] & ~words[word_index];
+    }
+    return missing_bits == 0;
+  }
+
+  // converts value to data_type, the type of the inserted values, before probing
+  bool contains(const AllTypeVariant& value, const DataType data_type) const;
+
+  size_t block_count() const;
+  size_t estimate_memory_usage() const;
+
+  // Hashes values of all COLUMN_TYPES to 64 bits. Equal values have the same hash, including 0.0 and -0.0.
+  template <typename T>
+  static uint64_t hash_value(const T& value) {
+    if constexpr (std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value) {
+      return _hash_bytes(value.data(), value.size());
+    } else if constexpr (std::is_floating_point<T>::value) {  // NOLINT
+      const auto normalized = static_cast<double>(value == T{0} ? T{0} : value);
+      auto bits = uint64_t{0};
+      std::memcpy(&bits, &normalized, sizeof(bits));
+      return _mix(bits);
+    } else {
+      return _mix(static_cast<uint64_t>(value));
+    }
+  }
+
+ protected:
+  using Words = std::array<uint64_t, WORDS_PER_BLOCK>;
+
+  struct alignas(CACHE_LINE_SIZE) Block {
+    Words words{};
+  };
+
+  // The upper half of the hash selects the block, the lower half the bits within the block
+  size_t _block_index(const uint64_t hash) const { return ((hash >> 32) * _blocks.size()) >> 32; }
+
+  static Words _masks(const uint64_t hash) {
+    static constexpr std::array<uint32_t, WORDS_PER_BLOCK> SALTS = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                                    0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                                    0x9efc4947U, 0x5c6bfb31U};
+    Words masks;
+    for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+      masks[word_index] = uint64_t{1} << ((static_cast<uint32_t>(hash) * SALTS[word_index]) >> 26);
+    }
+    return masks;
+  }
+
+  // Finalizer of MurmurHash3, spreads the entropy of x to all bits
+  static uint64_t _mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+  }
+
+  static uint64_t _hash_bytes(const char* data, const size_t size);
+
+  std::vector<Block> _blocks;
+};
+
+}  // namespace opossum
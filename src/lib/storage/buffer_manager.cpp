@@ -0,0 +1,237 @@
+#include "buffer_manager.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_column.hpp"
+#include "column_serializer.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+size_t estimate_columns_memory_usage(const pmr_vector<std::shared_ptr<BaseColumn>>& columns) {
+  return std::accumulate(columns.cbegin(), columns.cend(), size_t{0},
+                         [](auto acc, const auto& column) { return acc + column->estimate_memory_usage(); });
+}
+
+}  // namespace
+
+namespace opossum {
+
+ChunkFrame::ChunkFrame(pmr_vector<std::shared_ptr<BaseColumn>>&& columns, const PolymorphicAllocator<Chunk>& alloc)
+    : _columns(std::move(columns)),
+      _alloc(alloc),
+      _col_count(static_cast<uint16_t>(_columns.size())),
+      _size(_columns.empty() ? 0 : static_cast<uint32_t>(_columns.front()->size())),
+      _bytes(estimate_columns_memory_usage(_columns)) {}
+
+ChunkFrame::ChunkFrame(const std::string& path, const uint16_t col_count, const uint32_t size, const size_t bytes,
+                       const PolymorphicAllocator<Chunk>& alloc)
+    : _columns(alloc),
+      _alloc(alloc),
+      _col_count(col_count),
+      _size(size),
+      _bytes(bytes),
+      _spill_path(path),
+      _owns_spill_file(false),
+      _is_resident(false),
+      _reference_bit(false) {}
+
+ChunkFrame::~ChunkFrame() {
+  if (_is_resident) BufferManager::get()._resident_bytes -= _bytes;
+  if (_owns_spill_file && !_spill_path.empty()) std::remove(_spill_path.c_str());
+}
+
+uint16_t ChunkFrame::col_count() const { return _col_count; }
+
+uint32_t ChunkFrame::size() const { return _size; }
+
+size_t ChunkFrame::bytes() const { return _bytes; }
+
+bool ChunkFrame::is_resident() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _is_resident;
+}
+
+std::shared_ptr<BaseColumn> ChunkFrame::get_column(ColumnID column_id) {
+  std::shared_ptr<BaseColumn> column;
+  auto loaded = false;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    loaded = _load();
+    column = _columns.at(column_id);
+  }
+  _reference_bit = true;
+
+  // The loaded columns may exceed the budget. The returned column stays valid even if it is evicted right away.
+  if (loaded) BufferManager::get()._evict_if_necessary();
+  return column;
+}
+
+void ChunkFrame::pin() {
+  auto loaded = false;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    loaded = _load();
+    ++_pin_count;
+  }
+  _reference_bit = true;
+
+  if (loaded) BufferManager::get()._evict_if_necessary();
+}
+
+void ChunkFrame::unpin() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(_pin_count > 0, "Frame is not pinned");
+    --_pin_count;
+  }
+
+  // Pinned frames may have kept the BufferManager from staying within its budget
+  BufferManager::get()._evict_if_necessary();
+}
+
+bool ChunkFrame::_try_evict() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_is_resident || _pin_count > 0) return false;
+
+  if (_spill_path.empty()) {
+    const auto spill_path = BufferManager::get()._create_spill_path();
+    auto stream = std::ofstream{spill_path, std::ios::binary};
+    Assert(stream.is_open(), "Could not create spill file " + spill_path);
+    for (const auto& column : _columns) {
+      ColumnSerializer::serialize(stream, *column);
+    }
+    stream.close();
+    Assert(stream.good(), "Could not write spill file " + spill_path);
+    _spill_path = spill_path;
+  }
+
+  // Operators that still hold one of the columns keep it alive until they release it
+  _columns.clear();
+  _is_resident = false;
+  BufferManager::get()._resident_bytes -= _bytes;
+  PerformanceCount("chunk evicted by BufferManager");
+  return true;
+}
+
+bool ChunkFrame::_load() {
+  if (_is_resident) return false;
+
+  auto stream = std::ifstream{_spill_path, std::ios::binary};
+  Assert(stream.is_open(), "Could not open spill file " + _spill_path);
+  _columns.reserve(_col_count);
+  for (auto column_id = ColumnID{0}; column_id < _col_count; ++column_id) {
+    _columns.push_back(ColumnSerializer::deserialize(stream, _alloc));
+  }
+
+  _is_resident = true;
+  BufferManager::get()._resident_bytes += _bytes;
+  PerformanceCount("chunk loaded by BufferManager");
+  return true;
+}
+
+BufferManager::BufferManager() {
+  const auto temp_directory = std::getenv("TMPDIR");
+  const auto base_directory = std::string{temp_directory && *temp_directory ? temp_directory : "/tmp"};
+  _spill_directory = base_directory + "/hyrise_spill_" + std::to_string(getpid());
+}
+
+BufferManager& BufferManager::get() {
+  static BufferManager instance;
+  return instance;
+}
+
+void BufferManager::set_memory_budget(const size_t bytes) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memory_budget = bytes;
+  }
+  _evict_if_necessary();
+}
+
+size_t BufferManager::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+void BufferManager::set_spill_directory(const std::string& path) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _spill_directory = path;
+  _spill_directory_created = false;
+}
+
+std::string BufferManager::spill_directory() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _spill_directory;
+}
+
+size_t BufferManager::resident_bytes() const { return _resident_bytes; }
+
+std::shared_ptr<ChunkFrame> BufferManager::register_chunk(pmr_vector<std::shared_ptr<BaseColumn>>&& columns,
+                                                          const PolymorphicAllocator<Chunk>& alloc) {
+  auto frame = std::make_shared<ChunkFrame>(std::move(columns), alloc);
+  _resident_bytes += frame->bytes();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frames.push_back(frame);
+  }
+  _evict_if_necessary();
+  return frame;
+}
+
+std::shared_ptr<ChunkFrame> BufferManager::register_stored_chunk(const std::string& path, const uint16_t col_count,
+                                                                 const uint32_t size, const size_t bytes,
+                                                                 const PolymorphicAllocator<Chunk>& alloc) {
+  auto frame = std::make_shared<ChunkFrame>(path, col_count, size, bytes, alloc);
+  std::lock_guard<std::mutex> lock(_mutex);
+  _frames.push_back(frame);
+  return frame;
+}
+
+void BufferManager::_evict_if_necessary() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_memory_budget == 0) return;
+
+  // Within two rounds, the hand clears the reference bit of every frame and then evicts it, unless it is pinned
+  auto remaining_steps = 2 * _frames.size();
+  while (_resident_bytes > _memory_budget && remaining_steps > 0 && !_frames.empty()) {
+    --remaining_steps;
+    if (_clock_hand >= _frames.size()) _clock_hand = 0;
+
+    const auto frame = _frames[_clock_hand].lock();
+    if (!frame) {
+      _frames[_clock_hand] = std::move(_frames.back());
+      _frames.pop_back();
+      continue;
+    }
+
+    ++_clock_hand;
+    if (frame->_reference_bit.exchange(false)) continue;
+    frame->_try_evict();
+  }
+}
+
+std::string BufferManager::_create_spill_path() {
+  if (!_spill_directory_created) {
+    Assert(mkdir(_spill_directory.c_str(), 0700) == 0 || errno == EEXIST,
+           "Could not create spill directory " + _spill_directory);
+    _spill_directory_created = true;
+  }
+  return _spill_directory + "/chunk_" + std::to_string(_spill_file_count++) + ".bin";
+}
+
+}  // namespace opossum
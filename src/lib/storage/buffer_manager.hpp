@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+/**
+ * ChunkFrame holds the columns of a sealed chunk whose eviction has been enabled (see Table::enable_eviction). The
+ * columns are either resident or, after the BufferManager evicted them, stored in a spill file, from which they are
+ * loaded on the next access. Chunks are immutable once sealed, so a spill file is written only once and reused for
+ * later evictions.
+ *
+ * All methods are thread-safe.
+ */
+class ChunkFrame : private Noncopyable {
+ public:
+  ChunkFrame(pmr_vector<std::shared_ptr<BaseColumn>>&& columns, const PolymorphicAllocator<Chunk>& alloc);
+
+  // Creates a frame whose columns are not resident, but stored in the file at path in the format of a spill file, e.g.,
+  // by a Checkpoint. The frame does not remove that file.
+  ChunkFrame(const std::string& path, const uint16_t col_count, const uint32_t size, const size_t bytes,
+             const PolymorphicAllocator<Chunk>& alloc);
+
+  ~ChunkFrame();
+
+  uint16_t col_count() const;
+  uint32_t size() const;
+
+  // returns the approximate number of bytes that the columns occupy while they are resident
+  size_t bytes() const;
+
+  bool is_resident() const;
+
+  // returns the column, loading all columns from the spill file if they have been evicted
+  std::shared_ptr<BaseColumn> get_column(ColumnID column_id);
+
+  // Pinned frames are not evicted. Pinning loads the columns if necessary. See ChunkPin.
+  void pin();
+  void unpin();
+
+ protected:
+  friend class BufferManager;
+
+  // Writes the columns to the spill file (unless that has happened before) and drops them. Returns false if the frame
+  // is pinned or not resident.
+  bool _try_evict();
+
+  // makes the frame resident and returns true if the columns had to be loaded. Expects _mutex to be locked.
+  bool _load();
+
+  mutable std::mutex _mutex;
+  pmr_vector<std::shared_ptr<BaseColumn>> _columns;
+  const PolymorphicAllocator<Chunk> _alloc;
+  const uint16_t _col_count;
+  const uint32_t _size;
+  const size_t _bytes;
+
+  // empty until the columns are evicted for the first time
+  std::string _spill_path;
+  bool _owns_spill_file = true;
+  uint32_t _pin_count = 0;
+  bool _is_resident = true;
+
+  // set on every access and cleared by the CLOCK hand of the BufferManager, which only evicts frames whose reference
+  // bit is not set
+  std::atomic<bool> _reference_bit{true};
+};
+
+/**
+ * The BufferManager is a singleton that keeps the resident columns of evictable chunks (see Table::enable_eviction)
+ * within a memory budget. When the budget is exceeded, e.g., because a chunk is sealed or an evicted chunk is accessed,
+ * it evicts chunks to its spill directory. Chunks are chosen by the CLOCK algorithm, an approximation of LRU: a hand
+ * sweeps over the frames, clearing their reference bits, and evicts the first frame whose bit is not set, i.e., that
+ * has not been accessed since the hand passed it last. Pinned frames are skipped.
+ *
+ * Only the columns are evicted. The chunks themselves, including their size and metadata like Bloom filters and min/max
+ * values, stay in memory, so that operators can skip chunks without loading them.
+ */
+class BufferManager : private Noncopyable {
+ public:
+  static BufferManager& get();
+
+  // Sets the number of bytes that the columns of evictable chunks may occupy. 0 (the default) disables eviction.
+  // Evicts chunks right away if the budget is exceeded.
+  void set_memory_budget(const size_t bytes);
+  size_t memory_budget() const;
+
+  // Sets the directory that spill files are written to. It is created when the first chunk is evicted. Defaults to a
+  // directory named after the process in $TMPDIR (or /tmp).
+  void set_spill_directory(const std::string& path);
+  std::string spill_directory() const;
+
+  // returns the number of bytes occupied by the resident columns of evictable chunks
+  size_t resident_bytes() const;
+
+  // takes over the columns of a sealed chunk, which may be evicted from now on
+  std::shared_ptr<ChunkFrame> register_chunk(pmr_vector<std::shared_ptr<BaseColumn>>&& columns,
+                                             const PolymorphicAllocator<Chunk>& alloc);
+
+  // registers a sealed chunk whose columns are stored in the file at path, from which they are loaded on first access
+  std::shared_ptr<ChunkFrame> register_stored_chunk(const std::string& path, const uint16_t col_count,
+                                                    const uint32_t size, const size_t bytes,
+                                                    const PolymorphicAllocator<Chunk>& alloc);
+
+ protected:
+  friend class ChunkFrame;
+
+  BufferManager();
+
+  // evicts frames until the resident bytes fit into the budget or all remaining frames are pinned
+  void _evict_if_necessary();
+
+  // returns the path of a new spill file and creates the spill directory if necessary
+  std::string _create_spill_path();
+
+  mutable std::mutex _mutex;
+  size_t _memory_budget = 0;
+  std::string _spill_directory;
+  bool _spill_directory_created = false;
+  uint64_t _spill_file_count = 0;
+
+  // The frames in the order visited by the CLOCK hand. Frames are owned by their chunks, entries of destroyed chunks
+  // are removed when the hand passes them.
+  std::vector<std::weak_ptr<ChunkFrame>> _frames;
+  size_t _clock_hand = 0;
+
+  // updated by frames without locking _mutex, so that a frame can be destroyed while _mutex is held
+  std::atomic<size_t> _resident_bytes{0};
+};
+
+}  // namespace opossum
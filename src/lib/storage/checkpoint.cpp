@@ -0,0 +1,350 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_column.hpp"
+#include "buffer_manager.hpp"
+#include "column_serializer.hpp"
+#include "resolve_type.hpp"
+#include "storage_manager.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/performance_counters.hpp"
+#include "value_column.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto MANIFEST_FILE_NAME = std::string{"manifest"};
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    write_value(stream, static_cast<uint64_t>(value.size()));
+    stream.write(value.data(), value.size());
+  } else {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  auto value = T{};
+  if constexpr (std::is_same<T, std::string>::value) {
+    value.resize(read_value<uint64_t>(stream));
+    stream.read(&value[0], value.size());
+  } else {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+  return value;
+}
+
+bool file_exists(const std::string& path) {
+  struct stat status;
+  return stat(path.c_str(), &status) == 0;
+}
+
+// Writes contents to a temporary file, flushes it to disk and renames it to path, so that path is either missing or
+// complete
+void write_file(const std::string& path, const std::string& contents) {
+  const auto temporary_path = path + ".tmp";
+  const auto file_descriptor = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(file_descriptor >= 0, "Could not create " + temporary_path);
+
+  auto offset = size_t{0};
+  auto success = true;
+  while (success && offset < contents.size()) {
+    const auto written = write(file_descriptor, contents.data() + offset, contents.size() - offset);
+    if (written < 0 && errno == EINTR) continue;
+    success = written >= 0;
+    offset += success ? static_cast<size_t>(written) : 0;
+  }
+  success = success && fsync(file_descriptor) == 0;
+  success = close(file_descriptor) == 0 && success;
+  Assert(success && std::rename(temporary_path.c_str(), path.c_str()) == 0, "Could not write " + path);
+}
+
+// makes renames within the directory durable
+void sync_directory(const std::string& directory) {
+  const auto file_descriptor = open(directory.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open " + directory);
+  const auto success = fsync(file_descriptor) == 0;
+  close(file_descriptor);
+  Assert(success, "Could not sync " + directory);
+}
+
+std::string generate_file_name() {
+  thread_local auto generator = std::mt19937_64(std::random_device()());
+  return "tail_" + std::to_string(generator()) + ".bin";
+}
+
+}  // namespace
+
+namespace opossum {
+
+Checkpoint::Checkpoint(const std::string& directory, const uint64_t log_offset)
+    : _directory(directory), _log_offset(log_offset) {
+  const auto& storage_manager = StorageManager::get();
+  for (const auto& name : storage_manager.table_names()) {
+    const auto& table = *storage_manager.get_table(name);
+
+    auto table_entry = TableEntry{name, table.chunk_size(), table.column_names(), {}, {}};
+    for (auto column_id = ColumnID{0}; column_id < table.col_count(); ++column_id) {
+      table_entry.column_data_types.push_back(table.column_data_type(column_id));
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.size() > 0) table_entry.chunks.push_back(_capture_chunk(chunk));
+    }
+
+    _tables.push_back(std::move(table_entry));
+  }
+}
+
+void Checkpoint::write() const {
+  Assert(mkdir(_directory.c_str(), 0755) == 0 || errno == EEXIST, "Could not create directory " + _directory);
+
+  auto pending_chunks = std::vector<const ChunkEntry*>{};
+  for (const auto& table : _tables) {
+    for (const auto& chunk : table.chunks) {
+      if (chunk.needs_writing) pending_chunks.push_back(&chunk);
+    }
+  }
+
+  // The chunks are distributed dynamically, as their sizes and the cost of loading evicted ones vary
+  parallel_for(pending_chunks.size(), 0, [&](const size_t index) { _write_chunk(*pending_chunks[index]); });
+  sync_directory(_directory);
+
+  auto previous_log_offset = uint64_t{0};
+  auto previous_tables = std::vector<TableEntry>{};
+  _read_manifest(_directory, previous_log_offset, previous_tables);
+
+  auto manifest = std::ostringstream{};
+  write_value(manifest, _log_offset);
+  write_value(manifest, static_cast<uint64_t>(_tables.size()));
+  for (const auto& table : _tables) {
+    write_value(manifest, table.name);
+    write_value(manifest, table.chunk_size);
+    write_value(manifest, static_cast<uint16_t>(table.column_names.size()));
+    for (auto column_id = ColumnID{0}; column_id < table.column_names.size(); ++column_id) {
+      write_value(manifest, table.column_names[column_id]);
+      write_value(manifest, table.column_data_types[column_id]);
+    }
+
+    write_value(manifest, static_cast<uint32_t>(table.chunks.size()));
+    for (const auto& chunk : table.chunks) {
+      write_value(manifest, chunk.file_name);
+      write_value(manifest, chunk.is_sealed);
+      write_value(manifest, chunk.persistent_id);
+      write_value(manifest, chunk.size);
+      write_value(manifest, chunk.bytes);
+      write_value(manifest, static_cast<uint16_t>(chunk.min_max.size()));
+      for (auto column_id = ColumnID{0}; column_id < chunk.min_max.size(); ++column_id) {
+        const auto& min_max = chunk.min_max[column_id];
+        write_value(manifest, min_max.has_value());
+        if (!min_max) continue;
+
+        resolve_data_type(table.column_data_types[column_id], [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          write_value(manifest, type_cast<ColumnDataType>(min_max->min));
+          write_value(manifest, type_cast<ColumnDataType>(min_max->max));
+        });
+      }
+      write_value(manifest, static_cast<uint16_t>(chunk.sorted_by.size()));
+      for (const auto& column_id : chunk.sorted_by) {
+        write_value(manifest, static_cast<ColumnID::base_type>(column_id));
+      }
+    }
+  }
+  write_file(_directory + "/" + MANIFEST_FILE_NAME, manifest.str());
+  sync_directory(_directory);
+
+  // Only now that the new manifest is in place, the files that only the previous one referenced can be removed
+  auto file_names = std::set<std::string>{};
+  for (const auto& table : _tables) {
+    for (const auto& chunk : table.chunks) {
+      file_names.insert(chunk.file_name);
+    }
+  }
+  for (const auto& table : previous_tables) {
+    for (const auto& chunk : table.chunks) {
+      if (!file_names.count(chunk.file_name)) std::remove((_directory + "/" + chunk.file_name).c_str());
+    }
+  }
+}
+
+uint64_t Checkpoint::load(const std::string& directory) {
+  auto log_offset = uint64_t{0};
+  auto tables = std::vector<TableEntry>{};
+  Assert(_read_manifest(directory, log_offset, tables), "There is no checkpoint in " + directory);
+
+  for (const auto& table_entry : tables) {
+    auto table = std::make_shared<Table>(table_entry.chunk_size);
+    for (auto column_id = ColumnID{0}; column_id < table_entry.column_names.size(); ++column_id) {
+      table->add_column(table_entry.column_names[column_id], table_entry.column_data_types[column_id]);
+    }
+
+    for (const auto& chunk_entry : table_entry.chunks) {
+      const auto path = directory + "/" + chunk_entry.file_name;
+      auto chunk = Chunk{};
+
+      if (chunk_entry.is_sealed) {
+        // The columns are loaded by the BufferManager on first access
+        chunk._frame = BufferManager::get().register_stored_chunk(path, table->col_count(), chunk_entry.size,
+                                                                  chunk_entry.bytes, chunk.get_allocator());
+        chunk._is_sealed = true;
+        chunk._persistent_id = chunk_entry.persistent_id;
+        chunk._min_max = chunk_entry.min_max;
+        chunk._sorted_by = chunk_entry.sorted_by;
+      } else {
+        auto stream = std::ifstream{path, std::ios::binary};
+        Assert(stream.is_open(), "Could not open " + path);
+        for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+          chunk.add_column(ColumnSerializer::deserialize(stream, chunk.get_allocator()));
+        }
+      }
+
+      table->emplace_chunk(std::move(chunk));
+    }
+
+    StorageManager::get().add_table(table_entry.name, table);
+  }
+
+  return log_offset;
+}
+
+Checkpoint::ChunkEntry Checkpoint::_capture_chunk(const Chunk& chunk) const {
+  auto entry = ChunkEntry{};
+  entry.is_sealed = chunk.is_sealed();
+  entry.persistent_id = chunk.persistent_id();
+  entry.size = chunk.size();
+  entry.bytes = 0;
+  entry.needs_writing = true;
+
+  if (!chunk.is_sealed()) {
+    // The last chunk of a table may change after capturing, so its ValueColumns are copied
+    entry.file_name = generate_file_name();
+    for (const auto& column : chunk._columns) {
+      Assert(column->encoding_type() != EncodingType::Reference, "Checkpoints do not support ReferenceColumns");
+      resolve_column_type(*column, [&](auto type, const auto& typed_column) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+          entry.columns.push_back(column);
+        } else {
+          auto values = pmr_vector<ColumnDataType>(typed_column.values());
+          entry.columns.push_back(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+        }
+      });
+      entry.bytes += entry.columns.back()->estimate_memory_usage();
+    }
+    return entry;
+  }
+
+  entry.file_name = "chunk_" + std::to_string(chunk.persistent_id()) + ".bin";
+  entry.min_max = chunk._min_max;
+  entry.sorted_by = chunk._sorted_by;
+  if (chunk._frame) {
+    entry.bytes = chunk._frame->bytes();
+  } else {
+    for (const auto& column : chunk._columns) {
+      entry.bytes += column->estimate_memory_usage();
+    }
+  }
+
+  if (file_exists(_directory + "/" + entry.file_name)) {
+    entry.needs_writing = false;
+    PerformanceCount("chunk skipped by Checkpoint");
+    return entry;
+  }
+
+  // Sealed chunks are immutable, so their columns are only referenced. Evicted ones are loaded while writing.
+  if (chunk._frame) {
+    entry.frame = chunk._frame;
+  } else {
+    for (const auto& column : chunk._columns) {
+      Assert(column->encoding_type() != EncodingType::Reference, "Checkpoints do not support ReferenceColumns");
+      entry.columns.push_back(column);
+    }
+  }
+  return entry;
+}
+
+void Checkpoint::_write_chunk(const ChunkEntry& chunk) const {
+  auto stream = std::ostringstream{};
+  if (chunk.frame) {
+    for (auto column_id = ColumnID{0}; column_id < chunk.frame->col_count(); ++column_id) {
+      ColumnSerializer::serialize(stream, *chunk.frame->get_column(column_id));
+    }
+  } else {
+    for (const auto& column : chunk.columns) {
+      ColumnSerializer::serialize(stream, *column);
+    }
+  }
+
+  write_file(_directory + "/" + chunk.file_name, stream.str());
+  PerformanceCount("chunk written by Checkpoint");
+}
+
+bool Checkpoint::_read_manifest(const std::string& directory, uint64_t& log_offset, std::vector<TableEntry>& tables) {
+  auto stream = std::ifstream{directory + "/" + MANIFEST_FILE_NAME, std::ios::binary};
+  if (!stream.is_open()) return false;
+
+  log_offset = read_value<uint64_t>(stream);
+  tables.resize(read_value<uint64_t>(stream));
+  for (auto& table : tables) {
+    table.name = read_value<std::string>(stream);
+    table.chunk_size = read_value<uint32_t>(stream);
+    const auto column_count = read_value<uint16_t>(stream);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      table.column_names.push_back(read_value<std::string>(stream));
+      table.column_data_types.push_back(read_value<DataType>(stream));
+    }
+
+    table.chunks.resize(read_value<uint32_t>(stream));
+    for (auto& chunk : table.chunks) {
+      chunk.file_name = read_value<std::string>(stream);
+      chunk.is_sealed = read_value<bool>(stream);
+      chunk.persistent_id = read_value<uint64_t>(stream);
+      chunk.size = read_value<uint32_t>(stream);
+      chunk.bytes = read_value<uint64_t>(stream);
+      chunk.needs_writing = false;
+      chunk.min_max.resize(read_value<uint16_t>(stream));
+      for (auto column_id = ColumnID{0}; column_id < chunk.min_max.size(); ++column_id) {
+        if (!read_value<bool>(stream)) continue;
+
+        resolve_data_type(table.column_data_types.at(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          auto& min_max = chunk.min_max[column_id].emplace();
+          min_max.min = read_value<ColumnDataType>(stream);
+          min_max.max = read_value<ColumnDataType>(stream);
+        });
+      }
+      chunk.sorted_by.resize(read_value<uint16_t>(stream));
+      for (auto& column_id : chunk.sorted_by) {
+        column_id = ColumnID{read_value<ColumnID::base_type>(stream)};
+      }
+    }
+    Assert(stream.good(), "Could not read the manifest in " + directory);
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <optional>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class ChunkFrame;
+
+/**
+ * A Checkpoint holds all tables of the StorageManager, i.e., their names, column definitions and chunks, in a
+ * directory. Creating one is split into two steps, so that changes to the tables only have to be held off while the
+ * tables are captured:
+ *
+ *   auto checkpoint = Checkpoint{"/path/to/checkpoint"};  // captures the tables, must not overlap with changes
+ *   checkpoint.write();                                  // may run concurrently with appends
+ *
+ * Capturing is cheap: sealed chunks are immutable and thus only referenced, only the unsealed last chunk of every table
+ * is copied. Writing stores every chunk in a file of its own, in parallel. Sealed chunks are named after their
+ * Chunk::persistent_id and skipped if an earlier checkpoint in the directory already wrote them. A manifest with the
+ * tables, their chunks and the chunks' metadata is replaced atomically at the end, so that a crash while writing leaves
+ * the previous checkpoint intact. Files of the previous checkpoint that are no longer needed are removed afterwards.
+ *
+ * load registers the tables of a checkpoint in the StorageManager without reading their sealed chunks: these are handed
+ * to the BufferManager as evicted and loaded on first access, while their sizes and min/max values are available right
+ * away. Bloom filters are not part of a checkpoint.
+ *
+ * WriteAheadLog::checkpoint creates a checkpoint while appends through the log continue, and the log's constructor
+ * restarts from it.
+ */
+class Checkpoint : private Noncopyable {
+ public:
+  // Captures the tables of the StorageManager. log_offset is stored with the checkpoint and returned by load.
+  explicit Checkpoint(const std::string& directory, const uint64_t log_offset = 0);
+
+  // writes the captured tables, creating the directory if it does not exist
+  void write() const;
+
+  // Adds the tables of the checkpoint in directory to the StorageManager and returns the log offset of the checkpoint.
+  // The checkpoint's files need to be kept as long as its tables are used.
+  static uint64_t load(const std::string& directory);
+
+ protected:
+  // A captured chunk. Its columns are either held directly or by a frame of the BufferManager.
+  struct ChunkEntry {
+    std::string file_name;
+    bool is_sealed;
+    uint64_t persistent_id;
+    uint32_t size;
+    uint64_t bytes;
+    std::vector<std::optional<ColumnMinMax>> min_max;
+    std::vector<ColumnID> sorted_by;
+
+    // false if an earlier checkpoint has written the file
+    bool needs_writing;
+    std::vector<std::shared_ptr<BaseColumn>> columns;
+    std::shared_ptr<ChunkFrame> frame;
+  };
+
+  struct TableEntry {
+    std::string name;
+    uint32_t chunk_size;
+    std::vector<std::string> column_names;
+    std::vector<DataType> column_data_types;
+    std::vector<ChunkEntry> chunks;
+  };
+
+  ChunkEntry _capture_chunk(const Chunk& chunk) const;
+
+  // serializes the columns of the chunk into its file
+  void _write_chunk(const ChunkEntry& chunk) const;
+
+  // Reads the manifest in directory into log_offset and tables (without columns or frames). Returns false if the
+  // directory holds no checkpoint.
+  static bool _read_manifest(const std::string& directory, uint64_t& log_offset, std::vector<TableEntry>& tables);
+
+  const std::string _directory;
+  const uint64_t _log_offset;
+  std::vector<TableEntry> _tables;
+};
+
+}  // namespace opossum
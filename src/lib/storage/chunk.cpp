@@ -1,39 +1,241 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
+#include "bloom_filter.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
+#include "trigram_index.hpp"
 
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+uint64_t generate_persistent_id() {
+  thread_local auto generator = std::mt19937_64(std::random_device()());
+  auto distribution = std::uniform_int_distribution<uint64_t>{1, std::numeric_limits<uint64_t>::max()};
+  return distribution(generator);
+}
+
+}  // namespace
+
 namespace opossum {
 
-void Chunk::add_column(std::shared_ptr<BaseColumn> column) { _columns.push_back(column); }
+Chunk::Chunk(const PolymorphicAllocator<Chunk>& alloc) : _alloc{alloc}, _columns(alloc) {}
+
+void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
+  Assert(!_is_sealed, "Cannot add a column to a sealed chunk");
+  _columns.push_back(column);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(!_is_sealed, "Cannot append to a sealed chunk");
+  DebugAssert(values.size() == _columns.size(), "Data row does not match column layout");
+  for (size_t i_column = 0; i_column < _columns.size(); ++i_column) {
+    _columns[i_column]->append(values[i_column]);
+  }
+}
+
+void Chunk::append_compact(const std::vector<CompactValue>& values) {
+  DebugAssert(!_is_sealed, "Cannot append to a sealed chunk");
   DebugAssert(values.size() == _columns.size(), "Data row does not match column layout");
   for (size_t i_column = 0; i_column < _columns.size(); ++i_column) {
     _columns[i_column]->append(values[i_column]);
   }
 }
 
-std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return _columns.at(column_id); }
+std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
+  if (_frame) return _frame->get_column(column_id);
+  return std::atomic_load(&_columns.at(column_id));
+}
+
+void Chunk::replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column) {
+  Assert(_is_sealed, "Only columns of sealed chunks can be replaced");
+  Assert(!_frame, "Columns of evictable chunks cannot be replaced");
+  const auto& replaced_column = _columns.at(column_id);
+  Assert(column->size() == replaced_column->size() && column->data_type() == replaced_column->data_type(),
+         "Replacing column does not match the replaced one");
+  std::atomic_store(&_columns[column_id], std::move(column));
+}
+
+std::vector<ChunkOffset> Chunk::sort(const std::vector<ColumnID>& column_ids) {
+  Assert(!_is_sealed, "Sealed chunks are immutable and cannot be sorted");
+  Assert(!_frame, "Evictable chunks cannot be sorted");
+  for (const auto& column : _columns) {
+    Assert(column->encoding_type() == EncodingType::Unencoded, "Only chunks of ValueColumns can be sorted");
+  }
+
+  // Sorting stably by every column, from the last to the first one, yields the lexicographical order. This way, the
+  // type of every column is resolved once rather than for every comparison.
+  auto permutation = std::vector<ChunkOffset>(size());
+  std::iota(permutation.begin(), permutation.end(), ChunkOffset{0});
+  for (auto column_id = column_ids.crbegin(); column_id != column_ids.crend(); ++column_id) {
+    resolve_column_type(*_columns.at(*column_id), [&](auto, const auto& typed_column) {
+      if constexpr (!is_dictionary_column<decltype(typed_column)>::value) {
+        const auto& values = typed_column.values();
+        std::stable_sort(permutation.begin(), permutation.end(),
+                         [&](const auto lhs, const auto rhs) { return values[lhs] < values[rhs]; });
+      }
+    });
+  }
+  _sorted_by = column_ids;
+  if (std::is_sorted(permutation.cbegin(), permutation.cend())) return permutation;
+
+  for (auto& column : _columns) {
+    resolve_column_type(*column, [&](auto type, const auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (!is_dictionary_column<decltype(typed_column)>::value) {
+        const auto& values = typed_column.values();
+        auto sorted_values = pmr_vector<ColumnDataType>(values.get_allocator());
+        sorted_values.reserve(permutation.size());
+        for (const auto position : permutation) {
+          sorted_values.push_back(values[position]);
+        }
+        column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(sorted_values));
+      }
+    });
+  }
+  return permutation;
+}
+
+const std::vector<ColumnID>& Chunk::sorted_by() const { return _sorted_by; }
+
+bool Chunk::is_sorted_by(const ColumnID column_id) const {
+  return !_sorted_by.empty() && _sorted_by.front() == column_id;
+}
+
+void Chunk::seal() {
+  if (_is_sealed) return;
+  _is_sealed = true;
+  _persistent_id = generate_persistent_id();
+
+  _min_max.resize(_columns.size());
+  for (auto column_id = ColumnID{0}; column_id < _columns.size(); ++column_id) {
+    const auto& column = *_columns[column_id];
+    if (column.size() == 0 || column.encoding_type() == EncodingType::Reference) continue;
+
+    resolve_column_type(column, [&](auto, const auto& typed_column) {
+      auto& column_min_max = _min_max[column_id].emplace();
+      if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+        column_min_max.min = typed_column.dictionary().front();
+        column_min_max.max = typed_column.dictionary().back();
+      } else {
+        const auto& values = typed_column.values();
+        const auto min_max = std::minmax_element(values.cbegin(), values.cend());
+        column_min_max.min = *min_max.first;
+        column_min_max.max = *min_max.second;
+      }
+    });
+  }
+}
+
+bool Chunk::is_sealed() const { return _is_sealed; }
 
-uint16_t Chunk::col_count() const { return _columns.size(); }
+uint64_t Chunk::persistent_id() const { return _persistent_id; }
+
+void Chunk::enable_eviction() {
+  Assert(_is_sealed, "Only sealed chunks can be evicted");
+  if (_frame || _columns.empty()) return;
+  for (const auto& column : _columns) {
+    if (column->encoding_type() == EncodingType::Reference) return;
+  }
+
+  _frame = BufferManager::get().register_chunk(std::move(_columns), _alloc);
+  _columns = pmr_vector<std::shared_ptr<BaseColumn>>(_alloc);
+}
+
+bool Chunk::is_evictable() const { return _frame != nullptr; }
+
+bool Chunk::is_resident() const { return !_frame || _frame->is_resident(); }
+
+const std::optional<ColumnMinMax>& Chunk::get_min_max(ColumnID column_id) const {
+  static const std::optional<ColumnMinMax> no_min_max;
+  if (_min_max.empty()) return no_min_max;
+  return _min_max.at(column_id);
+}
+
+std::shared_ptr<const BloomFilter> Chunk::get_bloom_filter(ColumnID column_id) const {
+  if (_bloom_filters.empty()) return nullptr;
+  return _bloom_filters.at(column_id);
+}
+
+void Chunk::set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter) {
+  Assert(column_id < col_count(), "Column does not exist");
+  _bloom_filters.resize(col_count());
+  _bloom_filters[column_id] = bloom_filter;
+}
+
+std::shared_ptr<const TrigramIndex> Chunk::get_trigram_index(ColumnID column_id) const {
+  if (_trigram_indexes.empty()) return nullptr;
+  return _trigram_indexes.at(column_id);
+}
+
+void Chunk::set_trigram_index(ColumnID column_id, std::shared_ptr<const TrigramIndex> trigram_index) {
+  Assert(column_id < col_count(), "Column does not exist");
+  _trigram_indexes.resize(col_count());
+  _trigram_indexes[column_id] = trigram_index;
+}
+
+std::shared_ptr<const ChunkStatistics> Chunk::get_statistics() const { return _statistics; }
+
+void Chunk::set_statistics(std::shared_ptr<const ChunkStatistics> statistics) { _statistics = statistics; }
+
+uint16_t Chunk::col_count() const {
+  if (_frame) return _frame->col_count();
+  return _columns.size();
+}
 
 uint32_t Chunk::size() const {
+  if (_frame) return _frame->size();
   if (_columns.empty()) {
     return 0;
   }
 
-  DebugAssert(_columns.front(), "There should be a column, but it is null");
-  return _columns.front()->size();
+  const auto column = std::atomic_load(&_columns.front());
+  DebugAssert(column, "There should be a column, but it is null");
+  return column->size();
+}
+
+const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
+
+size_t Chunk::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _columns.capacity() * sizeof(std::shared_ptr<BaseColumn>);
+  for (const auto& column : _columns) {
+    bytes += std::atomic_load(&column)->estimate_memory_usage();
+  }
+  if (_frame) bytes += sizeof(ChunkFrame) + (_frame->is_resident() ? _frame->bytes() : 0);
+  bytes += _bloom_filters.capacity() * sizeof(std::shared_ptr<const BloomFilter>);
+  for (const auto& bloom_filter : _bloom_filters) {
+    if (bloom_filter) bytes += bloom_filter->estimate_memory_usage();
+  }
+  bytes += _trigram_indexes.capacity() * sizeof(std::shared_ptr<const TrigramIndex>);
+  for (const auto& trigram_index : _trigram_indexes) {
+    if (trigram_index) bytes += trigram_index->estimate_memory_usage();
+  }
+  if (_statistics) bytes += _statistics->estimate_memory_usage();
+  bytes += _min_max.capacity() * sizeof(std::optional<ColumnMinMax>);
+  return bytes;
+}
+
+ChunkPin::ChunkPin(const Chunk& chunk) : _frame(chunk._frame) {
+  if (_frame) _frame->pin();
+}
+
+ChunkPin::ChunkPin(ChunkPin&& other) noexcept : _frame(std::move(other._frame)) {}
+
+ChunkPin::~ChunkPin() {
+  if (_frame) _frame->unpin();
 }
 
 }  // namespace opossum
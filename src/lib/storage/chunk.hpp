@@ -1,20 +1,33 @@
 #pragma once
 
 // the linter wants this to be above everything else
+#include <optional>
 #include <shared_mutex>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "compact_value.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class BloomFilter;
+class ChunkFrame;
+class ChunkStatistics;
+class TrigramIndex;
+
+// The smallest and the largest value of a column within a chunk
+struct ColumnMinMax {
+  AllTypeVariant min;
+  AllTypeVariant max;
+};
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
@@ -22,7 +35,8 @@ class BaseColumn;
 // Find more information about this in our wiki: https://github.com/hyrise/zweirise/wiki/chunk-concept
 class Chunk : private Noncopyable {
  public:
-  Chunk() = default;
+  // alloc is the allocator that columns of this chunk should use
+  explicit Chunk(const PolymorphicAllocator<Chunk>& alloc = {});
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -42,11 +56,104 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // same as append, but avoids constructing (and copying strings into) AllTypeVariants
+  void append_compact(const std::vector<CompactValue>& values);
+
   // Returns the column at a given position
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // Replaces a column of a sealed chunk with one that holds the same values in a different encoding, e.g., when
+  // Table::merge_delta dictionary-encodes the chunk. Concurrent calls of get_column return either column, and the
+  // replaced column lives on as long as its readers hold it. Fails if the chunk is evictable (see enable_eviction).
+  void replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column);
+
+  // Reorders the rows of this unsealed chunk by the values of the given columns, where later columns break ties of
+  // earlier ones, and records them (see sorted_by). The columns need to be ValueColumns. Tables sort chunks when they
+  // seal them if clustering is enabled, see Table::enable_clustering. Positions into the chunk become invalid: the
+  // returned permutation holds the previous offset of every row.
+  std::vector<ChunkOffset> sort(const std::vector<ColumnID>& column_ids);
+
+  // Returns the columns that the rows are sorted by, in the order of precedence, or nothing if the chunk has not been
+  // sorted. Only the values of the first column are sorted in themselves, which is_sorted_by checks for.
+  const std::vector<ColumnID>& sorted_by() const;
+  bool is_sorted_by(ColumnID column_id) const;
+
+  // Sealed chunks are immutable, i.e., neither values nor columns can be added. Tables seal chunks once they are full
+  // (see Table::seal_last_chunk), which is when per-chunk metadata like Bloom filters and trigram indexes is built.
+  // Sealing computes the minimum and maximum of every ValueColumn and DictionaryColumn.
+  void seal();
+  bool is_sealed() const;
+
+  // Returns a random id that sealing assigns to the chunk, or 0 if it is not sealed. As sealed chunks are immutable,
+  // the id identifies their contents, also across processes. Checkpoints use it to skip chunks that they already hold.
+  uint64_t persistent_id() const;
+
+  // returns the minimum and maximum of the column, or std::nullopt if the chunk is not sealed, is empty, or the column
+  // is a ReferenceColumn
+  const std::optional<ColumnMinMax>& get_min_max(ColumnID column_id) const;
+
+  // Hands the columns of this sealed chunk over to the BufferManager, which may evict them to disk from now on. Evicted
+  // columns are loaded transparently by get_column. Does nothing if the chunk has ReferenceColumns.
+  void enable_eviction();
+  bool is_evictable() const;
+
+  // returns false if the columns have been evicted by the BufferManager
+  bool is_resident() const;
+
+  // returns the Bloom filter of the column, or nullptr if there is none
+  std::shared_ptr<const BloomFilter> get_bloom_filter(ColumnID column_id) const;
+  void set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter);
+
+  // returns the TrigramIndex of the column, or nullptr if there is none
+  std::shared_ptr<const TrigramIndex> get_trigram_index(ColumnID column_id) const;
+  void set_trigram_index(ColumnID column_id, std::shared_ptr<const TrigramIndex> trigram_index);
+
+  // returns the statistics of the chunk, or nullptr if there are none, see Table::enable_statistics
+  std::shared_ptr<const ChunkStatistics> get_statistics() const;
+  void set_statistics(std::shared_ptr<const ChunkStatistics> statistics);
+
+  // returns the approximate number of bytes occupied by the chunk and all of its columns
+  size_t estimate_memory_usage() const;
+
+  const PolymorphicAllocator<Chunk>& get_allocator() const;
+
+ protected:
+  PolymorphicAllocator<Chunk> _alloc;
+  pmr_vector<std::shared_ptr<BaseColumn>> _columns;
+  bool _is_sealed = false;
+  uint64_t _persistent_id = 0;
+
+  // either empty or one entry (possibly nullptr) per column
+  std::vector<std::shared_ptr<const BloomFilter>> _bloom_filters;
+  std::vector<std::shared_ptr<const TrigramIndex>> _trigram_indexes;
+  std::shared_ptr<const ChunkStatistics> _statistics;
+
+  // empty until the chunk is sealed, then one entry per column
+  std::vector<std::optional<ColumnMinMax>> _min_max;
+
+  std::vector<ColumnID> _sorted_by;
+
+  // set by enable_eviction, which moves the columns into the frame
+  std::shared_ptr<ChunkFrame> _frame;
+
+  friend class Checkpoint;
+  friend class ChunkPin;
+};
+
+/**
+ * While a ChunkPin exists, the columns of the chunk are resident, i.e., the BufferManager does not evict them.
+ * Operators pin chunks whose values they access through raw pointers or views (e.g., CompactValue::view), see
+ * ReferencedValues. Holding the shared_ptr of a column also keeps its values valid, but does not stop the BufferManager
+ * from counting them as evicted. Pinning a chunk whose eviction is not enabled does nothing.
+ */
+class ChunkPin : private Noncopyable {
+ public:
+  explicit ChunkPin(const Chunk& chunk);
+  ChunkPin(ChunkPin&& other) noexcept;
+  ~ChunkPin();
+
  protected:
-  std::vector<std::shared_ptr<BaseColumn>> _columns;
+  std::shared_ptr<ChunkFrame> _frame;
 };
 
 }  // namespace opossum
@@ -0,0 +1,118 @@
+#include "column_serializer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  auto value = T{};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+template <typename T>
+void write_values(std::ostream& stream, const pmr_vector<T>& values) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    for (const auto& value : values) {
+      write_value(stream, static_cast<uint64_t>(value.size()));
+      stream.write(value.data(), value.size());
+    }
+  } else {
+    stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+  }
+}
+
+template <typename T>
+void read_values(std::istream& stream, pmr_vector<T>& values) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    for (auto& value : values) {
+      value.resize(read_value<uint64_t>(stream));
+      stream.read(&value[0], value.size());
+    }
+  } else {
+    stream.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void ColumnSerializer::serialize(std::ostream& stream, const BaseColumn& column) {
+  write_value(stream, static_cast<uint8_t>(column.encoding_type()));
+  write_value(stream, static_cast<uint8_t>(column.data_type()));
+  write_value(stream, static_cast<uint64_t>(column.size()));
+
+  resolve_column_type(column, [&](auto, const auto& typed_column) {
+    if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+      write_value(stream, static_cast<uint64_t>(typed_column.unique_values_count()));
+      write_values(stream, typed_column.dictionary());
+      write_value(stream, static_cast<uint8_t>(typed_column.attribute_vector().width()));
+      resolve_attribute_vector(typed_column.attribute_vector(), [&](const auto& attribute_vector) {
+        write_values(stream, attribute_vector.value_ids());
+      });
+    } else {
+      write_values(stream, typed_column.values());
+    }
+  });
+  Assert(stream.good(), "Could not write column");
+}
+
+std::shared_ptr<BaseColumn> ColumnSerializer::deserialize(std::istream& stream,
+                                                          const PolymorphicAllocator<Chunk>& alloc) {
+  const auto encoding_type_index = read_value<uint8_t>(stream);
+  const auto data_type_index = read_value<uint8_t>(stream);
+  const auto size = read_value<uint64_t>(stream);
+  Assert(stream.good(), "Could not read column header");
+  Assert(encoding_type_index < static_cast<uint8_t>(EncodingType::Reference), "Invalid encoding type");
+  Assert(data_type_index <= static_cast<uint8_t>(DataType::String), "Invalid data type");
+
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(static_cast<DataType>(data_type_index), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if (static_cast<EncodingType>(encoding_type_index) == EncodingType::Unencoded) {
+      pmr_vector<ColumnDataType> values(size, PolymorphicAllocator<ColumnDataType>{alloc});
+      read_values(stream, values);
+      column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+      return;
+    }
+
+    const auto dictionary_size = read_value<uint64_t>(stream);
+    Assert(stream.good(), "Could not read dictionary size");
+    pmr_vector<ColumnDataType> dictionary(dictionary_size, PolymorphicAllocator<ColumnDataType>{alloc});
+    read_values(stream, dictionary);
+
+    const auto width = read_value<uint8_t>(stream);
+    Assert(stream.good() && width == fitted_attribute_vector_width(dictionary_size), "Invalid attribute vector width");
+    resolve_attribute_vector_width(width, [&](auto uint) {
+      using Uint = decltype(uint);
+      auto attribute_vector = std::make_shared<FittedAttributeVector<Uint>>(size, PolymorphicAllocator<Uint>{alloc});
+      read_values(stream, attribute_vector->value_ids());
+      column = std::make_shared<DictionaryColumn<ColumnDataType>>(std::move(dictionary), std::move(attribute_vector));
+    });
+  });
+  Assert(stream.good(), "Could not read column values");
+
+  return column;
+}
+
+}  // namespace opossum
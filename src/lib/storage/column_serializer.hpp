@@ -0,0 +1,29 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+/**
+ * ColumnSerializer writes ValueColumns and DictionaryColumns to and reads them from binary streams, e.g., to spill
+ * chunks to disk (see BufferManager). A column is stored as its EncodingType (1 byte), its DataType (1 byte), and its
+ * number of values (8 bytes), followed by the values. DictionaryColumns store their dictionary instead, i.e., its size
+ * (8 bytes) and its values, followed by the width of their attribute vector (1 byte) and the value ids. Numbers are
+ * stored in their in-memory representation, so the files are only meant to be read on the same platform. Strings are
+ * stored as their length (8 bytes) followed by their characters.
+ */
+class ColumnSerializer {
+ public:
+  static void serialize(std::ostream& stream, const BaseColumn& column);
+
+  // reads a column written by serialize. Fails if the stream ends prematurely.
+  static std::shared_ptr<BaseColumn> deserialize(std::istream& stream, const PolymorphicAllocator<Chunk>& alloc = {});
+};
+
+}  // namespace opossum
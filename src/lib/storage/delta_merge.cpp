@@ -0,0 +1,87 @@
+#include "delta_merge.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+#include "value_column.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::shared_ptr<BaseColumn> encode_column(const BaseColumn& column) {
+  std::shared_ptr<BaseColumn> encoded_column;
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& values = static_cast<const ValueColumn<ColumnDataType>&>(column).values();
+    encoded_column = std::make_shared<DictionaryColumn<ColumnDataType>>(values, values.get_allocator());
+  });
+  return encoded_column;
+}
+
+}  // namespace
+
+namespace opossum {
+
+DeltaMerge::DeltaMerge(const Table& table, const ChunkID begin) : _end(begin) {
+  for (; _end < table.chunk_count(); ++_end) {
+    const auto& chunk = table.get_chunk(_end);
+    if (!chunk.is_sealed()) break;
+    if (chunk.is_evictable()) continue;
+
+    auto columns = std::vector<std::shared_ptr<const BaseColumn>>{};
+    columns.reserve(chunk.col_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+      columns.push_back(chunk.get_column(column_id));
+    }
+    const auto is_delta = std::all_of(columns.cbegin(), columns.cend(), [](const auto& column) {
+      return column->encoding_type() == EncodingType::Unencoded;
+    });
+    if (is_delta) _chunks.push_back({_end, std::move(columns), {}});
+  }
+}
+
+void DeltaMerge::encode(const size_t worker_count) {
+  Assert(!_is_encoded, "Delta has already been encoded");
+
+  auto tasks = std::vector<std::pair<size_t, ColumnID>>{};
+  for (auto index = size_t{0}; index < _chunks.size(); ++index) {
+    auto& chunk = _chunks[index];
+    chunk.encoded_columns.resize(chunk.columns.size());
+    for (auto column_id = ColumnID{0}; column_id < chunk.columns.size(); ++column_id) {
+      tasks.emplace_back(index, column_id);
+    }
+  }
+
+  parallel_for(tasks.size(), worker_count, [&](const size_t index) {
+    auto& chunk = _chunks[tasks[index].first];
+    const auto column_id = tasks[index].second;
+    chunk.encoded_columns[column_id] = encode_column(*chunk.columns[column_id]);
+  });
+
+  _is_encoded = true;
+}
+
+void DeltaMerge::commit(Table& table) const {
+  Assert(_is_encoded, "Delta needs to be encoded before committing");
+  for (const auto& chunk_columns : _chunks) {
+    auto& chunk = table.get_chunk(chunk_columns.chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk_columns.encoded_columns.size(); ++column_id) {
+      DebugAssert(chunk.get_column(column_id) == chunk_columns.columns[column_id], "Column changed while merging");
+      chunk.replace_column(column_id, chunk_columns.encoded_columns[column_id]);
+    }
+  }
+}
+
+size_t DeltaMerge::chunk_count() const { return _chunks.size(); }
+
+ChunkID DeltaMerge::end() const { return _end; }
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Table;
+
+/**
+ * DeltaMerge moves the delta of a table, i.e., its sealed chunks whose columns are still ValueColumns, into the
+ * read-optimized main store by dictionary-encoding them (see DictionaryColumn). Every chunk has a dictionary of its
+ * own, so a merge never re-encodes the main store: its cost only depends on the size of the delta.
+ *
+ * Merging is split into two steps. The constructor captures the columns of the delta, which encode() then encodes
+ * without accessing the table, one (chunk, column) pair per task, in parallel. Thus, encoding can run in the background
+ * while rows are appended, see Table::enable_delta_merge. commit() swaps the encoded columns into the table (see
+ * Chunk::replace_column). As both columns hold the same values, readers see the same rows during and after the merge.
+ */
+class DeltaMerge : private Noncopyable {
+ public:
+  // Captures the sealed chunks from begin on whose columns are all ValueColumns. Chunks whose eviction is enabled (see
+  // Chunk::enable_eviction) are skipped, as their columns cannot be replaced.
+  DeltaMerge(const Table& table, ChunkID begin);
+
+  // encodes the captured columns, using up to worker_count threads (0 for one per hardware thread)
+  void encode(size_t worker_count = 0);
+
+  // replaces the captured columns of table, which encode() needs to have encoded, by the encoded ones
+  void commit(Table& table) const;
+
+  // returns the number of captured chunks
+  size_t chunk_count() const;
+
+  // returns the id of the first chunk after the delta, i.e., the number of chunks in the main store after committing
+  ChunkID end() const;
+
+ protected:
+  struct ChunkColumns {
+    ChunkID chunk_id;
+    std::vector<std::shared_ptr<const BaseColumn>> columns;
+    std::vector<std::shared_ptr<BaseColumn>> encoded_columns;
+  };
+
+  std::vector<ChunkColumns> _chunks;
+  ChunkID _end;
+  bool _is_encoded = false;
+};
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#include "dictionary_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fitted_attribute_vector.hpp"
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(const pmr_vector<T>& values, const PolymorphicAllocator<T>& alloc)
+    : _dictionary(alloc) {
+  // Sorting the positions by their values yields the dictionary and the value ids in a single pass afterwards, which
+  // compares values less often than looking up every value in the dictionary
+  auto positions = std::vector<ChunkOffset>(values.size());
+  std::iota(positions.begin(), positions.end(), ChunkOffset{0});
+  std::sort(positions.begin(), positions.end(),
+            [&](const auto lhs, const auto rhs) { return values[lhs] < values[rhs]; });
+
+  auto value_ids = std::vector<ValueID::base_type>(values.size());
+  for (const auto position : positions) {
+    if (_dictionary.empty() || _dictionary.back() < values[position]) _dictionary.push_back(values[position]);
+    value_ids[position] = static_cast<ValueID::base_type>(_dictionary.size() - 1);
+  }
+  _dictionary.shrink_to_fit();
+
+  resolve_attribute_vector_width(fitted_attribute_vector_width(_dictionary.size()), [&](auto uint) {
+    using Uint = decltype(uint);
+    auto attribute_vector =
+        std::make_shared<FittedAttributeVector<Uint>>(values.size(), PolymorphicAllocator<Uint>{alloc});
+    std::copy(value_ids.cbegin(), value_ids.cend(), attribute_vector->value_ids().begin());
+    _attribute_vector = std::move(attribute_vector);
+  });
+}
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(pmr_vector<T>&& dictionary,
+                                      std::shared_ptr<const BaseAttributeVector> attribute_vector)
+    : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {
+  DebugAssert(std::is_sorted(_dictionary.cbegin(), _dictionary.cend()), "Dictionary needs to be sorted");
+}
+
+template <typename T>
+const AllTypeVariant DictionaryColumn<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  return _dictionary.at(_attribute_vector->get(i));
+}
+
+template <typename T>
+CompactValue DictionaryColumn<T>::compact_value_at(const size_t i) const {
+  PerformanceWarning("compact_value_at used");
+  const auto& value = _dictionary.at(_attribute_vector->get(i));
+  if constexpr (std::is_same<T, std::string>::value) {
+    return CompactValue::view(value);
+  } else {
+    return CompactValue{value};
+  }
+}
+
+template <typename T>
+void DictionaryColumn<T>::append(const AllTypeVariant&) {
+  Fail("DictionaryColumn is immutable");
+}
+
+template <typename T>
+void DictionaryColumn<T>::append(const CompactValue&) {
+  Fail("DictionaryColumn is immutable");
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::size() const {
+  return _attribute_vector->size();
+}
+
+template <typename T>
+DataType DictionaryColumn<T>::data_type() const {
+  return data_type_from_type<T>();
+}
+
+template <typename T>
+EncodingType DictionaryColumn<T>::encoding_type() const {
+  return EncodingType::Dictionary;
+}
+
+template <typename T>
+const pmr_vector<T>& DictionaryColumn<T>::dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+const BaseAttributeVector& DictionaryColumn<T>::attribute_vector() const {
+  return *_attribute_vector;
+}
+
+template <typename T>
+const T& DictionaryColumn<T>::value_by_value_id(const ValueID value_id) const {
+  return _dictionary.at(value_id);
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::lower_bound(const T& value) const {
+  return ValueID{
+      static_cast<ValueID::base_type>(std::lower_bound(_dictionary.cbegin(), _dictionary.cend(), value) -
+                                      _dictionary.cbegin())};
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::upper_bound(const T& value) const {
+  return ValueID{
+      static_cast<ValueID::base_type>(std::upper_bound(_dictionary.cbegin(), _dictionary.cend(), value) -
+                                      _dictionary.cbegin())};
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::unique_values_count() const {
+  return _dictionary.size();
+}
+
+template <typename T>
+std::shared_ptr<ValueColumn<T>> DictionaryColumn<T>::decode() const {
+  auto values = pmr_vector<T>(PolymorphicAllocator<T>{_dictionary.get_allocator()});
+  values.reserve(size());
+  resolve_attribute_vector(*_attribute_vector, [&](const auto& attribute_vector) {
+    for (const auto value_id : attribute_vector.value_ids()) {
+      values.push_back(_dictionary[value_id]);
+    }
+  });
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _dictionary.capacity() * sizeof(T) + _attribute_vector->estimate_memory_usage();
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    // see ValueColumn::estimate_memory_usage
+    static const auto sso_capacity = std::string{}.capacity();
+    for (const auto& value : _dictionary) {
+      if (value.capacity() > sso_capacity) bytes += value.capacity() + 1;
+    }
+  }
+
+  return bytes;
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(DictionaryColumn);
+
+std::shared_ptr<const BaseColumn> decode_dictionary_column(std::shared_ptr<const BaseColumn> column) {
+  if (column->encoding_type() != EncodingType::Dictionary) return column;
+
+  resolve_data_type(column->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    column = static_cast<const DictionaryColumn<ColumnDataType>&>(*column).decode();
+  });
+  return column;
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueColumn;
+
+/**
+ * DictionaryColumn is the read-optimized, immutable counterpart of ValueColumn. It stores every distinct value once in
+ * a sorted dictionary and, for every position, the offset of its value in the dictionary (its value id) in an attribute
+ * vector, which uses 1, 2, or 4 bytes per value id depending on the size of the dictionary.
+ *
+ * As the dictionary is sorted, value ids compare like the values they stand for. Scans thus translate their search
+ * value into a value id once (see lower_bound and upper_bound) and only compare value ids afterwards.
+ *
+ * Tables dictionary-encode their sealed chunks when merging their delta into their main store, see Table::merge_delta.
+ */
+template <typename T>
+class DictionaryColumn : public BaseColumn {
+ public:
+  // encodes the values of a column, using alloc for the dictionary and the attribute vector
+  explicit DictionaryColumn(const pmr_vector<T>& values, const PolymorphicAllocator<T>& alloc = {});
+
+  // creates a column from an encoded dictionary and attribute vector, e.g., when reading it from disk
+  DictionaryColumn(pmr_vector<T>&& dictionary, std::shared_ptr<const BaseAttributeVector> attribute_vector);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position without copying strings. Also slow, but less so than operator[].
+  CompactValue compact_value_at(const size_t i) const override;
+
+  // DictionaryColumns are immutable
+  void append(const AllTypeVariant&) override;
+  void append(const CompactValue&) override;
+
+  size_t size() const override;
+
+  DataType data_type() const override;
+
+  EncodingType encoding_type() const override;
+
+  // returns the sorted, distinct values
+  const pmr_vector<T>& dictionary() const;
+
+  // returns the value id of every position, see resolve_attribute_vector() for efficient access
+  const BaseAttributeVector& attribute_vector() const;
+
+  const T& value_by_value_id(const ValueID value_id) const;
+
+  // Returns the first value id whose value is not smaller (lower_bound) or greater (upper_bound) than value. If there
+  // is none, unique_values_count() is returned.
+  ValueID lower_bound(const T& value) const;
+  ValueID upper_bound(const T& value) const;
+
+  size_t unique_values_count() const;
+
+  // returns a ValueColumn holding the values of this column
+  std::shared_ptr<ValueColumn<T>> decode() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  pmr_vector<T> _dictionary;
+  std::shared_ptr<const BaseAttributeVector> _attribute_vector;
+};
+
+// Returns column if it is a ValueColumn, or a ValueColumn holding its values if it is a DictionaryColumn. Operators
+// that need the values of a column in a contiguous array use this.
+std::shared_ptr<const BaseColumn> decode_dictionary_column(std::shared_ptr<const BaseColumn> column);
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Physical representation of a column. Used, e.g., to break down the memory consumption of a table.
+// Reference is not an encoding in the strict sense: ReferenceColumns store positions in another table, not values.
+enum class EncodingType : uint8_t { Unencoded, Dictionary, Reference };
+
+inline std::string encoding_type_to_string(const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return "Unencoded";
+    case EncodingType::Dictionary:
+      return "Dictionary";
+    case EncodingType::Reference:
+      return "Reference";
+  }
+  Fail("Unknown encoding type");
+  return "";
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Stores value ids in the smallest of uint8_t, uint16_t, and uint32_t that fits the dictionary of the column
+template <typename Uint>
+class FittedAttributeVector : public BaseAttributeVector {
+ public:
+  explicit FittedAttributeVector(const size_t size, const PolymorphicAllocator<Uint>& alloc = {})
+      : _value_ids(size, alloc) {}
+
+  ValueID get(const size_t i) const override { return ValueID{_value_ids.at(i)}; }
+
+  void set(const size_t i, const ValueID value_id) override {
+    DebugAssert(static_cast<ValueID::base_type>(value_id) <= std::numeric_limits<Uint>::max(),
+                "Value id does not fit into the attribute vector");
+    _value_ids.at(i) = static_cast<Uint>(value_id);
+  }
+
+  size_t size() const override { return _value_ids.size(); }
+
+  AttributeVectorWidth width() const override { return sizeof(Uint); }
+
+  size_t estimate_memory_usage() const override { return sizeof(*this) + _value_ids.capacity() * sizeof(Uint); }
+
+  // returns all value ids. This is the way to go for efficient operators, see resolve_attribute_vector().
+  const pmr_vector<Uint>& value_ids() const { return _value_ids; }
+  pmr_vector<Uint>& value_ids() { return _value_ids; }
+
+ protected:
+  pmr_vector<Uint> _value_ids;
+};
+
+// returns the smallest width in bytes that fits value ids up to dictionary_size - 1
+inline AttributeVectorWidth fitted_attribute_vector_width(const size_t dictionary_size) {
+  if (dictionary_size <= size_t{std::numeric_limits<uint8_t>::max()} + 1) return 1;
+  if (dictionary_size <= size_t{std::numeric_limits<uint16_t>::max()} + 1) return 2;
+  return 4;
+}
+
+/**
+ * Resolves a width by passing a value of the corresponding unsigned integer type on to a generic lambda:
+ *
+ *   resolve_attribute_vector_width(width, [&](auto uint) {
+ *     using Uint = decltype(uint);  // uint8_t, uint16_t, or uint32_t
+ *     ...
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector_width(const AttributeVectorWidth width, const Functor& func) {
+  switch (width) {
+    case 1:
+      func(uint8_t{});
+      return;
+    case 2:
+      func(uint16_t{});
+      return;
+    case 4:
+      func(uint32_t{});
+      return;
+  }
+  Fail("Unknown attribute vector width");
+}
+
+/**
+ * Resolves an attribute vector by passing it, cast to its FittedAttributeVector, on to a generic lambda:
+ *
+ *   resolve_attribute_vector(attribute_vector, [&](const auto& fitted_attribute_vector) {
+ *     const auto& value_ids = fitted_attribute_vector.value_ids();  // const pmr_vector<uint8_t>&, ...
+ *     ...
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  resolve_attribute_vector_width(attribute_vector.width(), [&](auto uint) {
+    using Uint = decltype(uint);
+    func(static_cast<const FittedAttributeVector<Uint>&>(attribute_vector));
+  });
+}
+
+}  // namespace opossum
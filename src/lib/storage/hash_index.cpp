@@ -0,0 +1,251 @@
+#include "hash_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bloom_filter.hpp"
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+HashIndex<T>::HashIndex(const size_t expected_key_count) {
+  _grow(expected_key_count);
+  _keys.reserve(expected_key_count);
+}
+
+template <typename T>
+void HashIndex<T>::lookup(const T& key, PosList& row_ids) const {
+  const auto hash = BloomFilter::hash_value(key);
+  const auto index = _find(key, hash, _position(hash));
+  if (index >= 0) _append_row_ids(_keys[index], row_ids);
+}
+
+template <typename T>
+void HashIndex<T>::lookup(const std::vector<T>& keys, PosList& row_ids, std::vector<size_t>& row_id_ends) const {
+  row_id_ends.reserve(row_id_ends.size() + keys.size());
+  auto hashes = std::array<uint64_t, BATCH_SIZE>{};
+  auto positions = std::array<size_t, BATCH_SIZE>{};
+  const auto mask = _slots.size() - 1;
+
+  for (auto begin = size_t{0}; begin < keys.size(); begin += BATCH_SIZE) {
+    const auto batch_size = std::min(BATCH_SIZE, keys.size() - begin);
+    for (auto index = size_t{0}; index < batch_size; ++index) {
+      hashes[index] = BloomFilter::hash_value(keys[begin + index]);
+      positions[index] = _position(hashes[index]);
+      __builtin_prefetch(&_slots[positions[index]]);
+    }
+
+    // The first slot with the fingerprint of a key most likely holds the key, so that key is prefetched as well
+    for (auto index = size_t{0}; index < batch_size; ++index) {
+      const auto fingerprint = _fingerprint(hashes[index]);
+      auto position = positions[index];
+      while (_slots[position].key_number != 0 && _slots[position].fingerprint != fingerprint) {
+        position = (position + 1) & mask;
+      }
+      positions[index] = position;
+      if (_slots[position].key_number != 0) __builtin_prefetch(&_keys[_slots[position].key_number - 1]);
+    }
+
+    for (auto index = size_t{0}; index < batch_size; ++index) {
+      const auto key_index = _find(keys[begin + index], hashes[index], positions[index]);
+      if (key_index >= 0) _append_row_ids(_keys[key_index], row_ids);
+      row_id_ends.push_back(row_ids.size());
+    }
+  }
+}
+
+template <typename T>
+PosList HashIndex<T>::lookup(const AllTypeVariant& key) const {
+  auto row_ids = PosList{};
+  lookup(type_cast<T>(key), row_ids);
+  return row_ids;
+}
+
+template <typename T>
+void HashIndex<T>::insert(const T& key, const RowID& row_id) {
+  _insert(key, row_id);
+}
+
+template <typename T>
+void HashIndex<T>::insert(const AllTypeVariant& key, const RowID& row_id) {
+  _insert(type_cast<T>(key), row_id);
+}
+
+template <typename T>
+void HashIndex<T>::insert(const CompactValue& key, const RowID& row_id) {
+  if (key.data_type() != data_type_from_type<T>()) {
+    // Slow path, values of a different type need to be converted
+    insert(key.to_variant(), row_id);
+  } else if constexpr (std::is_same<T, std::string>::value) {
+    // The string is only copied if the key is new
+    _insert(key.get<std::string_view>(), row_id);
+  } else {
+    _insert(key.get<T>(), row_id);
+  }
+}
+
+template <typename T>
+void HashIndex<T>::insert(const BaseColumn& column, const ChunkID chunk_id) {
+  if (column.encoding_type() == EncodingType::Dictionary) {
+    const auto& dictionary_column = static_cast<const DictionaryColumn<T>&>(column);
+    const auto& dictionary = dictionary_column.dictionary();
+    resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+      const auto& value_ids = attribute_vector.value_ids();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+        _insert(dictionary[value_ids[chunk_offset]], RowID{chunk_id, chunk_offset});
+      }
+    });
+    return;
+  }
+
+  Assert(column.encoding_type() == EncodingType::Unencoded, "Only ValueColumns and DictionaryColumns can be indexed");
+  const auto& values = static_cast<const ValueColumn<T>&>(column).values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    _insert(values[chunk_offset], RowID{chunk_id, chunk_offset});
+  }
+}
+
+template <typename T>
+void HashIndex<T>::reorder(const BaseColumn& column, const ChunkID chunk_id,
+                           const std::vector<ChunkOffset>& permutation) {
+  if (std::is_sorted(permutation.cbegin(), permutation.cend())) return;
+  Assert(column.encoding_type() == EncodingType::Unencoded, "Only chunks of ValueColumns are sorted");
+
+  auto new_offsets = std::vector<ChunkOffset>(permutation.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < permutation.size(); ++chunk_offset) {
+    new_offsets[permutation[chunk_offset]] = chunk_offset;
+  }
+
+  // As the rows of the chunk have been inserted last, their positions come first in the chain of every key. Every key
+  // is visited once, when its first row is encountered, and all of its rows are updated then.
+  const auto& values = static_cast<const ValueColumn<T>&>(column).values();
+  auto is_reordered = std::vector<bool>(values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    if (is_reordered[chunk_offset]) continue;
+
+    const auto hash = BloomFilter::hash_value(values[chunk_offset]);
+    const auto key_index = _find(values[chunk_offset], hash, _position(hash));
+    DebugAssert(key_index >= 0, "Rows of the chunk need to be indexed");
+
+    auto& key = _keys[key_index];
+    auto* row_id = &key.row_id;
+    auto previous = key.previous;
+    while (row_id->chunk_id == chunk_id) {
+      row_id->chunk_offset = new_offsets[row_id->chunk_offset];
+      is_reordered[row_id->chunk_offset] = true;
+      if (previous == 0) break;
+
+      auto& previous_row_id = _previous_row_ids[previous - 1];
+      row_id = &previous_row_id.row_id;
+      previous = previous_row_id.previous;
+    }
+  }
+}
+
+template <typename T>
+size_t HashIndex<T>::key_count() const {
+  return _keys.size();
+}
+
+template <typename T>
+size_t HashIndex<T>::row_count() const {
+  return _keys.size() + _previous_row_ids.size();
+}
+
+template <typename T>
+size_t HashIndex<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _slots.capacity() * sizeof(Slot) + _keys.capacity() * sizeof(Key) +
+               _previous_row_ids.capacity() * sizeof(PreviousRowID);
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    // see ValueColumn::estimate_memory_usage
+    static const auto sso_capacity = std::string{}.capacity();
+    for (const auto& key : _keys) {
+      if (key.value.capacity() > sso_capacity) bytes += key.value.capacity() + 1;
+    }
+  }
+
+  return bytes;
+}
+
+template <typename T>
+template <typename Value>
+int64_t HashIndex<T>::_find(const Value& value, const uint64_t hash, size_t position) const {
+  const auto fingerprint = _fingerprint(hash);
+  const auto mask = _slots.size() - 1;
+  for (;; position = (position + 1) & mask) {
+    const auto& slot = _slots[position];
+    if (slot.key_number == 0) return -1;
+    if (slot.fingerprint == fingerprint && _keys[slot.key_number - 1].value == value) return slot.key_number - 1;
+  }
+}
+
+template <typename T>
+template <typename Value>
+void HashIndex<T>::_insert(const Value& value, const RowID& row_id) {
+  if ((_keys.size() + 1) * 2 > _slots.size()) _grow(_keys.size() + 1);
+
+  const auto hash = BloomFilter::hash_value(value);
+  const auto fingerprint = _fingerprint(hash);
+  const auto mask = _slots.size() - 1;
+  for (auto position = _position(hash);; position = (position + 1) & mask) {
+    auto& slot = _slots[position];
+    if (slot.key_number == 0) {
+      Assert(_keys.size() < std::numeric_limits<uint32_t>::max(), "Too many keys");
+      slot = Slot{fingerprint, static_cast<uint32_t>(_keys.size() + 1)};
+      _keys.push_back(Key{T(value), row_id, 0});
+      return;
+    }
+
+    if (slot.fingerprint != fingerprint) continue;
+    auto& key = _keys[slot.key_number - 1];
+    if (key.value != value) continue;
+
+    Assert(_previous_row_ids.size() < std::numeric_limits<uint32_t>::max(), "Too many rows");
+    _previous_row_ids.push_back(PreviousRowID{key.row_id, key.previous});
+    key.row_id = row_id;
+    key.previous = static_cast<uint32_t>(_previous_row_ids.size());
+    return;
+  }
+}
+
+template <typename T>
+void HashIndex<T>::_append_row_ids(const Key& key, PosList& row_ids) const {
+  row_ids.push_back(key.row_id);
+  for (auto previous = key.previous; previous != 0; previous = _previous_row_ids[previous - 1].previous) {
+    row_ids.push_back(_previous_row_ids[previous - 1].row_id);
+  }
+}
+
+template <typename T>
+void HashIndex<T>::_grow(const size_t key_count) {
+  auto slot_count = std::max(_slots.size(), size_t{16});
+  while (slot_count < key_count * 2) {
+    slot_count *= 2;
+  }
+  if (slot_count == _slots.size()) return;
+
+  _slots = std::vector<Slot>(slot_count);
+  const auto mask = slot_count - 1;
+  for (auto key_index = size_t{0}; key_index < _keys.size(); ++key_index) {
+    const auto hash = BloomFilter::hash_value(_keys[key_index].value);
+    auto position = _position(hash);
+    while (_slots[position].key_number != 0) {
+      position = (position + 1) & mask;
+    }
+    _slots[position] = Slot{_fingerprint(hash), static_cast<uint32_t>(key_index + 1)};
+  }
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(HashIndex);
+
+}  // namespace opossum
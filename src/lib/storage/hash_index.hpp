@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "compact_value.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BaseHashIndex is the type-independent interface of HashIndex, through which Table maintains its indexes
+class BaseHashIndex : private Noncopyable {
+ public:
+  virtual ~BaseHashIndex() = default;
+
+  // returns the positions of all rows holding key, which is converted to the type of the column, in unspecified order
+  virtual PosList lookup(const AllTypeVariant& key) const = 0;
+
+  // adds the row at row_id, which holds key
+  virtual void insert(const AllTypeVariant& key, const RowID& row_id) = 0;
+  virtual void insert(const CompactValue& key, const RowID& row_id) = 0;
+
+  // adds all rows of the chunk chunk_id, whose column is given, which needs to be a ValueColumn or a DictionaryColumn
+  virtual void insert(const BaseColumn& column, ChunkID chunk_id) = 0;
+
+  // Updates the positions of the rows of chunk chunk_id after Chunk::sort moved the row at permutation[offset] to
+  // offset. column is the sorted column of the chunk. The rows of the chunk need to be the last ones inserted.
+  virtual void reorder(const BaseColumn& column, ChunkID chunk_id, const std::vector<ChunkOffset>& permutation) = 0;
+
+  // returns the number of distinct keys
+  virtual size_t key_count() const = 0;
+
+  // returns the number of rows, i.e., positions, in the index
+  virtual size_t row_count() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+/**
+ * HashIndex maps the values of a column to the positions of the rows holding them, across all chunks of a table (see
+ * Table::enable_hash_index). It is a hash table with open addressing and linear probing, whose slots are pairs of four
+ * bytes each: the upper half of the key's hash (the fingerprint) and the number of the key. The keys are stored in a
+ * separate array together with the position of the latest row holding them, so that looking up a unique key usually
+ * touches one slot and one key. The positions of further rows holding the same key are chained in a third array.
+ *
+ * Batched lookups hash all keys first and prefetch their slots and keys, so that the cache misses of different keys
+ * overlap instead of being waited for one after another.
+ */
+template <typename T>
+class HashIndex : public BaseHashIndex {
+ public:
+  // the number of keys that are looked up together by the batched lookup
+  static constexpr size_t BATCH_SIZE = 16;
+
+  // reserves space for expected_key_count distinct keys
+  explicit HashIndex(size_t expected_key_count = 0);
+
+  // appends the positions of all rows holding key to row_ids
+  void lookup(const T& key, PosList& row_ids) const;
+
+  // Appends the positions of the rows holding every key to row_ids, key by key, and for every key the size of row_ids
+  // after its positions to row_id_ends. This way, the positions of keys[index] range from row_id_ends[index - 1] (or 0)
+  // to row_id_ends[index].
+  void lookup(const std::vector<T>& keys, PosList& row_ids, std::vector<size_t>& row_id_ends) const;
+
+  PosList lookup(const AllTypeVariant& key) const override;
+
+  void insert(const T& key, const RowID& row_id);
+  void insert(const AllTypeVariant& key, const RowID& row_id) override;
+  void insert(const CompactValue& key, const RowID& row_id) override;
+  void insert(const BaseColumn& column, ChunkID chunk_id) override;
+
+  void reorder(const BaseColumn& column, ChunkID chunk_id, const std::vector<ChunkOffset>& permutation) override;
+
+  size_t key_count() const override;
+  size_t row_count() const override;
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  struct Slot {
+    uint32_t fingerprint = 0;
+    // index of the key in _keys plus one, or 0 if the slot is empty
+    uint32_t key_number = 0;
+  };
+
+  struct Key {
+    T value;
+    RowID row_id;
+    // index of the position of the previous row holding the key in _previous_row_ids plus one, or 0 if there is none
+    uint32_t previous = 0;
+  };
+
+  struct PreviousRowID {
+    RowID row_id;
+    uint32_t previous = 0;
+  };
+
+  // Returns the index of the key in _keys, or -1 if there is none. The probe begins at the slot at position, which
+  // needs to be at or before the key's slot in its probing sequence.
+  template <typename Value>
+  int64_t _find(const Value& value, uint64_t hash, size_t position) const;
+
+  template <typename Value>
+  void _insert(const Value& value, const RowID& row_id);
+
+  void _append_row_ids(const Key& key, PosList& row_ids) const;
+
+  // doubles the number of slots until the keys fill at most half of them
+  void _grow(size_t key_count);
+
+  size_t _position(const uint64_t hash) const { return hash & (_slots.size() - 1); }
+  static uint32_t _fingerprint(const uint64_t hash) { return static_cast<uint32_t>(hash >> 32); }
+
+  std::vector<Slot> _slots;
+  std::vector<Key> _keys;
+  std::vector<PreviousRowID> _previous_row_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include "reference_column.hpp"
+
+#include <memory>
+#include <string>
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  Assert(referenced_column_id < referenced_table->col_count(), "Referenced column does not exist");
+}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  const auto& row_id = _pos_list->at(i);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(_referenced_column_id))[row_id.chunk_offset];
+}
+
+CompactValue ReferenceColumn::compact_value_at(const size_t i) const {
+  PerformanceWarning("compact_value_at used");
+  const auto& row_id = _pos_list->at(i);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return chunk.get_column(_referenced_column_id)->compact_value_at(row_id.chunk_offset);
+}
+
+void ReferenceColumn::append(const AllTypeVariant&) { Fail("ReferenceColumn is immutable"); }
+
+void ReferenceColumn::append(const CompactValue&) { Fail("ReferenceColumn is immutable"); }
+
+size_t ReferenceColumn::size() const { return _pos_list->size(); }
+
+DataType ReferenceColumn::data_type() const { return _referenced_table->column_data_type(_referenced_column_id); }
+
+EncodingType ReferenceColumn::encoding_type() const { return EncodingType::Reference; }
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
+
+size_t ReferenceColumn::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(PosList) + _pos_list->capacity() * sizeof(RowID);
+}
+
+}  // namespace opossum
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_column.hpp"
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+// ReferenceColumn is a specific column type that stores all its values as position list of a referenced column.
+// Usually, all ReferenceColumns of a chunk share the same position list.
+class ReferenceColumn : public BaseColumn {
+ public:
+  // creates a reference column
+  // the parameters specify the positions and the referenced column
+  ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                  const std::shared_ptr<const PosList> pos);
+
+  // returns the referenced value. Even slower than ValueColumn::operator[], use Materialize instead.
+  const AllTypeVariant operator[](const size_t i) const override;
+  CompactValue compact_value_at(const size_t i) const override;
+
+  // ReferenceColumns are immutable
+  void append(const AllTypeVariant&) override;
+  void append(const CompactValue&) override;
+
+  size_t size() const override;
+
+  DataType data_type() const override;
+  EncodingType encoding_type() const override;
+
+  const std::shared_ptr<const PosList> pos_list() const;
+  const std::shared_ptr<const Table> referenced_table() const;
+  ColumnID referenced_column_id() const;
+
+  // includes the position list, even though it is usually shared with other ReferenceColumns
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+// The type-independent interface of ReferencedValues, which lets ReferencedValuesByColumn hold them
+class BaseReferencedValues : private Noncopyable {
+ public:
+  virtual ~BaseReferencedValues() = default;
+};
+
+// Provides the values of column column_id of table by their position, where the column needs to be a ValueColumn or a
+// DictionaryColumn in every chunk. This way, the values that a PosList refers to can be accessed without resolving the
+// column for every position. A chunk is resolved when one of its values is accessed for the first time, so that
+// evicted chunks (see BufferManager) that no position refers to are not loaded. From then on, the chunk is pinned (see
+// ChunkPin) and its column is held while the object exists, so that the pointers stay valid, also if
+// Table::merge_delta replaces the columns meanwhile. The table needs to outlive the object. Since chunks are resolved
+// by const accessors, an object must not be used by multiple threads.
+template <typename T>
+class ReferencedValues : public BaseReferencedValues {
+ public:
+  ReferencedValues(const Table& table, const ColumnID column_id)
+      : _table(table), _column_id(column_id), _values_by_chunk(table.chunk_count()) {}
+
+  // returns the value at the position
+  const T& operator[](const RowID& row_id) const {
+    const auto& chunk_values = _chunk_values(row_id);
+    switch (chunk_values.value_id_width) {
+      case 0:
+        return chunk_values.values[row_id.chunk_offset];
+      case 1:
+        return chunk_values.values[static_cast<const uint8_t*>(chunk_values.value_ids)[row_id.chunk_offset]];
+      case 2:
+        return chunk_values.values[static_cast<const uint16_t*>(chunk_values.value_ids)[row_id.chunk_offset]];
+      default:
+        return chunk_values.values[static_cast<const uint32_t*>(chunk_values.value_ids)[row_id.chunk_offset]];
+    }
+  }
+
+  // prefetches the value at the position or, for DictionaryColumns, its value id
+  void prefetch(const RowID& row_id) const {
+    const auto& chunk_values = _chunk_values(row_id);
+    if (chunk_values.value_id_width == 0) {
+      __builtin_prefetch(chunk_values.values + row_id.chunk_offset);
+    } else {
+      __builtin_prefetch(static_cast<const char*>(chunk_values.value_ids) +
+                         size_t{row_id.chunk_offset} * chunk_values.value_id_width);
+    }
+  }
+
+  size_t size() const { return _values_by_chunk.size(); }
+
+ protected:
+  // For ValueColumns, values holds the values of the chunk. For DictionaryColumns, it holds the dictionary, and
+  // value_ids the attribute vector, whose width is given in bytes.
+  struct ChunkValues {
+    bool is_resolved = false;
+    const T* values = nullptr;
+    const void* value_ids = nullptr;
+    AttributeVectorWidth value_id_width = 0;
+    ChunkOffset size = 0;
+  };
+
+  const ChunkValues& _chunk_values(const RowID& row_id) const {
+    DebugAssert(row_id.chunk_id < _values_by_chunk.size(), "RowID out of range");
+    auto& chunk_values = _values_by_chunk[row_id.chunk_id];
+    if (!chunk_values.is_resolved) _resolve(row_id.chunk_id, chunk_values);
+    DebugAssert(row_id.chunk_offset < chunk_values.size, "RowID out of range");
+    return chunk_values;
+  }
+
+  void _resolve(const ChunkID chunk_id, ChunkValues& chunk_values) const {
+    const auto& chunk = _table.get_chunk(chunk_id);
+    _pins.emplace_back(chunk);
+    const auto column = chunk.get_column(_column_id);
+    _columns.push_back(column);
+
+    if (column->encoding_type() == EncodingType::Dictionary) {
+      const auto& dictionary_column = static_cast<const DictionaryColumn<T>&>(*column);
+      chunk_values.values = dictionary_column.dictionary().data();
+      chunk_values.value_id_width = dictionary_column.attribute_vector().width();
+      resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+        chunk_values.value_ids = attribute_vector.value_ids().data();
+      });
+    } else {
+      Assert(column->encoding_type() == EncodingType::Unencoded,
+             "Only ValueColumns and DictionaryColumns can be referenced");
+      chunk_values.values = static_cast<const ValueColumn<T>&>(*column).values().data();
+    }
+    chunk_values.size = static_cast<ChunkOffset>(column->size());
+    chunk_values.is_resolved = true;
+  }
+
+  const Table& _table;
+  const ColumnID _column_id;
+
+  // filled as chunks are resolved
+  mutable std::vector<ChunkPin> _pins;
+  mutable std::vector<std::shared_ptr<const BaseColumn>> _columns;
+  mutable std::vector<ChunkValues> _values_by_chunk;
+};
+
+// Holds one ReferencedValues per referenced column, so that an operator whose input chunks refer to the same column
+// resolves every referenced chunk at most once instead of once per input chunk. The referenced tables need to outlive
+// the object, which the ReferenceColumns of the input ensure. Like ReferencedValues, it must not be shared by threads.
+class ReferencedValuesByColumn : private Noncopyable {
+ public:
+  template <typename T>
+  const ReferencedValues<T>& get(const ReferenceColumn& reference_column) {
+    const auto& referenced_table = *reference_column.referenced_table();
+    const auto referenced_column_id = reference_column.referenced_column_id();
+    auto& referenced_values = _referenced_values[std::make_pair(&referenced_table, referenced_column_id)];
+    if (!referenced_values) {
+      referenced_values = std::make_unique<ReferencedValues<T>>(referenced_table, referenced_column_id);
+    }
+    return static_cast<const ReferencedValues<T>&>(*referenced_values);
+  }
+
+ protected:
+  std::map<std::pair<const Table*, ColumnID>, std::unique_ptr<BaseReferencedValues>> _referenced_values;
+};
+
+}  // namespace opossum
@@ -1,7 +1,9 @@
 #include "storage_manager.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,6 +12,11 @@
 
 namespace opossum {
 
+size_t ColumnMemoryUsage::bytes() const {
+  return std::accumulate(bytes_by_encoding.cbegin(), bytes_by_encoding.cend(), size_t{0},
+                         [](auto acc, const auto& encoding_and_bytes) { return acc + encoding_and_bytes.second; });
+}
+
 StorageManager& StorageManager::get() {
   static StorageManager _instance;
   return _instance;
@@ -31,7 +38,8 @@ bool StorageManager::has_table(const std::string& name) const { return _tables.c
 
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> names;
-  std::transform(_tables.cbegin(), _tables.cend(), names.begin(),
+  names.reserve(_tables.size());
+  std::transform(_tables.cbegin(), _tables.cend(), std::back_inserter(names),
                  [](const auto& key_value) { return key_value.first; });
   return names;
 }
@@ -44,6 +52,58 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
+std::vector<TableMemoryUsage> StorageManager::memory_usage() const {
+  std::vector<TableMemoryUsage> report;
+  report.reserve(_tables.size());
+
+  for (const auto& key_value : _tables) {
+    const Table& table = *(key_value.second);
+
+    auto table_usage = TableMemoryUsage{key_value.first, table.row_count(), table.chunk_count(),
+                                        table.estimate_memory_usage(), {}};
+
+    table_usage.columns.reserve(table.col_count());
+    for (auto column_id = ColumnID{0}; column_id < table.col_count(); ++column_id) {
+      auto column_usage = ColumnMemoryUsage{table.column_name(column_id), table.column_type(column_id), {}};
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto& chunk = table.get_chunk(chunk_id);
+
+        // an empty table's chunk might be missing actual columns, evicted columns do not occupy memory
+        if (column_id >= chunk.col_count() || !chunk.is_resident()) continue;
+
+        const auto column = chunk.get_column(column_id);
+        column_usage.bytes_by_encoding[column->encoding_type()] += column->estimate_memory_usage();
+      }
+
+      table_usage.columns.emplace_back(std::move(column_usage));
+    }
+
+    report.emplace_back(std::move(table_usage));
+  }
+
+  return report;
+}
+
+size_t StorageManager::estimate_memory_usage() const {
+  return std::accumulate(_tables.cbegin(), _tables.cend(), size_t{0}, [](auto acc, const auto& key_value) {
+    return acc + key_value.second->estimate_memory_usage();
+  });
+}
+
+void StorageManager::print_memory_usage(std::ostream& out) const {
+  for (const auto& table_usage : memory_usage()) {
+    out << table_usage.name << "\t" << table_usage.row_count << "\t" << table_usage.chunk_count << "\t"
+        << table_usage.bytes << "\n";
+    for (const auto& column_usage : table_usage.columns) {
+      for (const auto& encoding_and_bytes : column_usage.bytes_by_encoding) {
+        out << "\t" << column_usage.name << "\t" << column_usage.type << "\t"
+            << encoding_type_to_string(encoding_and_bytes.first) << "\t" << encoding_and_bytes.second << "\n";
+      }
+    }
+  }
+}
+
 void StorageManager::reset() { get() = StorageManager{}; }
 
 }  // namespace opossum
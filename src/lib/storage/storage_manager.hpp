@@ -11,6 +11,29 @@
 
 namespace opossum {
 
+// Memory consumption of a single column of a table, summed up over all chunks
+struct ColumnMemoryUsage {
+  std::string name;
+  std::string type;
+
+  // chunks may store the same column in different encodings
+  std::map<EncodingType, size_t> bytes_by_encoding;
+
+  size_t bytes() const;
+};
+
+// Memory consumption of a table, as reported by StorageManager::memory_usage()
+struct TableMemoryUsage {
+  std::string name;
+  uint64_t row_count;
+  ChunkID chunk_count;
+
+  // includes the overhead of the table and chunk objects, thus exceeding the sum of the columns' bytes
+  size_t bytes;
+
+  std::vector<ColumnMemoryUsage> columns;
+};
+
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
 class StorageManager : private Noncopyable {
@@ -35,6 +58,15 @@ class StorageManager : private Noncopyable {
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
+  // returns the estimated memory consumption of all tables, broken down by column and encoding
+  std::vector<TableMemoryUsage> memory_usage() const;
+
+  // returns the estimated memory consumption of all tables in bytes
+  size_t estimate_memory_usage() const;
+
+  // prints the memory report of memory_usage(), one line per table and per column and encoding
+  void print_memory_usage(std::ostream& out = std::cout) const;
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   static void reset();
 
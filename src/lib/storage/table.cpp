@@ -1,6 +1,8 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <iomanip>
 #include <limits>
 #include <memory>
@@ -9,19 +11,30 @@
 #include <utility>
 #include <vector>
 
+#include "bloom_filter.hpp"
+#include "delta_merge.hpp"
+#include "hash_index.hpp"
+#include "trigram_index.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunk_size{chunk_size}, _chunks{}, _column_names{}, _column_types{} {
+Table::Table(const uint32_t chunk_size, const PolymorphicAllocator<Chunk>& alloc)
+    : _chunk_size{chunk_size}, _alloc{alloc}, _chunks{}, _column_names{}, _column_types{}, _column_data_types{} {
   create_new_chunk();
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
+  add_column_definition(name, data_type_from_string(type));
+}
+
+void Table::add_column_definition(const std::string& name, DataType data_type) {
   auto nonEmptyErrorMessage = "Column definition modification may only take place on an empty table";
   Assert(_chunks.size() == 1, nonEmptyErrorMessage);
   Assert(_chunks.front().size() == 0, nonEmptyErrorMessage);
@@ -31,7 +44,9 @@ void Table::add_column_definition(const std::string& name, const std::string& ty
          "Too many columns");
 
   _column_names.emplace_back(name);
-  _column_types.emplace_back(type);
+  _column_types.emplace_back(data_type_to_string(data_type));
+  _column_data_types.emplace_back(data_type);
+  ++_version;
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
@@ -39,26 +54,270 @@ void Table::add_column(const std::string& name, const std::string& type) {
   _create_missing_columns();
 }
 
+void Table::add_column(const std::string& name, DataType data_type) {
+  add_column_definition(name, data_type);
+  _create_missing_columns();
+}
+
 void Table::append(std::vector<AllTypeVariant> values) {
   if (!_chunk_matches_definitions()) {
     _create_missing_columns();
   }
-  if (_chunk_size != 0 && _chunks.back().size() >= _chunk_size) {
+  if (_chunks.back().is_sealed()) {
     create_new_chunk();
   }
   _chunks.back().append(values);
+  ++_version;
+  for (const auto& [column_id, hash_index] : _hash_indexes) {
+    hash_index->insert(values[column_id], RowID{ChunkID{chunk_count() - 1}, _chunks.back().size() - 1});
+  }
+  if (_chunk_size != 0 && _chunks.back().size() >= _chunk_size) {
+    seal_last_chunk();
+  }
+}
+
+void Table::append_compact(const std::vector<CompactValue>& values) {
+  if (!_chunk_matches_definitions()) {
+    _create_missing_columns();
+  }
+  if (_chunks.back().is_sealed()) {
+    create_new_chunk();
+  }
+  _chunks.back().append_compact(values);
+  ++_version;
+  for (const auto& [column_id, hash_index] : _hash_indexes) {
+    hash_index->insert(values[column_id], RowID{ChunkID{chunk_count() - 1}, _chunks.back().size() - 1});
+  }
+  if (_chunk_size != 0 && _chunks.back().size() >= _chunk_size) {
+    seal_last_chunk();
+  }
 }
 
 void Table::create_new_chunk() {
   Assert(_chunks.size() == 0 || _chunks.back().size() > 0, "Cannot create chunk on top of empty chunk");
   DebugAssert(_chunk_matches_definitions(), "Creating a new chunk implies that column modifications are synchronized");
 
-  _chunks.emplace_back();
+  if (!_chunks.empty()) seal_last_chunk();
+
+  _chunks.emplace_back(_alloc);
+  ++_version;
 
   // Automatically populates the empty new chunk with the specified column definitions
   _create_missing_columns();
 }
 
+void Table::emplace_chunk(Chunk chunk) {
+  Assert(chunk.col_count() == col_count(), "Chunk does not match the column definitions");
+  if (_chunks.size() == 1 && _chunks.back().size() == 0) {
+    _chunks.back() = std::move(chunk);
+  } else {
+    seal_last_chunk();
+    _chunks.emplace_back(std::move(chunk));
+  }
+  ++_version;
+
+  for (const auto& [column_id, hash_index] : _hash_indexes) {
+    hash_index->insert(*_chunks.back().get_column(column_id), ChunkID{chunk_count() - 1});
+  }
+}
+
+void Table::seal_last_chunk() {
+  auto& last_chunk = _chunks.back();
+  if (last_chunk.is_sealed() || last_chunk.size() == 0) return;
+
+  if (!_clustering_column_ids.empty()) {
+    const auto permutation = last_chunk.sort(_clustering_column_ids);
+    for (const auto& [column_id, hash_index] : _hash_indexes) {
+      hash_index->reorder(*last_chunk.get_column(column_id), ChunkID{chunk_count() - 1}, permutation);
+    }
+  }
+  _build_bloom_filters(last_chunk);
+  _build_trigram_indexes(last_chunk);
+  if (_statistics) {
+    // The copy shares the sketches, which are only copied when the chunk is added if a reader still holds them
+    auto statistics = std::make_shared<TableStatistics>(*_statistics);
+    _statistics = nullptr;
+    _reset_unsealed_statistics();
+    _add_chunk_statistics(last_chunk, *statistics);
+    // Rebuilding the histograms once the table has doubled in size keeps their cost proportional to the appended rows
+    if (statistics->row_count() >= 2 * statistics->histogram_row_count()) statistics->build_histograms(*this);
+    _statistics = std::move(statistics);
+  }
+  last_chunk.seal();
+  ++_version;
+  if (_max_delta_chunk_count == 0) {
+    if (_is_eviction_enabled) last_chunk.enable_eviction();
+    return;
+  }
+
+  // With the delta merge enabled, chunks become evictable once they are merged, see _commit_delta_merge
+  _merge_delta_in_background();
+}
+
+void Table::enable_bloom_filter(ColumnID column_id, const double false_positive_rate) {
+  Assert(column_id < col_count(), "Column does not exist");
+  _bloom_filter_false_positive_rates[column_id] = false_positive_rate;
+
+  for (auto& chunk : _chunks) {
+    if (chunk.is_sealed()) _build_bloom_filters(chunk);
+  }
+}
+
+void Table::enable_trigram_index(const ColumnID column_id) {
+  Assert(column_id < col_count(), "Column does not exist");
+  Assert(column_data_type(column_id) == DataType::String, "Only string columns can have a trigram index");
+  _trigram_index_column_ids.insert(column_id);
+
+  for (auto& chunk : _chunks) {
+    if (chunk.is_sealed()) _build_trigram_indexes(chunk);
+  }
+}
+
+void Table::enable_statistics() {
+  if (_statistics) return;
+
+  auto statistics = std::make_shared<TableStatistics>(_column_data_types);
+  for (auto& chunk : _chunks) {
+    if (chunk.is_sealed()) _add_chunk_statistics(chunk, *statistics);
+  }
+  statistics->build_histograms(*this);
+  _statistics = std::move(statistics);
+  _reset_unsealed_statistics();
+}
+
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  const auto& last_chunk = _chunks.back();
+  if (!_statistics || last_chunk.is_sealed() || last_chunk.size() == 0) return _statistics;
+  if (last_chunk.get_column(ColumnID{0})->encoding_type() == EncodingType::Reference) return _statistics;
+
+  // The statistics of the last chunk are not kept, as it may still change, but reused until the table changes
+  auto& cache = *_unsealed_statistics;
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (!cache.statistics || cache.version != _version) {
+    auto statistics = std::make_shared<TableStatistics>(*_statistics);
+    statistics->add_chunk(last_chunk, *ChunkStatistics::build(last_chunk));
+    cache.statistics = std::move(statistics);
+    cache.version = _version;
+  }
+  return cache.statistics;
+}
+
+void Table::enable_clustering(const std::vector<ColumnID>& column_ids) {
+  Assert(!column_ids.empty(), "Clustering needs at least one column");
+  for (const auto& column_id : column_ids) {
+    Assert(column_id < col_count(), "Column does not exist");
+  }
+  _clustering_column_ids = column_ids;
+}
+
+void Table::enable_hash_index(const ColumnID column_id) {
+  Assert(column_id < col_count(), "Column does not exist");
+  if (_hash_indexes.count(column_id)) return;
+
+  auto hash_index = make_shared_by_column_type<BaseHashIndex, HashIndex>(_column_data_types[column_id], row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    hash_index->insert(*_chunks[chunk_id].get_column(column_id), chunk_id);
+  }
+  _hash_indexes.emplace(column_id, std::move(hash_index));
+}
+
+std::shared_ptr<const BaseHashIndex> Table::get_hash_index(const ColumnID column_id) const {
+  const auto iter = _hash_indexes.find(column_id);
+  return iter != _hash_indexes.cend() ? iter->second : nullptr;
+}
+
+void Table::enable_eviction() {
+  _is_eviction_enabled = true;
+  const auto evictable_chunk_count = _max_delta_chunk_count == 0 ? chunk_count() : _main_chunk_count;
+  for (auto chunk_id = ChunkID{0}; chunk_id < evictable_chunk_count; ++chunk_id) {
+    if (_chunks[chunk_id].is_sealed()) _chunks[chunk_id].enable_eviction();
+  }
+}
+
+void Table::merge_delta() {
+  if (_delta_merge) _commit_delta_merge();
+
+  _delta_merge = std::make_shared<DeltaMerge>(*this, _main_chunk_count);
+  _delta_merge->encode();
+  _commit_delta_merge();
+}
+
+void Table::enable_delta_merge(const ChunkID max_delta_chunk_count) {
+  Assert(max_delta_chunk_count > 0, "The delta needs to hold at least one chunk to be merged");
+  _max_delta_chunk_count = max_delta_chunk_count;
+  _merge_delta_in_background();
+}
+
+ChunkID Table::main_chunk_count() const { return _main_chunk_count; }
+
+uint64_t Table::version() const { return _version; }
+
+void Table::_merge_delta_in_background() {
+  if (_delta_merge && _delta_merge_encoded.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+    _commit_delta_merge();
+  }
+
+  const auto sealed_chunk_count = _chunks.back().is_sealed() ? chunk_count() : ChunkID{chunk_count() - 1};
+  const auto delta_begin = _delta_merge ? _delta_merge->end() : _main_chunk_count;
+  if (sealed_chunk_count < delta_begin + _max_delta_chunk_count) return;
+
+  // Only one merge runs at a time, as every merge begins where the previous one ends
+  if (_delta_merge) _commit_delta_merge();
+
+  _delta_merge = std::make_shared<DeltaMerge>(*this, _main_chunk_count);
+  _delta_merge_encoded = std::async(std::launch::async, [delta_merge = _delta_merge]() { delta_merge->encode(); });
+}
+
+void Table::_commit_delta_merge() {
+  // Rethrows errors of a background merge
+  if (_delta_merge_encoded.valid()) _delta_merge_encoded.get();
+
+  const auto delta_merge = std::move(_delta_merge);
+  _delta_merge = nullptr;
+  delta_merge->commit(*this);
+
+  if (_is_eviction_enabled) {
+    for (auto chunk_id = _main_chunk_count; chunk_id < delta_merge->end(); ++chunk_id) {
+      _chunks[chunk_id].enable_eviction();
+    }
+  }
+  _main_chunk_count = delta_merge->end();
+}
+
+void Table::_build_bloom_filters(Chunk& chunk) const {
+  for (const auto& column_id_and_rate : _bloom_filter_false_positive_rates) {
+    const auto column_id = column_id_and_rate.first;
+    if (chunk.get_bloom_filter(column_id)) continue;
+
+    const auto column = chunk.get_column(column_id);
+    if (column->encoding_type() == EncodingType::Reference) continue;
+    chunk.set_bloom_filter(column_id, BloomFilter::build(*column, column_id_and_rate.second));
+  }
+}
+
+void Table::_build_trigram_indexes(Chunk& chunk) const {
+  for (const auto& column_id : _trigram_index_column_ids) {
+    if (chunk.get_trigram_index(column_id)) continue;
+
+    const auto column = chunk.get_column(column_id);
+    if (column->encoding_type() == EncodingType::Reference) continue;
+    chunk.set_trigram_index(column_id, TrigramIndex::build(*column));
+  }
+}
+
+void Table::_reset_unsealed_statistics() {
+  std::lock_guard<std::mutex> lock(_unsealed_statistics->mutex);
+  _unsealed_statistics->statistics = nullptr;
+}
+
+void Table::_add_chunk_statistics(Chunk& chunk, TableStatistics& statistics) const {
+  if (chunk.col_count() > 0 && chunk.get_column(ColumnID{0})->encoding_type() == EncodingType::Reference) return;
+
+  const auto chunk_statistics = ChunkStatistics::build(chunk);
+  statistics.add_chunk(chunk, *chunk_statistics);
+  chunk.set_statistics(chunk_statistics);
+}
+
 void Table::_create_missing_columns() {
   DebugAssert(_column_names.size() == _column_types.size(), "Every column needs a name and type");
 
@@ -68,8 +327,9 @@ void Table::_create_missing_columns() {
   // our stored definition
   auto first_missing_column_index = last_chunk.col_count();
 
-  for (auto index = first_missing_column_index; index < _column_types.size(); ++index) {
-    auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(_column_types[index]);
+  for (auto index = first_missing_column_index; index < _column_data_types.size(); ++index) {
+    auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(_column_data_types[index],
+                                                                      last_chunk.get_allocator(), _chunk_size);
     last_chunk.add_column(column);
   }
 }
@@ -104,10 +364,23 @@ const std::string& Table::column_name(ColumnID column_id) const { return _column
 
 const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
 
+DataType Table::column_data_type(ColumnID column_id) const { return _column_data_types.at(column_id); }
+
 Chunk& Table::get_chunk(ChunkID chunk_id) { return _chunks.at(chunk_id); }
 
 const Chunk& Table::get_chunk(ChunkID chunk_id) const { return _chunks.at(chunk_id); }
 
+size_t Table::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _chunks.capacity() * sizeof(Chunk);
+  for (const auto& chunk : _chunks) {
+    // Subtract the chunk object itself, it is already accounted for by the capacity of _chunks
+    bytes += chunk.estimate_memory_usage() - sizeof(Chunk);
+  }
+  bytes += (_column_names.capacity() + _column_types.capacity()) * sizeof(std::string);
+  bytes += _column_data_types.capacity() * sizeof(DataType);
+  return bytes;
+}
+
 bool Table::_chunk_matches_definitions() const {
   // Since we cannot alter column specifications after they have been created,
   // it suffices to check for the same length of columns in our definition and the
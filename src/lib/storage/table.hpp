@@ -1,8 +1,10 @@
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,6 +18,8 @@
 
 namespace opossum {
 
+class BaseHashIndex;
+class DeltaMerge;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -24,7 +28,9 @@ class Table : private Noncopyable {
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default (0) is an unlimited size. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = 0);
+  // all chunks and their columns allocate memory using alloc. If a chunk size is given, the columns of new chunks are
+  // pre-sized to it so that they are allocated exactly once.
+  explicit Table(const uint32_t chunk_size = 0, const PolymorphicAllocator<Chunk>& alloc = {});
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -55,6 +61,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // returns the column type of the nth column as DataType, which is cheaper to resolve than the string
+  DataType column_data_type(ColumnID column_id) const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -67,18 +76,87 @@ class Table : private Noncopyable {
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
   void add_column_definition(const std::string& name, const std::string& type);
+  void add_column_definition(const std::string& name, DataType data_type);
 
   // adds a column to the end, i.e., right, of the table
   // the added column should have the same length as existing columns (if any)
   void add_column(const std::string& name, const std::string& type);
+  void add_column(const std::string& name, DataType data_type);
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
-  // creates a new chunk and appends it
+  // same as append, but avoids constructing (and copying strings into) AllTypeVariants
+  void append_compact(const std::vector<CompactValue>& values);
+
+  // seals the last chunk and appends a new one
   void create_new_chunk();
 
+  // Seals the last chunk (see Chunk::seal) and builds its Bloom filters, trigram indexes, and statistics. The next
+  // append creates a new chunk. Full chunks are sealed automatically. Does nothing if the last chunk is empty.
+  void seal_last_chunk();
+
+  // Builds a Bloom filter for the column in every sealed chunk, now and whenever a chunk is sealed. Scans use them to
+  // skip chunks for equality predicates, see TableScan.
+  void enable_bloom_filter(ColumnID column_id, const double false_positive_rate = 0.01);
+
+  // Builds a TrigramIndex for the string column in every sealed chunk, now and whenever a chunk is sealed. Scans use
+  // them to check only the rows that may match LIKE patterns, see TableScan.
+  void enable_trigram_index(ColumnID column_id);
+
+  // Builds the statistics of every sealed chunk (see ChunkStatistics), now and whenever a chunk is sealed, and adds
+  // them to the statistics of the table. Chunks of ReferenceColumns are not covered.
+  void enable_statistics();
+
+  // Returns the statistics of the table (see TableStatistics), or nullptr if they are not enabled. The statistics of
+  // the sealed chunks are maintained as chunks are sealed, while those of the last chunk are built on every call if it
+  // is not sealed yet and the table has changed since the last call. The returned statistics do not change when rows
+  // are added later.
+  std::shared_ptr<const TableStatistics> table_statistics() const;
+
+  // Sorts every chunk by the given columns when it is sealed (see Chunk::sort), which lets scans on the first of them
+  // use binary search, see TableScan. Chunks that are already sealed keep their order. Sealing thus reorders the rows
+  // of the last chunk, so positions into it must not be held across appends.
+  void enable_clustering(const std::vector<ColumnID>& column_ids);
+
+  // Builds a HashIndex that maps the values of the column to the positions of the rows holding them, across all
+  // chunks. It is maintained as rows are appended and chunks are added, and scans use it for equality predicates (see
+  // TableScan). Indexes are not persisted by checkpoints.
+  void enable_hash_index(ColumnID column_id);
+
+  // returns the HashIndex of the column, or nullptr if there is none
+  std::shared_ptr<const BaseHashIndex> get_hash_index(ColumnID column_id) const;
+
+  // Hands every sealed chunk to the BufferManager, now and whenever a chunk is sealed, so that their columns can be
+  // evicted to disk when the BufferManager's memory budget is exceeded. Evicted columns are loaded transparently when
+  // they are accessed through get_chunk(...).get_column(...), while the chunks' metadata stays in memory.
+  void enable_eviction();
+
+  // Moves the delta, i.e., the sealed chunks that have been appended since the last merge, into the main store by
+  // dictionary-encoding their columns (see DeltaMerge). Readers may scan the table meanwhile. Waits for a merge that
+  // runs in the background first. Chunks whose eviction is enabled are not encoded, so enable eviction after merging.
+  void merge_delta();
+
+  // Merges the delta in the background once it holds max_delta_chunk_count sealed chunks, so that appending rows does
+  // not wait for the encoding. The merge is committed by the next seal_last_chunk that finds it done, or that needs to
+  // start another merge. With eviction enabled, chunks become evictable when their merge is committed.
+  void enable_delta_merge(ChunkID max_delta_chunk_count);
+
+  // returns the number of chunks in the main store, i.e., the chunks before this id have been merged
+  ChunkID main_chunk_count() const;
+
+  // adds a chunk that has been filled elsewhere, e.g., by an operator. Its columns need to match the column
+  // definitions. If the table only consists of an empty chunk, that chunk is replaced.
+  void emplace_chunk(Chunk chunk);
+
+  // Returns a counter that is incremented whenever rows, chunks, or columns are added or a chunk is sealed, i.e.,
+  // whenever the results of operators on the table may change. The ResultCache uses it to validate cached results.
+  uint64_t version() const;
+
+  // returns the approximate number of bytes occupied by the table, i.e., its chunks and its column definitions
+  size_t estimate_memory_usage() const;
+
  protected:
   // Updates the first (and empty) chunk to match _column_definitions
   void _create_missing_columns();
@@ -86,10 +164,49 @@ class Table : private Noncopyable {
   // Indicates that there are new _column_definitions entries that aren't represented in _chunks
   bool _chunk_matches_definitions() const;
 
+  void _build_bloom_filters(Chunk& chunk) const;
+  void _build_trigram_indexes(Chunk& chunk) const;
+
+  // builds the statistics of the chunk and adds them to the table's statistics unless the chunk has ReferenceColumns
+  void _add_chunk_statistics(Chunk& chunk, TableStatistics& statistics) const;
+
+  // drops the statistics cached by table_statistics, which share sketches with _statistics
+  void _reset_unsealed_statistics();
+
+  // commits a finished background merge and starts a new one if the delta has grown large enough
+  void _merge_delta_in_background();
+
+  // waits for _delta_merge to be encoded and commits it
+  void _commit_delta_merge();
+
  protected:
   const uint32_t _chunk_size;
+  PolymorphicAllocator<Chunk> _alloc;
   std::vector<Chunk> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::vector<DataType> _column_data_types;
+  std::map<ColumnID, double> _bloom_filter_false_positive_rates;
+  std::set<ColumnID> _trigram_index_column_ids;
+  std::vector<ColumnID> _clustering_column_ids;
+  std::map<ColumnID, std::shared_ptr<BaseHashIndex>> _hash_indexes;
+
+  // the statistics of the sealed chunks, which are replaced rather than modified when chunks are sealed
+  std::shared_ptr<const TableStatistics> _statistics;
+
+  // the statistics including the unsealed last chunk that table_statistics returned for version, which are held on the
+  // heap so that the mutex does not keep the table from being moved
+  struct UnsealedStatisticsCache {
+    std::mutex mutex;
+    std::shared_ptr<const TableStatistics> statistics;
+    uint64_t version = 0;
+  };
+  std::unique_ptr<UnsealedStatisticsCache> _unsealed_statistics = std::make_unique<UnsealedStatisticsCache>();
+  bool _is_eviction_enabled = false;
+  ChunkID _main_chunk_count{0};
+  ChunkID _max_delta_chunk_count{0};
+  std::shared_ptr<DeltaMerge> _delta_merge;
+  std::future<void> _delta_merge_encoded;
+  uint64_t _version = 0;
 };
 }  // namespace opossum
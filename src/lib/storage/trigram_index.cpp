@@ -0,0 +1,160 @@
+#include "trigram_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/like_matcher.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TrigramIndex> TrigramIndex::build(const BaseColumn& column) {
+  Assert(column.data_type() == DataType::String, "Only string columns can have a trigram index");
+
+  auto postings = std::vector<uint64_t>{};
+  const auto append_postings = [&](const std::vector<Trigram>& trigrams, const ChunkOffset chunk_offset) {
+    for (const auto trigram : trigrams) {
+      postings.push_back(static_cast<uint64_t>(trigram) << 32 | chunk_offset);
+    }
+  };
+
+  // The trigrams of a value are deduplicated, so that every row is listed once per trigram
+  const auto distinct_trigrams = [](const std::string& value, std::vector<Trigram>& trigrams) {
+    trigrams.clear();
+    _append_trigrams(value, true, true, trigrams);
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+  };
+
+  if (column.encoding_type() == EncodingType::Dictionary) {
+    // The trigrams of every distinct value are determined once
+    const auto& dictionary_column = static_cast<const DictionaryColumn<std::string>&>(column);
+    const auto& dictionary = dictionary_column.dictionary();
+    auto trigrams_by_value_id = std::vector<std::vector<Trigram>>(dictionary.size());
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      distinct_trigrams(dictionary[value_id], trigrams_by_value_id[value_id]);
+    }
+
+    resolve_attribute_vector(dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+      const auto& value_ids = attribute_vector.value_ids();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+        append_postings(trigrams_by_value_id[value_ids[chunk_offset]], chunk_offset);
+      }
+    });
+  } else {
+    Assert(column.encoding_type() == EncodingType::Unencoded,
+           "Only ValueColumns and DictionaryColumns can have a trigram index");
+    const auto& values = static_cast<const ValueColumn<std::string>&>(column).values();
+    auto trigrams = std::vector<Trigram>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      distinct_trigrams(values[chunk_offset], trigrams);
+      append_postings(trigrams, chunk_offset);
+    }
+  }
+
+  auto trigram_index = std::make_shared<TrigramIndex>();
+  trigram_index->_build(postings);
+  return trigram_index;
+}
+
+std::optional<std::vector<ChunkOffset>> TrigramIndex::candidates(const std::string& pattern) const {
+  // The literal parts of the pattern lie between its wildcards. Only the first and the last part can be anchored.
+  auto trigrams = std::vector<Trigram>{};
+  auto part_begin = size_t{0};
+  for (auto position = size_t{0}; position <= pattern.size(); ++position) {
+    if (position < pattern.size() && pattern[position] != LikeMatcher::ANY_CHARS &&
+        pattern[position] != LikeMatcher::ANY_CHAR) {
+      continue;
+    }
+    _append_trigrams(std::string_view{pattern}.substr(part_begin, position - part_begin), part_begin == 0,
+                     position == pattern.size(), trigrams);
+    part_begin = position + 1;
+  }
+  if (trigrams.empty()) return std::nullopt;
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+  // The postings of all trigrams are intersected, starting with the shortest one
+  auto postings = std::vector<std::pair<size_t, size_t>>{};
+  postings.reserve(trigrams.size());
+  for (const auto trigram : trigrams) {
+    const auto iter = std::lower_bound(_trigrams.cbegin(), _trigrams.cend(), trigram);
+    if (iter == _trigrams.cend() || *iter != trigram) return std::vector<ChunkOffset>{};
+
+    const auto trigram_index = static_cast<size_t>(iter - _trigrams.cbegin());
+    postings.emplace_back(_posting_begins[trigram_index], _posting_begins[trigram_index + 1]);
+  }
+  std::sort(postings.begin(), postings.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second - lhs.first < rhs.second - rhs.first;
+  });
+
+  auto chunk_offsets =
+      std::vector<ChunkOffset>(_chunk_offsets.cbegin() + postings.front().first,
+                               _chunk_offsets.cbegin() + postings.front().second);
+  for (auto posting_index = size_t{1}; posting_index < postings.size() && !chunk_offsets.empty(); ++posting_index) {
+    // As the candidates are the fewer offsets, they are searched for in the longer posting rather than merged with it
+    auto posting_iter = _chunk_offsets.cbegin() + postings[posting_index].first;
+    const auto posting_end = _chunk_offsets.cbegin() + postings[posting_index].second;
+    auto kept_count = size_t{0};
+    for (const auto chunk_offset : chunk_offsets) {
+      posting_iter = std::lower_bound(posting_iter, posting_end, chunk_offset);
+      if (posting_iter == posting_end) break;
+      if (*posting_iter == chunk_offset) chunk_offsets[kept_count++] = chunk_offset;
+    }
+    chunk_offsets.resize(kept_count);
+  }
+  return chunk_offsets;
+}
+
+size_t TrigramIndex::trigram_count() const { return _trigrams.size(); }
+
+size_t TrigramIndex::estimate_memory_usage() const {
+  return sizeof(*this) + _trigrams.capacity() * sizeof(Trigram) + _posting_begins.capacity() * sizeof(size_t) +
+         _chunk_offsets.capacity() * sizeof(ChunkOffset);
+}
+
+void TrigramIndex::_append_trigrams(const std::string_view part, const bool is_at_begin, const bool is_at_end,
+                                    std::vector<Trigram>& trigrams) {
+  static constexpr auto MARKER = Trigram{0};
+  static constexpr auto MASK = (Trigram{1} << 27) - 1;
+
+  // The trigram is shifted by one symbol per step, so it is complete once it has taken three symbols
+  auto trigram = Trigram{0};
+  auto symbol_count = size_t{0};
+  const auto push_symbol = [&](const Trigram symbol) {
+    trigram = ((trigram << 9) | symbol) & MASK;
+    if (++symbol_count >= 3) trigrams.push_back(trigram);
+  };
+
+  if (is_at_begin) push_symbol(MARKER);
+  for (const auto character : part) {
+    push_symbol(static_cast<Trigram>(static_cast<unsigned char>(character)) + 1);
+  }
+  if (is_at_end) push_symbol(MARKER);
+}
+
+void TrigramIndex::_build(std::vector<uint64_t>& postings) {
+  std::sort(postings.begin(), postings.end());
+
+  _chunk_offsets.reserve(postings.size());
+  for (const auto posting : postings) {
+    const auto trigram = static_cast<Trigram>(posting >> 32);
+    if (_trigrams.empty() || _trigrams.back() != trigram) {
+      _trigrams.push_back(trigram);
+      _posting_begins.push_back(_chunk_offsets.size());
+    }
+    _chunk_offsets.push_back(static_cast<ChunkOffset>(posting));
+  }
+  _posting_begins.push_back(_chunk_offsets.size());
+  _trigrams.shrink_to_fit();
+  _posting_begins.shrink_to_fit();
+}
+
+}  // namespace opossum
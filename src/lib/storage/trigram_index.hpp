@@ -0,0 +1,65 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <optional>
+#include <string_view>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+/**
+ * TrigramIndex is an inverted index over the string column of a chunk: it maps every trigram, i.e., every sequence of
+ * three consecutive bytes, to the offsets of the rows whose values contain it. Scans use it for LIKE patterns (see
+ * ScanType::OpLike and TableScan): a row can only match a pattern if its value contains all trigrams of the pattern's
+ * literal parts, so only the offsets that are listed for all of them need to be checked.
+ *
+ * Values are padded with a marker at both ends, which is distinct from all bytes. Hence, the trigrams of "abc" are
+ * "^ab", "abc", and "bc$", and a pattern that is anchored at the beginning or the end (e.g., "ab%" or "%bc") requires
+ * the trigrams with the marker, so that prefixes and suffixes narrow the candidates as well as infixes do.
+ *
+ * Each row is listed once per distinct trigram of its value, so the index occupies up to four bytes per byte of the
+ * column's values, plus the trigrams themselves.
+ */
+class TrigramIndex : private Noncopyable {
+ public:
+  // creates an index over the values of column, which needs to be a ValueColumn or a DictionaryColumn of strings
+  static std::shared_ptr<TrigramIndex> build(const BaseColumn& column);
+
+  // Returns the offsets of the rows that may match the LIKE pattern (see LikeMatcher) in ascending order, or
+  // std::nullopt if the pattern has no trigram, e.g., "%ab%", so that every row may match. The rows are candidates
+  // only, i.e., their values need to be checked against the pattern.
+  std::optional<std::vector<ChunkOffset>> candidates(const std::string& pattern) const;
+
+  // returns the number of distinct trigrams of all values
+  size_t trigram_count() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // The three bytes of a trigram are stored in 9 bits each, where 0 is the marker and byte b is b + 1
+  using Trigram = uint32_t;
+
+  // Appends the trigrams of a part of a value or pattern, which is preceded (or followed) by the marker if it is at the
+  // beginning (or end) of the value or is anchored there in the pattern
+  static void _append_trigrams(std::string_view part, bool is_at_begin, bool is_at_end, std::vector<Trigram>& trigrams);
+
+  // builds the postings from the pairs of a trigram and the offset of a row containing it, given as trigram << 32 |
+  // offset, where no pair occurs twice. The pairs are sorted in the process.
+  void _build(std::vector<uint64_t>& postings);
+
+  // The distinct trigrams in ascending order. The offsets of the rows containing _trigrams[i] are
+  // _chunk_offsets[_posting_begins[i]] to _chunk_offsets[_posting_begins[i + 1] - 1] in ascending order.
+  std::vector<Trigram> _trigrams;
+  std::vector<size_t> _posting_begins;
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+
+}  // namespace opossum
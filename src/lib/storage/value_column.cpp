@@ -4,6 +4,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,22 +14,86 @@
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(const PolymorphicAllocator<T>& alloc, const size_t capacity) : _values(alloc) {
+  _values.reserve(capacity);
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
   return _values.at(i);
 }
 
+template <typename T>
+CompactValue ValueColumn<T>::compact_value_at(const size_t i) const {
+  PerformanceWarning("compact_value_at used");
+  if constexpr (std::is_same<T, std::string>::value) {
+    return CompactValue::view(_values.at(i));
+  } else {
+    return CompactValue{_values.at(i)};
+  }
+}
+
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
   _values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueColumn<T>::append(const CompactValue& val) {
+  if (val.data_type() != data_type()) {
+    // Slow path, values of a different type need to be converted
+    append(val.to_variant());
+    return;
+  }
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    _values.emplace_back(val.get<std::string_view>());
+  } else {
+    _values.push_back(val.get<T>());
+  }
+}
+
 template <typename T>
 size_t ValueColumn<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+DataType ValueColumn<T>::data_type() const {
+  return data_type_from_type<T>();
+}
+
+template <typename T>
+const pmr_vector<T>& ValueColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+EncodingType ValueColumn<T>::encoding_type() const {
+  return EncodingType::Unencoded;
+}
+
+template <typename T>
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _values.capacity() * sizeof(T);
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    // Short strings are stored inline (SSO) and are already covered by sizeof(T). Only longer strings own a heap
+    // allocation of capacity() + 1 bytes (for the terminating null character).
+    static const auto sso_capacity = std::string{}.capacity();
+    for (const auto& value : _values) {
+      if (value.capacity() > sso_capacity) bytes += value.capacity() + 1;
+    }
+  }
+
+  return bytes;
+}
+
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
 
 }  // namespace opossum
@@ -13,17 +13,38 @@ namespace opossum {
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
+  // creates an empty column. The values are allocated using alloc. If the number of values is known beforehand (e.g.,
+  // the chunk size), pass it as capacity so that appending does not need to reallocate.
+  explicit ValueColumn(const PolymorphicAllocator<T>& alloc = {}, const size_t capacity = 0);
+
+  // creates a column that holds the given values, e.g., values that an operator gathered from other columns
+  explicit ValueColumn(pmr_vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
+  // return the value at a certain position without copying strings. Also slow, but less so than operator[].
+  CompactValue compact_value_at(const size_t i) const override;
+
   // add a value to the end
   void append(const AllTypeVariant& val) override;
+  void append(const CompactValue& val) override;
 
   // return the number of entries
   size_t size() const override;
 
+  DataType data_type() const override;
+
+  EncodingType encoding_type() const override;
+
+  // returns all values. This is the way to go for efficient operators, see resolve_column_type() in resolve_type.hpp
+  const pmr_vector<T>& values() const;
+
+  // takes the capacity of the vector into account, not only its size
+  size_t estimate_memory_usage() const override;
+
  protected:
-  std::vector<T> _values;
+  pmr_vector<T> _values;
 };
 
 }  // namespace opossum
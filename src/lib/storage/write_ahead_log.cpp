@@ -0,0 +1,340 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "checkpoint.hpp"
+#include "resolve_type.hpp"
+#include "storage_manager.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Size of the record header, i.e., the payload size and the checksum
+constexpr size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+// FNV-1a, which is good enough to detect incomplete or garbled records at the end of the log
+uint32_t checksum(const char* data, const size_t size) {
+  auto hash = uint32_t{2166136261u};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash = (hash ^ static_cast<uint8_t>(data[index])) * 16777619u;
+  }
+  return hash;
+}
+
+template <typename T>
+void write_value(std::string& buffer, const T& value) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    write_value(buffer, static_cast<uint64_t>(value.size()));
+    buffer.append(value);
+  } else {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+// Reads values from the payload of a record, whose integrity has been checked using its checksum
+class PayloadReader {
+ public:
+  explicit PayloadReader(const std::string& payload) : _payload(payload) {}
+
+  template <typename T>
+  T read() {
+    if constexpr (std::is_same<T, std::string>::value) {
+      const auto size = read<uint64_t>();
+      Assert(_offset + size <= _payload.size(), "Log record is corrupt");
+      auto value = _payload.substr(_offset, size);
+      _offset += size;
+      return value;
+    } else {
+      Assert(_offset + sizeof(T) <= _payload.size(), "Log record is corrupt");
+      auto value = T{};
+      std::memcpy(&value, _payload.data() + _offset, sizeof(T));
+      _offset += sizeof(T);
+      return value;
+    }
+  }
+
+ private:
+  const std::string& _payload;
+  size_t _offset = 0;
+};
+
+// Writes all of data, retrying on interrupts and partial writes. Returns false on errors.
+bool write_fully(const int file_descriptor, const std::string& data) {
+  auto offset = size_t{0};
+  while (offset < data.size()) {
+    const auto written = write(file_descriptor, data.data() + offset, data.size() - offset);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    offset += static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool flush(const int file_descriptor) {
+#ifdef __linux__
+  return fdatasync(file_descriptor) == 0;
+#else
+  return fsync(file_descriptor) == 0;
+#endif
+}
+
+}  // namespace
+
+namespace opossum {
+
+WriteAheadLog::WriteAheadLog(const std::string& path, const std::string& checkpoint_directory) : _path(path) {
+  const auto checkpoint_offset = checkpoint_directory.empty() ? uint64_t{0} : Checkpoint::load(checkpoint_directory);
+  const auto valid_size = _recover(checkpoint_offset);
+  _logged_bytes = valid_size;
+
+  _file_descriptor = open(_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open log " + _path + ": " + std::strerror(errno));
+
+  // Removes an incomplete record left by a crash, so that new records directly follow the last complete one
+  Assert(ftruncate(_file_descriptor, static_cast<off_t>(valid_size)) == 0, "Could not truncate log " + _path);
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  // Every public method waits for its record to be flushed, so there is nothing left to write
+  if (_file_descriptor >= 0) close(_file_descriptor);
+}
+
+void WriteAheadLog::add_table(const std::string& name, std::shared_ptr<Table> table) {
+  Assert(table->row_count() == 0, "Only empty tables can be added to the log");
+
+  auto payload = std::string{};
+  write_value(payload, RecordType::AddTable);
+  write_value(payload, name);
+  write_value(payload, table->chunk_size());
+  write_value(payload, table->col_count());
+  for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+    write_value(payload, table->column_name(column_id));
+    write_value(payload, table->column_data_type(column_id));
+  }
+
+  auto lsn = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> apply_lock(_apply_mutex);
+    Assert(!StorageManager::get().has_table(name), "Duplicate table name");
+    lsn = _log(payload);
+    StorageManager::get().add_table(name, table);
+  }
+  _wait_until_durable(lsn);
+}
+
+void WriteAheadLog::drop_table(const std::string& name) {
+  auto payload = std::string{};
+  write_value(payload, RecordType::DropTable);
+  write_value(payload, name);
+
+  auto lsn = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> apply_lock(_apply_mutex);
+    Assert(StorageManager::get().has_table(name), "Table does not exist");
+    lsn = _log(payload);
+    StorageManager::get().drop_table(name);
+  }
+  _wait_until_durable(lsn);
+}
+
+void WriteAheadLog::append(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows) {
+  if (rows.empty()) return;
+
+  std::shared_ptr<Table> table;
+  {
+    std::lock_guard<std::mutex> apply_lock(_apply_mutex);
+    Assert(StorageManager::get().has_table(table_name), "Table does not exist");
+    table = StorageManager::get().get_table(table_name);
+  }
+
+  // Encodes the rows before anything is logged, so that rows that do not match the table are not logged
+  auto payload = std::string{};
+  write_value(payload, RecordType::Append);
+  write_value(payload, table_name);
+  write_value(payload, static_cast<uint32_t>(rows.size()));
+  for (const auto& row : rows) {
+    Assert(row.size() == table->col_count(), "Row does not match the table's columns");
+  }
+  for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      for (const auto& row : rows) {
+        // Values that already have the column's type are written without converting (and thus copying) them
+        if (const auto value = boost::get<ColumnDataType>(&row[column_id])) {
+          write_value(payload, *value);
+        } else {
+          write_value(payload, type_cast<ColumnDataType>(row[column_id]));
+        }
+      }
+    });
+  }
+
+  auto lsn = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> apply_lock(_apply_mutex);
+    Assert(StorageManager::get().has_table(table_name) && StorageManager::get().get_table(table_name) == table,
+           "Table has been dropped");
+    lsn = _log(payload);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+  }
+  _wait_until_durable(lsn);
+}
+
+void WriteAheadLog::checkpoint(const std::string& directory) {
+  std::unique_ptr<Checkpoint> checkpoint;
+  auto lsn = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> apply_lock(_apply_mutex);
+    std::lock_guard<std::mutex> lock(_mutex);
+    checkpoint = std::make_unique<Checkpoint>(directory, _logged_bytes);
+    lsn = _last_lsn;
+  }
+
+  // The checkpoint may only refer to the log once everything it contains is durable in the log
+  _wait_until_durable(lsn);
+  checkpoint->write();
+}
+
+uint64_t WriteAheadLog::recovered_record_count() const { return _recovered_record_count; }
+
+uint64_t WriteAheadLog::_recover(const uint64_t start_offset) {
+  auto stream = std::ifstream{_path, std::ios::binary};
+  if (!stream.is_open()) {
+    Assert(start_offset == 0, "Log " + _path + " is missing records that the checkpoint expects");
+    return 0;
+  }
+
+  // Records before start_offset are part of the checkpoint and are not even read
+  stream.seekg(0, std::ios::end);
+  Assert(start_offset <= static_cast<uint64_t>(stream.tellg()),
+         "Log " + _path + " is missing records that the checkpoint expects");
+  stream.seekg(static_cast<std::streamoff>(start_offset));
+  const auto log = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+
+  auto offset = size_t{0};
+  while (offset + RECORD_HEADER_SIZE <= log.size()) {
+    auto payload_size = uint32_t{0};
+    auto expected_checksum = uint32_t{0};
+    std::memcpy(&payload_size, log.data() + offset, sizeof(payload_size));
+    std::memcpy(&expected_checksum, log.data() + offset + sizeof(payload_size), sizeof(expected_checksum));
+
+    // An incomplete or garbled record can only be the last one, as records are written in order
+    const auto payload_offset = offset + RECORD_HEADER_SIZE;
+    if (payload_offset + payload_size > log.size()) break;
+    if (checksum(log.data() + payload_offset, payload_size) != expected_checksum) break;
+
+    const auto payload = log.substr(payload_offset, payload_size);
+    auto reader = PayloadReader{payload};
+    switch (reader.read<RecordType>()) {
+      case RecordType::AddTable: {
+        const auto name = reader.read<std::string>();
+        auto table = std::make_shared<Table>(reader.read<uint32_t>());
+        const auto column_count = reader.read<uint16_t>();
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          const auto column_name = reader.read<std::string>();
+          table->add_column(column_name, reader.read<DataType>());
+        }
+        StorageManager::get().add_table(name, table);
+        break;
+      }
+
+      case RecordType::DropTable:
+        StorageManager::get().drop_table(reader.read<std::string>());
+        break;
+
+      case RecordType::Append: {
+        const auto table = StorageManager::get().get_table(reader.read<std::string>());
+        auto rows = std::vector<std::vector<AllTypeVariant>>(reader.read<uint32_t>(),
+                                                             std::vector<AllTypeVariant>(table->col_count()));
+        for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+          resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            for (auto& row : rows) {
+              row[column_id] = reader.read<ColumnDataType>();
+            }
+          });
+        }
+        for (const auto& row : rows) {
+          table->append(row);
+        }
+        break;
+      }
+
+      default:
+        Fail("Unknown log record type");
+    }
+
+    ++_recovered_record_count;
+    offset = payload_offset + payload_size;
+  }
+
+  return start_offset + offset;
+}
+
+uint64_t WriteAheadLog::_log(const std::string& payload) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(_error.empty(), "Could not write log " + _path + ": " + _error);
+  write_value(_buffer, static_cast<uint32_t>(payload.size()));
+  write_value(_buffer, checksum(payload.data(), payload.size()));
+  _buffer.append(payload);
+  _logged_bytes += RECORD_HEADER_SIZE + payload.size();
+  return ++_last_lsn;
+}
+
+void WriteAheadLog::_wait_until_durable(const uint64_t lsn) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (_durable_lsn < lsn) {
+    Assert(_error.empty(), "Could not write log " + _path + ": " + _error);
+
+    if (_is_flushing) {
+      // Another appender is flushing. If that does not cover lsn, one of the waiters flushes next.
+      _flushed.wait(lock);
+      continue;
+    }
+
+    // Becomes the leader and flushes the records of all appenders that have logged so far
+    _is_flushing = true;
+    auto buffer = std::string{};
+    buffer.swap(_buffer);
+    const auto flushed_lsn = _last_lsn;
+    lock.unlock();
+
+    const auto success = write_fully(_file_descriptor, buffer) && flush(_file_descriptor);
+    const auto error = success ? std::string{} : std::string{std::strerror(errno)};
+    PerformanceCount("WriteAheadLog flush");
+
+    lock.lock();
+    _is_flushing = false;
+    if (success) {
+      _durable_lsn = flushed_lsn;
+    } else {
+      // Some of the records may be on disk, the last of them possibly torn. Later records must not follow them, as
+      // recovery stops at a torn record, so the records of this buffer are never acknowledged.
+      _error = error;
+    }
+    _flushed.notify_all();
+  }
+}
+
+}  // namespace opossum
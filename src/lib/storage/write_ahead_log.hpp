@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * WriteAheadLog makes tables in the StorageManager durable. Creating and dropping tables as well as appending rows is
+ * logged to a file before it is acknowledged, so that it can be replayed after a crash:
+ *
+ *   WriteAheadLog log{"/path/to/log"};  // replays the existing log into the StorageManager
+ *   log.add_table("orders", table);
+ *   log.append("orders", {{1, "pending"}, {2, "shipped"}});  // returns once both rows are on disk
+ *
+ * Appending is thread-safe and uses group commit: the records of concurrent appenders are written and flushed
+ * (fdatasync) together by whichever appender flushes next, so that many appenders share a single flush. Rows become
+ * visible in the table when they are logged, but append only returns once they are durable.
+ *
+ * Each record consists of its payload size (4 bytes), a checksum of the payload (4 bytes), and the payload, which
+ * starts with the record type. Rows are stored column by column in the binary representation of the columns' types
+ * (see ColumnSerializer for the format of values). A crash may leave an incomplete record at the end of the log, which
+ * recovery detects using the size and checksum, ignores, and truncates.
+ *
+ * If writing or flushing the log fails, e.g., because the disk is full, it is unknown which of the pending records are
+ * on disk. The log then fails all pending and later changes, whose appenders throw, and needs to be opened again, which
+ * recovers the complete records.
+ *
+ * Changes that bypass the log, e.g., Table::append on a logged table, are not durable.
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  // Replays the log at path into the StorageManager and opens it for appending. Creates the log if it does not exist.
+  // If a checkpoint directory is given, the checkpoint written there by checkpoint() is loaded first (see
+  // Checkpoint::load), and only the records logged after it are replayed.
+  explicit WriteAheadLog(const std::string& path, const std::string& checkpoint_directory = "");
+  ~WriteAheadLog();
+
+  // logs the creation of the table, which needs to be empty, and adds it to the StorageManager
+  void add_table(const std::string& name, std::shared_ptr<Table> table);
+
+  // logs dropping the table and removes it from the StorageManager
+  void drop_table(const std::string& name);
+
+  // Appends rows to a table that has been added through this log (or recovered from it). Returns once the rows are
+  // durable. Fails without changing the table or the log if a row does not match the table's columns.
+  void append(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows);
+
+  // Writes a Checkpoint of all tables to directory. Changes through the log are only held off while the tables are
+  // captured, not while they are written.
+  void checkpoint(const std::string& directory);
+
+  // returns the number of records replayed when the log was opened
+  uint64_t recovered_record_count() const;
+
+ protected:
+  enum class RecordType : uint8_t { AddTable, DropTable, Append };
+
+  // replays all complete records from start_offset on and returns the size of the log up to the end of the last one
+  uint64_t _recover(const uint64_t start_offset);
+
+  // adds the record to the buffer and returns its log sequence number, fails if the log has failed
+  uint64_t _log(const std::string& payload);
+
+  // returns once the record with the given log sequence number has been flushed, fails if the log has failed
+  void _wait_until_durable(const uint64_t lsn);
+
+  const std::string _path;
+  int _file_descriptor = -1;
+  uint64_t _recovered_record_count = 0;
+
+  // Serializes logging a record and applying it, so that the records are in the order in which they were applied
+  std::mutex _apply_mutex;
+
+  // Protects the following members, but is not held while the buffer is written and flushed
+  std::mutex _mutex;
+  std::condition_variable _flushed;
+  std::string _buffer;
+  uint64_t _last_lsn = 0;
+  uint64_t _durable_lsn = 0;
+
+  // size of the log including the buffer, i.e., the offset of the next record
+  uint64_t _logged_bytes = 0;
+  bool _is_flushing = false;
+
+  // set once writing or flushing failed, after which the log fails all changes
+  std::string _error;
+};
+
+}  // namespace opossum
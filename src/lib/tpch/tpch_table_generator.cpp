@@ -0,0 +1,692 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// splitmix64, see http://xoshiro.di.unimi.it/splitmix64.c
+uint64_t mix(uint64_t value) {
+  value += 0x9e3779b97f4a7c15;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+  return value ^ (value >> 31);
+}
+
+const auto TEXT_WORDS = std::array<const char*, 32>{
+    {"furiously", "quickly", "carefully", "blithely", "slyly", "fluffily", "boldly", "ironic", "final", "regular",
+     "express", "special", "pending", "even", "silent", "bold", "packages", "requests", "accounts", "deposits", "foxes",
+     "ideas", "theodolites", "pinto beans", "instructions", "dependencies", "excuses", "platelets", "asymptotes",
+     "courts", "dolphins", "sleep"}};
+
+const auto COLORS = std::array<const char*, 32>{
+    {"almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush", "brown",
+     "burlywood", "burnished", "chartreuse", "chiffon", "chocolate", "coral", "cornflower", "cornsilk", "cream", "cyan",
+     "dark", "deep", "dim", "dodger", "drab", "firebrick", "floral", "forest", "frosted", "gainsboro", "ghost"}};
+
+const auto TYPE_SYLLABLES_1 = std::array<const char*, 6>{{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"}};
+const auto TYPE_SYLLABLES_2 = std::array<const char*, 5>{{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"}};
+const auto TYPE_SYLLABLES_3 = std::array<const char*, 5>{{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"}};
+const auto CONTAINER_SYLLABLES_1 = std::array<const char*, 5>{{"SM", "LG", "MED", "JUMBO", "WRAP"}};
+const auto CONTAINER_SYLLABLES_2 =
+    std::array<const char*, 8>{{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"}};
+const auto SEGMENTS = std::array<const char*, 5>{{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"}};
+const auto PRIORITIES = std::array<const char*, 5>{{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"}};
+const auto INSTRUCTIONS = std::array<const char*, 4>{{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"}};
+const auto MODES = std::array<const char*, 7>{{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"}};
+const auto REGIONS = std::array<const char*, 5>{{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"}};
+
+// name and region key of every nation
+const auto NATIONS = std::array<std::pair<const char*, int32_t>, 25>{
+    {{"ALGERIA", 0}, {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1}, {"EGYPT", 4}, {"ETHIOPIA", 0}, {"FRANCE", 3},
+     {"GERMANY", 3}, {"INDIA", 2}, {"INDONESIA", 2}, {"IRAN", 4}, {"IRAQ", 4}, {"JAPAN", 2}, {"JORDAN", 4},
+     {"KENYA", 0}, {"MOROCCO", 0}, {"MOZAMBIQUE", 0}, {"PERU", 1}, {"CHINA", 2}, {"ROMANIA", 3}, {"SAUDI ARABIA", 4},
+     {"VIETNAM", 2}, {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}}};
+
+// Dates are days since 1992-01-01, the first order date. The last receipt date is 1998-12-31.
+const auto DATE_COUNT = 2557;
+const auto LAST_ORDER_DATE = DATE_COUNT - 1 - 151;
+const auto CURRENT_DATE = 1263;  // 1995-06-17, which separates shipped from open lineitems
+
+const std::vector<std::string>& date_strings() {
+  static const auto dates = []() {
+    const auto days_in_month = std::array<int, 12>{{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}};
+    auto strings = std::vector<std::string>{};
+    strings.reserve(DATE_COUNT);
+    for (auto year = 1992; year <= 1998; ++year) {
+      for (auto month = 1; month <= 12; ++month) {
+        const auto is_leap_february = month == 2 && year % 4 == 0;
+        for (auto day = 1; day <= days_in_month[month - 1] + (is_leap_february ? 1 : 0); ++day) {
+          strings.push_back(std::to_string(year) + (month < 10 ? "-0" : "-") + std::to_string(month) +
+                            (day < 10 ? "-0" : "-") + std::to_string(day));
+        }
+      }
+    }
+    return strings;
+  }();
+  return dates;
+}
+
+// Generates the values of one row. Rows of different tables, or different rows of the same table, never share a seed.
+class RowRandom {
+ public:
+  RowRandom(const TpchTable table, const uint64_t row) : _state(mix(mix(static_cast<uint64_t>(table)) ^ row)) {}
+
+  uint64_t next() {
+    _state += 0x9e3779b97f4a7c15;
+    return mix(_state);
+  }
+
+  // uniformly distributed in [min, max]
+  int64_t number(const int64_t min, const int64_t max) {
+    return min + static_cast<int64_t>(next() % static_cast<uint64_t>(max - min + 1));
+  }
+
+  // uniformly distributed in [min, max] with a precision of cents
+  double decimal(const double min, const double max) {
+    return static_cast<double>(number(std::llround(min * 100), std::llround(max * 100))) / 100.0;
+  }
+
+  template <typename Array>
+  auto pick(const Array& array) {
+    return array[number(0, static_cast<int64_t>(array.size()) - 1)];
+  }
+
+  std::string text(const int64_t min_words, const int64_t max_words) {
+    auto text = std::string(pick(TEXT_WORDS));
+    for (auto word_count = number(min_words, max_words); word_count > 1; --word_count) {
+      text += ' ';
+      text += pick(TEXT_WORDS);
+    }
+    return text;
+  }
+
+  std::string alphanumeric(const int64_t min_length, const int64_t max_length) {
+    static constexpr char characters[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,.";
+    auto string = std::string(static_cast<size_t>(number(min_length, max_length)), ' ');
+    for (auto& character : string) {
+      character = characters[number(0, sizeof(characters) - 2)];
+    }
+    return string;
+  }
+
+  std::string phone(const int32_t nation_key) {
+    return std::to_string(nation_key + 10) + "-" + std::to_string(number(100, 999)) + "-" +
+           std::to_string(number(100, 999)) + "-" + std::to_string(number(1000, 9999));
+  }
+
+ protected:
+  uint64_t _state;
+};
+
+// e.g., Supplier#000000001
+std::string name_with_key(const std::string& prefix, const uint64_t key) {
+  const auto digits = std::to_string(key);
+  return prefix + std::string(digits.size() < 9 ? 9 - digits.size() : 0, '0') + digits;
+}
+
+// Only the first 8 of every 32 order keys are used, so that orders can be inserted later
+int64_t order_key(const uint64_t order_index) {
+  return static_cast<int64_t>(order_index / 8 * 32 + order_index % 8 + 1);
+}
+
+double retail_price(const int64_t part_key) {
+  return static_cast<double>(90'000 + (part_key / 10) % 20'001 + 100 * (part_key % 1'000)) / 100.0;
+}
+
+// the supplier_index-th of the four suppliers of a part
+int32_t supplier_key(const int64_t part_key, const int64_t supplier_index, const int64_t supplier_count) {
+  return static_cast<int32_t>(
+      (part_key + supplier_index * (supplier_count / 4 + (part_key - 1) / supplier_count)) % supplier_count + 1);
+}
+
+// The part of an order that its lineitems depend on
+struct OrderHeader {
+  uint32_t line_item_count;
+  int32_t customer_key;
+  int32_t order_date;
+};
+
+OrderHeader generate_order_header(RowRandom& random, const int64_t customer_count) {
+  auto header = OrderHeader{};
+  header.line_item_count = static_cast<uint32_t>(random.number(1, 7));
+  // Every third customer has no orders
+  header.customer_key = static_cast<int32_t>(random.number(1, customer_count));
+  if (header.customer_key % 3 == 0) --header.customer_key;
+  header.order_date = static_cast<int32_t>(random.number(0, LAST_ORDER_DATE));
+  return header;
+}
+
+// The part of a lineitem that its order depends on
+struct LineItem {
+  int32_t part_key;
+  int32_t supplier_key;
+  double quantity;
+  double extended_price;
+  double discount;
+  double tax;
+  int32_t ship_date;
+  int32_t commit_date;
+  int32_t receipt_date;
+};
+
+LineItem generate_line_item(RowRandom& random, const int32_t order_date, const int64_t part_count,
+                            const int64_t supplier_count) {
+  auto line_item = LineItem{};
+  line_item.part_key = static_cast<int32_t>(random.number(1, part_count));
+  line_item.supplier_key = supplier_key(line_item.part_key, random.number(0, 3), supplier_count);
+  line_item.quantity = static_cast<double>(random.number(1, 50));
+  line_item.extended_price = line_item.quantity * retail_price(line_item.part_key);
+  line_item.discount = random.decimal(0.0, 0.1);
+  line_item.tax = random.decimal(0.0, 0.08);
+  line_item.ship_date = order_date + static_cast<int32_t>(random.number(1, 121));
+  line_item.commit_date = order_date + static_cast<int32_t>(random.number(30, 90));
+  line_item.receipt_date = line_item.ship_date + static_cast<int32_t>(random.number(1, 30));
+  return line_item;
+}
+
+RowRandom line_item_random(const uint64_t order_index, const uint32_t line_number) {
+  return RowRandom{TpchTable::LineItem, order_index * 8 + line_number};
+}
+
+template <typename T>
+pmr_vector<T> reserved_values(const uint32_t row_count) {
+  auto values = pmr_vector<T>{};
+  values.reserve(row_count);
+  return values;
+}
+
+template <typename... Types>
+Chunk make_sealed_chunk(pmr_vector<Types>&&... values) {
+  auto chunk = Chunk{};
+  (chunk.add_column(std::make_shared<ValueColumn<Types>>(std::move(values))), ...);
+  chunk.seal();
+  return chunk;
+}
+
+uint64_t scaled_row_count(const double scale_factor, const uint64_t row_count_at_scale_factor_1) {
+  return std::max(uint64_t{1}, static_cast<uint64_t>(std::llround(scale_factor * row_count_at_scale_factor_1)));
+}
+
+}  // namespace
+
+namespace opossum {
+
+TpchTableGenerator::TpchTableGenerator(const double scale_factor, const uint32_t chunk_size, const size_t worker_count)
+    : _scale_factor(scale_factor),
+      _chunk_size(chunk_size),
+      _worker_count(worker_count != 0 ? worker_count
+                                      : std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()))),
+      _part_count(scaled_row_count(scale_factor, 200'000)),
+      // Part suppliers reference four different suppliers of a part
+      _supplier_count(std::max(uint64_t{4}, scaled_row_count(scale_factor, 10'000))),
+      _customer_count(scaled_row_count(scale_factor, 150'000)),
+      _order_count(scaled_row_count(scale_factor, 1'500'000)) {
+  Assert(scale_factor > 0.0, "Scale factor needs to be positive");
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_table(const TpchTable table) const {
+  const auto chunk_generator = [&](Chunk (TpchTableGenerator::*generate_chunk)(const uint64_t, const uint32_t) const) {
+    return [this, generate_chunk](const uint64_t first_row, const uint32_t row_count) {
+      return (this->*generate_chunk)(first_row, row_count);
+    };
+  };
+
+  switch (table) {
+    case TpchTable::Part:
+      return _generate_table({{"p_partkey", DataType::Int},
+                              {"p_name", DataType::String},
+                              {"p_mfgr", DataType::String},
+                              {"p_brand", DataType::String},
+                              {"p_type", DataType::String},
+                              {"p_size", DataType::Int},
+                              {"p_container", DataType::String},
+                              {"p_retailprice", DataType::Double},
+                              {"p_comment", DataType::String}},
+                             row_count(table), chunk_generator(&TpchTableGenerator::_generate_part_chunk));
+    case TpchTable::PartSupp:
+      return _generate_table({{"ps_partkey", DataType::Int},
+                              {"ps_suppkey", DataType::Int},
+                              {"ps_availqty", DataType::Int},
+                              {"ps_supplycost", DataType::Double},
+                              {"ps_comment", DataType::String}},
+                             row_count(table),
+                             chunk_generator(&TpchTableGenerator::_generate_part_supp_chunk));
+    case TpchTable::Supplier:
+      return _generate_table({{"s_suppkey", DataType::Int},
+                              {"s_name", DataType::String},
+                              {"s_address", DataType::String},
+                              {"s_nationkey", DataType::Int},
+                              {"s_phone", DataType::String},
+                              {"s_acctbal", DataType::Double},
+                              {"s_comment", DataType::String}},
+                             row_count(table), chunk_generator(&TpchTableGenerator::_generate_supplier_chunk));
+    case TpchTable::Customer:
+      return _generate_table({{"c_custkey", DataType::Int},
+                              {"c_name", DataType::String},
+                              {"c_address", DataType::String},
+                              {"c_nationkey", DataType::Int},
+                              {"c_phone", DataType::String},
+                              {"c_acctbal", DataType::Double},
+                              {"c_mktsegment", DataType::String},
+                              {"c_comment", DataType::String}},
+                             row_count(table), chunk_generator(&TpchTableGenerator::_generate_customer_chunk));
+    case TpchTable::Orders:
+      return _generate_table({{"o_orderkey", DataType::Long},
+                              {"o_custkey", DataType::Int},
+                              {"o_orderstatus", DataType::String},
+                              {"o_totalprice", DataType::Double},
+                              {"o_orderdate", DataType::String},
+                              {"o_orderpriority", DataType::String},
+                              {"o_clerk", DataType::String},
+                              {"o_shippriority", DataType::Int},
+                              {"o_comment", DataType::String}},
+                             row_count(table), chunk_generator(&TpchTableGenerator::_generate_orders_chunk));
+    case TpchTable::LineItem: {
+      const auto first_line_item_by_order = _first_line_item_by_order();
+      return _generate_table({{"l_orderkey", DataType::Long},
+                              {"l_partkey", DataType::Int},
+                              {"l_suppkey", DataType::Int},
+                              {"l_linenumber", DataType::Int},
+                              {"l_quantity", DataType::Double},
+                              {"l_extendedprice", DataType::Double},
+                              {"l_discount", DataType::Double},
+                              {"l_tax", DataType::Double},
+                              {"l_returnflag", DataType::String},
+                              {"l_linestatus", DataType::String},
+                              {"l_shipdate", DataType::String},
+                              {"l_commitdate", DataType::String},
+                              {"l_receiptdate", DataType::String},
+                              {"l_shipinstruct", DataType::String},
+                              {"l_shipmode", DataType::String},
+                              {"l_comment", DataType::String}},
+                             first_line_item_by_order.back(), [&](const uint64_t first_row, const uint32_t row_count) {
+                               return _generate_line_item_chunk(first_row, row_count, first_line_item_by_order);
+                             });
+    }
+    case TpchTable::Nation:
+      return _generate_table({{"n_nationkey", DataType::Int},
+                              {"n_name", DataType::String},
+                              {"n_regionkey", DataType::Int},
+                              {"n_comment", DataType::String}},
+                             row_count(table), chunk_generator(&TpchTableGenerator::_generate_nation_chunk));
+    case TpchTable::Region:
+      return _generate_table(
+          {{"r_regionkey", DataType::Int}, {"r_name", DataType::String}, {"r_comment", DataType::String}},
+          row_count(table), chunk_generator(&TpchTableGenerator::_generate_region_chunk));
+  }
+  Fail("Unknown TPC-H table");
+  return nullptr;
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate_all_tables() const {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  for (const auto table : {TpchTable::Part, TpchTable::PartSupp, TpchTable::Supplier, TpchTable::Customer,
+                           TpchTable::Orders, TpchTable::LineItem, TpchTable::Nation, TpchTable::Region}) {
+    tables.emplace(table_name(table), generate_table(table));
+  }
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  auto& storage_manager = StorageManager::get();
+  for (const auto& name_and_table : generate_all_tables()) {
+    Assert(!storage_manager.has_table(name_and_table.first), "Table " + name_and_table.first + " already exists");
+    storage_manager.add_table(name_and_table.first, name_and_table.second);
+  }
+}
+
+const std::string& TpchTableGenerator::table_name(const TpchTable table) {
+  static const auto names = std::map<TpchTable, std::string>{
+      {TpchTable::Part, "part"},         {TpchTable::PartSupp, "partsupp"}, {TpchTable::Supplier, "supplier"},
+      {TpchTable::Customer, "customer"}, {TpchTable::Orders, "orders"},     {TpchTable::LineItem, "lineitem"},
+      {TpchTable::Nation, "nation"},     {TpchTable::Region, "region"}};
+  return names.at(table);
+}
+
+uint64_t TpchTableGenerator::row_count(const TpchTable table) const {
+  switch (table) {
+    case TpchTable::Part:
+      return _part_count;
+    case TpchTable::PartSupp:
+      return _part_count * 4;
+    case TpchTable::Supplier:
+      return _supplier_count;
+    case TpchTable::Customer:
+      return _customer_count;
+    case TpchTable::Orders:
+      return _order_count;
+    case TpchTable::LineItem:
+      return _first_line_item_by_order().back();
+    case TpchTable::Nation:
+      return NATIONS.size();
+    case TpchTable::Region:
+      return REGIONS.size();
+  }
+  Fail("Unknown TPC-H table");
+  return 0;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_table(
+    const std::vector<std::pair<std::string, DataType>>& column_definitions, const uint64_t row_count,
+    const ChunkGenerator& generate_chunk) const {
+  auto table = std::make_shared<Table>(_chunk_size);
+  for (const auto& column_definition : column_definitions) {
+    table->add_column_definition(column_definition.first, column_definition.second);
+  }
+
+  const auto rows_per_chunk = _chunk_size != 0 ? uint64_t{_chunk_size} : std::max(row_count, uint64_t{1});
+  const auto chunk_count = (row_count + rows_per_chunk - 1) / rows_per_chunk;
+  auto chunks = std::vector<Chunk>(chunk_count);
+
+  // Chunks are distributed dynamically, as generating the last one is cheaper and cost per row varies between orders
+  parallel_for(chunk_count, _worker_count, [&](const size_t index) {
+    const auto first_row = index * rows_per_chunk;
+    const auto chunk_row_count = static_cast<uint32_t>(std::min(rows_per_chunk, row_count - first_row));
+    chunks[index] = generate_chunk(first_row, chunk_row_count);
+  });
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+Chunk TpchTableGenerator::_generate_part_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto part_keys = reserved_values<int32_t>(row_count);
+  auto names = reserved_values<std::string>(row_count);
+  auto manufacturers = reserved_values<std::string>(row_count);
+  auto brands = reserved_values<std::string>(row_count);
+  auto types = reserved_values<std::string>(row_count);
+  auto sizes = reserved_values<int32_t>(row_count);
+  auto containers = reserved_values<std::string>(row_count);
+  auto retail_prices = reserved_values<double>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Part, row};
+    const auto part_key = static_cast<int32_t>(row + 1);
+    part_keys.push_back(part_key);
+
+    auto name = std::string(random.pick(COLORS));
+    for (auto word = 1; word < 5; ++word) {
+      name += ' ';
+      name += random.pick(COLORS);
+    }
+    names.push_back(std::move(name));
+
+    const auto manufacturer = random.number(1, 5);
+    manufacturers.push_back("Manufacturer#" + std::to_string(manufacturer));
+    brands.push_back("Brand#" + std::to_string(manufacturer) + std::to_string(random.number(1, 5)));
+    types.push_back(std::string(random.pick(TYPE_SYLLABLES_1)) + " " + random.pick(TYPE_SYLLABLES_2) + " " +
+                    random.pick(TYPE_SYLLABLES_3));
+    sizes.push_back(static_cast<int32_t>(random.number(1, 50)));
+    containers.push_back(std::string(random.pick(CONTAINER_SYLLABLES_1)) + " " + random.pick(CONTAINER_SYLLABLES_2));
+    retail_prices.push_back(retail_price(part_key));
+    comments.push_back(random.text(1, 3));
+  }
+
+  return make_sealed_chunk(std::move(part_keys), std::move(names), std::move(manufacturers), std::move(brands),
+                           std::move(types), std::move(sizes), std::move(containers), std::move(retail_prices),
+                           std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_part_supp_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto part_keys = reserved_values<int32_t>(row_count);
+  auto supplier_keys = reserved_values<int32_t>(row_count);
+  auto available_quantities = reserved_values<int32_t>(row_count);
+  auto supply_costs = reserved_values<double>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::PartSupp, row};
+    const auto part_key = static_cast<int32_t>(row / 4 + 1);
+    part_keys.push_back(part_key);
+    supplier_keys.push_back(supplier_key(part_key, static_cast<int64_t>(row % 4), _supplier_count));
+    available_quantities.push_back(static_cast<int32_t>(random.number(1, 9'999)));
+    supply_costs.push_back(random.decimal(1.0, 1'000.0));
+    comments.push_back(random.text(5, 15));
+  }
+
+  return make_sealed_chunk(std::move(part_keys), std::move(supplier_keys), std::move(available_quantities),
+                           std::move(supply_costs), std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_supplier_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto supplier_keys = reserved_values<int32_t>(row_count);
+  auto names = reserved_values<std::string>(row_count);
+  auto addresses = reserved_values<std::string>(row_count);
+  auto nation_keys = reserved_values<int32_t>(row_count);
+  auto phones = reserved_values<std::string>(row_count);
+  auto account_balances = reserved_values<double>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Supplier, row};
+    supplier_keys.push_back(static_cast<int32_t>(row + 1));
+    names.push_back(name_with_key("Supplier#", row + 1));
+    addresses.push_back(random.alphanumeric(10, 40));
+    const auto nation_key = static_cast<int32_t>(random.number(0, static_cast<int64_t>(NATIONS.size()) - 1));
+    nation_keys.push_back(nation_key);
+    phones.push_back(random.phone(nation_key));
+    account_balances.push_back(random.decimal(-999.99, 9'999.99));
+    comments.push_back(random.text(3, 10));
+  }
+
+  return make_sealed_chunk(std::move(supplier_keys), std::move(names), std::move(addresses), std::move(nation_keys),
+                           std::move(phones), std::move(account_balances), std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_customer_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto customer_keys = reserved_values<int32_t>(row_count);
+  auto names = reserved_values<std::string>(row_count);
+  auto addresses = reserved_values<std::string>(row_count);
+  auto nation_keys = reserved_values<int32_t>(row_count);
+  auto phones = reserved_values<std::string>(row_count);
+  auto account_balances = reserved_values<double>(row_count);
+  auto market_segments = reserved_values<std::string>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Customer, row};
+    customer_keys.push_back(static_cast<int32_t>(row + 1));
+    names.push_back(name_with_key("Customer#", row + 1));
+    addresses.push_back(random.alphanumeric(10, 40));
+    const auto nation_key = static_cast<int32_t>(random.number(0, static_cast<int64_t>(NATIONS.size()) - 1));
+    nation_keys.push_back(nation_key);
+    phones.push_back(random.phone(nation_key));
+    account_balances.push_back(random.decimal(-999.99, 9'999.99));
+    market_segments.push_back(random.pick(SEGMENTS));
+    comments.push_back(random.text(3, 12));
+  }
+
+  return make_sealed_chunk(std::move(customer_keys), std::move(names), std::move(addresses), std::move(nation_keys),
+                           std::move(phones), std::move(account_balances), std::move(market_segments),
+                           std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_orders_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto order_keys = reserved_values<int64_t>(row_count);
+  auto customer_keys = reserved_values<int32_t>(row_count);
+  auto order_statuses = reserved_values<std::string>(row_count);
+  auto total_prices = reserved_values<double>(row_count);
+  auto order_dates = reserved_values<std::string>(row_count);
+  auto order_priorities = reserved_values<std::string>(row_count);
+  auto clerks = reserved_values<std::string>(row_count);
+  auto ship_priorities = reserved_values<int32_t>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  const auto& dates = date_strings();
+  const auto clerk_count = std::max(int64_t{1}, static_cast<int64_t>(std::llround(_scale_factor * 1'000)));
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Orders, row};
+    const auto header = generate_order_header(random, _customer_count);
+    order_keys.push_back(order_key(row));
+    customer_keys.push_back(header.customer_key);
+
+    // The total price and status summarize the lineitems, which are generated again for that
+    auto total_price = 0.0;
+    auto shipped_line_item_count = uint32_t{0};
+    for (auto line_number = uint32_t{1}; line_number <= header.line_item_count; ++line_number) {
+      auto line_item_random_generator = line_item_random(row, line_number);
+      const auto line_item =
+          generate_line_item(line_item_random_generator, header.order_date, _part_count, _supplier_count);
+      total_price += line_item.extended_price * (1.0 + line_item.tax) * (1.0 - line_item.discount);
+      if (line_item.ship_date <= CURRENT_DATE) ++shipped_line_item_count;
+    }
+    if (shipped_line_item_count == header.line_item_count) {
+      order_statuses.push_back("F");
+    } else if (shipped_line_item_count == 0) {
+      order_statuses.push_back("O");
+    } else {
+      order_statuses.push_back("P");
+    }
+    total_prices.push_back(std::round(total_price * 100.0) / 100.0);
+
+    order_dates.push_back(dates[header.order_date]);
+    order_priorities.push_back(random.pick(PRIORITIES));
+    clerks.push_back(name_with_key("Clerk#", random.number(1, clerk_count)));
+    ship_priorities.push_back(0);
+    comments.push_back(random.text(3, 10));
+  }
+
+  return make_sealed_chunk(std::move(order_keys), std::move(customer_keys), std::move(order_statuses),
+                           std::move(total_prices), std::move(order_dates), std::move(order_priorities),
+                           std::move(clerks), std::move(ship_priorities), std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_line_item_chunk(const uint64_t first_row, const uint32_t row_count,
+                                                    const std::vector<uint64_t>& first_line_item_by_order) const {
+  auto order_keys = reserved_values<int64_t>(row_count);
+  auto part_keys = reserved_values<int32_t>(row_count);
+  auto supplier_keys = reserved_values<int32_t>(row_count);
+  auto line_numbers = reserved_values<int32_t>(row_count);
+  auto quantities = reserved_values<double>(row_count);
+  auto extended_prices = reserved_values<double>(row_count);
+  auto discounts = reserved_values<double>(row_count);
+  auto taxes = reserved_values<double>(row_count);
+  auto return_flags = reserved_values<std::string>(row_count);
+  auto line_statuses = reserved_values<std::string>(row_count);
+  auto ship_dates = reserved_values<std::string>(row_count);
+  auto commit_dates = reserved_values<std::string>(row_count);
+  auto receipt_dates = reserved_values<std::string>(row_count);
+  auto ship_instructions = reserved_values<std::string>(row_count);
+  auto ship_modes = reserved_values<std::string>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  const auto& dates = date_strings();
+
+  // the order of the first row, which may have lineitems in the previous chunk
+  auto order_index = static_cast<uint64_t>(
+      std::upper_bound(first_line_item_by_order.cbegin(), first_line_item_by_order.cend(), first_row) -
+      first_line_item_by_order.cbegin() - 1);
+  auto line_number = static_cast<uint32_t>(first_row - first_line_item_by_order[order_index] + 1);
+
+  auto order_random = RowRandom{TpchTable::Orders, order_index};
+  auto header = generate_order_header(order_random, _customer_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    if (row == first_line_item_by_order[order_index + 1]) {
+      ++order_index;
+      line_number = 1;
+      order_random = RowRandom{TpchTable::Orders, order_index};
+      header = generate_order_header(order_random, _customer_count);
+    }
+
+    auto random = line_item_random(order_index, line_number);
+    const auto line_item = generate_line_item(random, header.order_date, _part_count, _supplier_count);
+
+    order_keys.push_back(order_key(order_index));
+    part_keys.push_back(line_item.part_key);
+    supplier_keys.push_back(line_item.supplier_key);
+    line_numbers.push_back(static_cast<int32_t>(line_number));
+    quantities.push_back(line_item.quantity);
+    extended_prices.push_back(line_item.extended_price);
+    discounts.push_back(line_item.discount);
+    taxes.push_back(line_item.tax);
+    if (line_item.receipt_date <= CURRENT_DATE) {
+      return_flags.push_back(random.number(0, 1) == 0 ? "R" : "A");
+    } else {
+      return_flags.push_back("N");
+    }
+    line_statuses.push_back(line_item.ship_date > CURRENT_DATE ? "O" : "F");
+    ship_dates.push_back(dates[line_item.ship_date]);
+    commit_dates.push_back(dates[line_item.commit_date]);
+    receipt_dates.push_back(dates[line_item.receipt_date]);
+    ship_instructions.push_back(random.pick(INSTRUCTIONS));
+    ship_modes.push_back(random.pick(MODES));
+    comments.push_back(random.text(2, 6));
+
+    ++line_number;
+  }
+
+  return make_sealed_chunk(std::move(order_keys), std::move(part_keys), std::move(supplier_keys),
+                           std::move(line_numbers), std::move(quantities), std::move(extended_prices),
+                           std::move(discounts), std::move(taxes), std::move(return_flags), std::move(line_statuses),
+                           std::move(ship_dates), std::move(commit_dates), std::move(receipt_dates),
+                           std::move(ship_instructions), std::move(ship_modes), std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_nation_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto nation_keys = reserved_values<int32_t>(row_count);
+  auto names = reserved_values<std::string>(row_count);
+  auto region_keys = reserved_values<int32_t>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Nation, row};
+    nation_keys.push_back(static_cast<int32_t>(row));
+    names.push_back(NATIONS[row].first);
+    region_keys.push_back(NATIONS[row].second);
+    comments.push_back(random.text(5, 15));
+  }
+
+  return make_sealed_chunk(std::move(nation_keys), std::move(names), std::move(region_keys), std::move(comments));
+}
+
+Chunk TpchTableGenerator::_generate_region_chunk(const uint64_t first_row, const uint32_t row_count) const {
+  auto region_keys = reserved_values<int32_t>(row_count);
+  auto names = reserved_values<std::string>(row_count);
+  auto comments = reserved_values<std::string>(row_count);
+
+  for (auto row = first_row; row < first_row + row_count; ++row) {
+    auto random = RowRandom{TpchTable::Region, row};
+    region_keys.push_back(static_cast<int32_t>(row));
+    names.push_back(REGIONS[row]);
+    comments.push_back(random.text(5, 15));
+  }
+
+  return make_sealed_chunk(std::move(region_keys), std::move(names), std::move(comments));
+}
+
+std::vector<uint64_t> TpchTableGenerator::_first_line_item_by_order() const {
+  auto first_line_item_by_order = std::vector<uint64_t>{};
+  first_line_item_by_order.reserve(_order_count + 1);
+  auto line_item_count = uint64_t{0};
+  for (auto order_index = uint64_t{0}; order_index < _order_count; ++order_index) {
+    first_line_item_by_order.push_back(line_item_count);
+    auto random = RowRandom{TpchTable::Orders, order_index};
+    line_item_count += generate_order_header(random, _customer_count).line_item_count;
+  }
+  first_line_item_by_order.push_back(line_item_count);
+  return first_line_item_by_order;
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+enum class TpchTable : uint8_t { Part, PartSupp, Supplier, Customer, Orders, LineItem, Nation, Region };
+
+/**
+ * Generates the tables of the TPC-H benchmark for a scale factor, e.g., 1.0 for 6 million lineitems. The schema, key
+ * relationships and value domains follow the specification, but the generator is not a replacement for dbgen: texts are
+ * shorter, decimals are doubles and dates are strings (YYYY-MM-DD), which compare like dates.
+ *
+ *   TpchTableGenerator{0.1, 100'000}.generate_and_store();  // adds "lineitem", "orders", ... to the StorageManager
+ *
+ * Chunks are built directly from vectors of values, bypassing Table::append, and in parallel: every worker fills and
+ * seals whole chunks. Each row draws its values from a random generator seeded by its table and its row index, never
+ * from a generator shared between rows. Thus, the generated tables are the same for every number of workers and every
+ * chunk size, and references between tables (e.g., the total price of an order and its lineitems) are consistent.
+ */
+class TpchTableGenerator {
+ public:
+  // A worker_count of 0 uses all hardware threads
+  TpchTableGenerator(const double scale_factor, const uint32_t chunk_size, const size_t worker_count = 0);
+
+  std::shared_ptr<Table> generate_table(const TpchTable table) const;
+
+  // returns all tables by their name
+  std::map<std::string, std::shared_ptr<Table>> generate_all_tables() const;
+
+  // adds all tables to the StorageManager, which must not contain any of them yet
+  void generate_and_store() const;
+
+  static const std::string& table_name(const TpchTable table);
+
+  uint64_t row_count(const TpchTable table) const;
+
+ protected:
+  using ChunkGenerator = std::function<Chunk(const uint64_t first_row, const uint32_t row_count)>;
+
+  // creates the table and its chunks of row_count rows in total, generating them in parallel
+  std::shared_ptr<Table> _generate_table(const std::vector<std::pair<std::string, DataType>>& column_definitions,
+                                         const uint64_t row_count, const ChunkGenerator& generate_chunk) const;
+
+  Chunk _generate_part_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_part_supp_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_supplier_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_customer_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_orders_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_line_item_chunk(const uint64_t first_row, const uint32_t row_count,
+                                  const std::vector<uint64_t>& first_line_item_by_order) const;
+  Chunk _generate_nation_chunk(const uint64_t first_row, const uint32_t row_count) const;
+  Chunk _generate_region_chunk(const uint64_t first_row, const uint32_t row_count) const;
+
+  // Returns the index of the first lineitem of every order, followed by the number of lineitems. Lineitem chunks start
+  // in the middle of an order and use it to find the order of their first row.
+  std::vector<uint64_t> _first_line_item_by_order() const;
+
+  const double _scale_factor;
+  const uint32_t _chunk_size;
+  const size_t _worker_count;
+
+  const uint64_t _part_count;
+  const uint64_t _supplier_count;
+  const uint64_t _customer_count;
+  const uint64_t _order_count;
+};
+
+}  // namespace opossum
@@ -1,9 +1,116 @@
 #include "type_cast.hpp"
 
+// the linter wants this to be above everything else
+#include <charconv>
+
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
 #include <string>
+#include <system_error>
+#include <type_traits>
 
 namespace opossum {
 
-std::string to_string(const AllTypeVariant& x) { return boost::lexical_cast<std::string>(x); }
+namespace {
+
+// std::from_chars does not accept a leading plus sign, but boost::lexical_cast (which was used before) does
+const char* skip_plus_sign(const char* begin, const char* end) {
+  if (end - begin >= 2 && *begin == '+' && *(begin + 1) != '-') return begin + 1;
+  return begin;
+}
+
+template <typename T>
+bool parse_integral(const std::string& string, T& result) {
+  const auto* end = string.data() + string.size();
+  const auto* begin = skip_plus_sign(string.data(), end);
+  const auto parse_result = std::from_chars(begin, end, result);
+  return parse_result.ec == std::errc() && parse_result.ptr == end;
+}
+
+template <typename T>
+std::string format_integral(const T value) {
+  // digits10 + 1 digits plus the sign
+  auto buffer = std::array<char, std::numeric_limits<T>::digits10 + 2>{};
+  const auto format_result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  DebugAssert(format_result.ec == std::errc(), "Buffer too small");
+  return std::string(buffer.data(), format_result.ptr);
+}
+
+// Floating point support of std::from_chars/to_chars is missing in some standard libraries, which we detect using the
+// feature test macro. In that case, fall back to the C functions, which do not allocate either.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+template <typename T>
+bool parse_floating_point(const std::string& string, T& result) {
+  const auto* end = string.data() + string.size();
+  const auto* begin = skip_plus_sign(string.data(), end);
+  const auto parse_result = std::from_chars(begin, end, result);
+  return parse_result.ec == std::errc() && parse_result.ptr == end;
+}
+
+template <typename T>
+std::string format_floating_point(const T value) {
+  // sign, digits, decimal point, and exponent (e.g., "e-308")
+  auto buffer = std::array<char, std::numeric_limits<T>::max_digits10 + 10>{};
+  const auto format_result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+                                           std::chars_format::general, std::numeric_limits<T>::max_digits10);
+  DebugAssert(format_result.ec == std::errc(), "Buffer too small");
+  return std::string(buffer.data(), format_result.ptr);
+}
+
+#else
+
+template <typename T>
+bool parse_floating_point(const std::string& string, T& result) {
+  // strtod skips leading whitespace, lexical_cast does not
+  if (string.empty() || std::isspace(static_cast<unsigned char>(string.front()))) return false;
+
+  char* parse_end = nullptr;
+  errno = 0;
+  if constexpr (std::is_same<T, float>::value) {
+    result = std::strtof(string.c_str(), &parse_end);
+  } else {
+    result = std::strtod(string.c_str(), &parse_end);
+  }
+  return errno != ERANGE && parse_end == string.c_str() + string.size();
+}
+
+template <typename T>
+std::string format_floating_point(const T value) {
+  auto buffer = std::array<char, std::numeric_limits<T>::max_digits10 + 10>{};
+  const auto length = std::snprintf(buffer.data(), buffer.size(), "%.*g", std::numeric_limits<T>::max_digits10,
+                                    static_cast<double>(value));
+  return std::string(buffer.data(), length);
+}
+
+#endif
+
+}  // namespace
+
+namespace detail {
+
+bool parse_number(const std::string& string, int32_t& result) { return parse_integral(string, result); }
+
+bool parse_number(const std::string& string, int64_t& result) { return parse_integral(string, result); }
+
+bool parse_number(const std::string& string, float& result) { return parse_floating_point(string, result); }
+
+bool parse_number(const std::string& string, double& result) { return parse_floating_point(string, result); }
+
+std::string format_number(int32_t value) { return format_integral(value); }
+
+std::string format_number(int64_t value) { return format_integral(value); }
+
+std::string format_number(float value) { return format_floating_point(value); }
+
+std::string format_number(double value) { return format_floating_point(value); }
+
+}  // namespace detail
+
+std::string to_string(const AllTypeVariant& x) { return type_cast<std::string>(x); }
 
 }  // namespace opossum
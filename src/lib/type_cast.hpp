@@ -5,11 +5,20 @@
 #include <boost/hana/not_equal.hpp>
 #include <boost/hana/size.hpp>
 #include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
 
+// the linter wants this to be above everything else
+#include <optional>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -24,6 +33,77 @@ constexpr auto index_of(Sequence const& sequence, T const& element) {
   return decltype(size)::value;
 }
 
+// Parse a number without throwing exceptions or allocating memory. Like boost::lexical_cast, they do not accept
+// surrounding whitespace. They return false if the string is not a number or the number does not fit into the result.
+bool parse_number(const std::string& string, int32_t& result);
+bool parse_number(const std::string& string, int64_t& result);
+bool parse_number(const std::string& string, float& result);
+bool parse_number(const std::string& string, double& result);
+
+// Format a number without going through a stream. Floating point numbers are printed with max_digits10 significant
+// digits (as done by boost::lexical_cast) so that they can be parsed back to the same value.
+std::string format_number(int32_t value);
+std::string format_number(int64_t value);
+std::string format_number(float value);
+std::string format_number(double value);
+
+// Converts a value of one of the COLUMN_TYPES into another one. Returns false if the value cannot be represented.
+template <typename T, typename From>
+bool convert(const From& from, T& result) {
+  if constexpr (std::is_same<T, From>::value) {
+    result = from;
+    return true;
+  } else if constexpr (std::is_same<T, std::string>::value) {  // NOLINT
+    result = format_number(from);
+    return true;
+  } else if constexpr (std::is_same<From, std::string>::value) {
+    if (parse_number(from, result)) return true;
+
+    if constexpr (std::is_integral<T>::value) {
+      // For integral types, strings holding a floating point number are accepted and truncated
+      auto floating_point = double{};
+      return parse_number(from, floating_point) && convert(floating_point, result);
+    }
+    return false;
+  } else if constexpr (std::is_integral<T>::value && std::is_floating_point<From>::value) {  // NOLINT
+    // Truncates towards zero. Values outside of the range of T, including NaN and infinity, are rejected. The limit
+    // is a power of two and thus exactly representable as From.
+    constexpr auto limit = static_cast<From>(uint64_t{1} << std::numeric_limits<T>::digits);
+    const auto truncated = std::trunc(from);
+    if (!(truncated >= -limit && truncated < limit)) return false;
+    result = static_cast<T>(truncated);
+    return true;
+  } else if constexpr (std::is_integral<T>::value && std::is_integral<From>::value) {  // NOLINT
+    if constexpr (sizeof(From) > sizeof(T)) {
+      if (from < std::numeric_limits<T>::min() || from > std::numeric_limits<T>::max()) return false;
+    }
+    result = static_cast<T>(from);
+    return true;
+  } else {
+    static_assert(std::is_floating_point<T>::value && std::is_arithmetic<From>::value, "Unsupported conversion");
+    if constexpr (std::is_floating_point<From>::value && sizeof(From) > sizeof(T)) {
+      if (std::isfinite(from) && std::abs(from) > std::numeric_limits<T>::max()) return false;
+    }
+    result = static_cast<T>(from);
+    return true;
+  }
+}
+
+// Converts the value held by an AllTypeVariant into result
+template <typename T>
+class ConvertVisitor : public boost::static_visitor<bool> {
+ public:
+  explicit ConvertVisitor(T& result) : _result{result} {}
+
+  template <typename From>
+  bool operator()(const From& from) const {
+    return convert(from, _result);
+  }
+
+ protected:
+  T& _result;
+};
+
 }  // namespace detail
 
 // Retrieves the value stored in an AllTypeVariant without conversion
@@ -35,24 +115,33 @@ const T& get(const AllTypeVariant& value) {
 
 // cast methods - from variant to specific type
 
-// Template specialization for everything but integral types
+// Converts the value into T. Returns std::nullopt if that is not possible, e.g., because a string does not hold a
+// number or a number is out of the range of T. Apart from the result itself, this does not allocate memory.
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
+std::optional<T> try_type_cast(const AllTypeVariant& value) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
   if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
 
-  return boost::lexical_cast<T>(value);
+  auto result = T{};
+  if (!boost::apply_visitor(detail::ConvertVisitor<T>{result}, value)) return std::nullopt;
+  return result;
 }
 
-// Template specialization for integral types
+// Converts the value into T and fails if that is not possible. Floating point numbers are truncated when converted
+// into integral types.
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
+T type_cast(const AllTypeVariant& value) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
   if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+  auto result = T{};
+  if (!boost::apply_visitor(detail::ConvertVisitor<T>{result}, value)) {
+    Fail("Cannot convert " + type_cast<std::string>(value) + " to " + data_type_to_string(data_type_from_type<T>()));
   }
+  return result;
 }
 
+// returns the string representation of the value
+std::string to_string(const AllTypeVariant& x);
+
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -53,6 +55,30 @@ struct RowID {
 
 using PosList = std::vector<RowID>;
 
+// Storage structures accept a memory resource so that, e.g., aligned or huge-page-backed memory can be used. We use
+// boost's implementation because std::pmr is not available in all supported standard libraries.
+template <typename T>
+using PolymorphicAllocator = boost::container::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
+// Size of a cache line in bytes, used to align data structures accessed by SIMD instructions
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// OpLike matches strings against a pattern of SQL's LIKE, see LikeMatcher
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpLike
+};
+
+enum class OrderByMode { Ascending, Descending };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
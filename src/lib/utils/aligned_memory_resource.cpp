@@ -0,0 +1,62 @@
+#include "aligned_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AlignedMemoryResource::AlignedMemoryResource(const size_t alignment, const bool use_huge_pages)
+    : _alignment{alignment}, _use_huge_pages{use_huge_pages} {
+  Assert(alignment >= sizeof(void*) && (alignment & (alignment - 1)) == 0,
+         "Alignment has to be a power of two and at least the size of a pointer");
+}
+
+AlignedMemoryResource& AlignedMemoryResource::cache_line_aligned_resource() {
+  static AlignedMemoryResource resource{CACHE_LINE_SIZE, false};
+  return resource;
+}
+
+AlignedMemoryResource& AlignedMemoryResource::huge_page_resource() {
+  static AlignedMemoryResource resource{CACHE_LINE_SIZE, true};
+  return resource;
+}
+
+size_t AlignedMemoryResource::alignment() const { return _alignment; }
+
+bool AlignedMemoryResource::uses_huge_pages() const { return _use_huge_pages; }
+
+void* AlignedMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  alignment = std::max(alignment, _alignment);
+
+  const auto use_huge_pages = _use_huge_pages && bytes >= HUGE_PAGE_SIZE;
+  if (use_huge_pages) {
+    // Transparent huge pages are only used for huge-page-aligned ranges. Thus, we align the memory and round up its
+    // size so that the entire allocation can be backed by huge pages.
+    alignment = std::max(alignment, HUGE_PAGE_SIZE);
+    bytes = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+  }
+
+  void* pointer = nullptr;
+  if (posix_memalign(&pointer, alignment, bytes) != 0) throw std::bad_alloc{};
+
+#ifdef MADV_HUGEPAGE
+  // This is only a hint, failures (e.g., if transparent huge pages are disabled) are deliberately ignored
+  if (use_huge_pages) madvise(pointer, bytes, MADV_HUGEPAGE);
+#endif
+
+  return pointer;
+}
+
+void AlignedMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) { std::free(pointer); }
+
+bool AlignedMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  // Memory can be deallocated by any instance as all of them use free()
+  return dynamic_cast<const AlignedMemoryResource*>(&other) != nullptr;
+}
+
+}  // namespace opossum
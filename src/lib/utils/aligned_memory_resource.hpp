@@ -0,0 +1,47 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A memory resource that aligns all allocations to (at least) a cache line so that columns can be processed using
+ * aligned SIMD loads. Optionally, large allocations (e.g., the values of a full chunk) are placed on transparent huge
+ * pages, which reduces TLB misses when scanning them. If the kernel does not support huge pages, the memory is still
+ * aligned to the huge page size but backed by regular pages.
+ *
+ * Pass it to a Table to use it for all of its chunks:
+ *
+ *   auto table = std::make_shared<Table>(chunk_size, &AlignedMemoryResource::huge_page_resource());
+ *
+ * The resource has to outlive all structures allocated from it. The static instances satisfy this requirement.
+ */
+class AlignedMemoryResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  explicit AlignedMemoryResource(const size_t alignment = CACHE_LINE_SIZE, const bool use_huge_pages = false);
+
+  // cache-line-aligned resource without huge pages
+  static AlignedMemoryResource& cache_line_aligned_resource();
+
+  // cache-line-aligned resource that backs allocations of at least HUGE_PAGE_SIZE bytes with huge pages
+  static AlignedMemoryResource& huge_page_resource();
+
+  size_t alignment() const;
+  bool uses_huge_pages() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  const size_t _alignment;
+  const bool _use_huge_pages;
+};
+
+}  // namespace opossum
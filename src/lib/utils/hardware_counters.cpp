@@ -0,0 +1,118 @@
+#include "hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <string>
+
+#include "assert.hpp"
+
+namespace {
+
+#ifdef __linux__
+// Returns the file descriptor of a counter for the calling thread on any CPU, or -1 if access is denied. Threads that
+// the calling thread creates later inherit the counter, whose value includes theirs once they have exited.
+int open_event(const uint32_t type, const uint64_t config) {
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = type;
+  attributes.config = config;
+  attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.inherit = 1;
+
+  return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+std::string hardware_event_to_string(HardwareEvent event) {
+  switch (event) {
+    case HardwareEvent::Cycles:
+      return "cycles";
+    case HardwareEvent::Instructions:
+      return "instructions";
+    case HardwareEvent::LLCMisses:
+      return "LLC misses";
+    case HardwareEvent::BranchMisses:
+      return "branch misses";
+  }
+  Fail("Unknown hardware event");
+  return "";
+}
+
+const std::optional<uint64_t>& HardwareCounterValues::operator[](HardwareEvent event) const {
+  return values[static_cast<size_t>(event)];
+}
+
+std::optional<uint64_t>& HardwareCounterValues::operator[](HardwareEvent event) {
+  return values[static_cast<size_t>(event)];
+}
+
+HardwareCounters::HardwareCounters() {
+  _file_descriptors.fill(-1);
+#ifdef __linux__
+  _file_descriptors[static_cast<size_t>(HardwareEvent::Cycles)] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  _file_descriptors[static_cast<size_t>(HardwareEvent::Instructions)] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  _file_descriptors[static_cast<size_t>(HardwareEvent::LLCMisses)] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  _file_descriptors[static_cast<size_t>(HardwareEvent::BranchMisses)] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor >= 0) close(file_descriptor);
+  }
+#endif
+}
+
+bool HardwareCounters::available() const {
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor >= 0) return true;
+  }
+  return false;
+}
+
+void HardwareCounters::start() {
+#ifdef __linux__
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor < 0) continue;
+    ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+HardwareCounterValues HardwareCounters::stop() {
+  HardwareCounterValues counter_values;
+#ifdef __linux__
+  for (auto event_index = size_t{0}; event_index < HARDWARE_EVENT_COUNT; ++event_index) {
+    const auto file_descriptor = _file_descriptors[event_index];
+    if (file_descriptor < 0) continue;
+    ioctl(file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+    auto value = uint64_t{0};
+    if (read(file_descriptor, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+      counter_values.values[event_index] = value;
+    }
+  }
+#endif
+  return counter_values;
+}
+
+}  // namespace opossum
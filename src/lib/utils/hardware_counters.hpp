@@ -0,0 +1,83 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <optional>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The hardware events measured by HardwareCounters
+enum class HardwareEvent : uint8_t { Cycles, Instructions, LLCMisses, BranchMisses };
+
+constexpr size_t HARDWARE_EVENT_COUNT = 4;
+
+std::string hardware_event_to_string(HardwareEvent event);
+
+// Values measured by HardwareCounters. Events that could not be measured are std::nullopt.
+struct HardwareCounterValues {
+  std::array<std::optional<uint64_t>, HARDWARE_EVENT_COUNT> values;
+
+  const std::optional<uint64_t>& operator[](HardwareEvent event) const;
+  std::optional<uint64_t>& operator[](HardwareEvent event);
+};
+
+/**
+ * HardwareCounters measures hardware events of the calling thread between start() and stop() using the perf_event_open
+ * system call of Linux. Threads that the calling thread creates after constructing the HardwareCounters, e.g., the
+ * workers of TopK, are included once they have exited, i.e., they need to be joined before stop(). Each event is
+ * opened separately: if the kernel denies access to some or all events (e.g., because of kernel.perf_event_paranoid or
+ * when running in a container or VM), these are reported as std::nullopt and the others are still measured. On other
+ * operating systems, no event is available.
+ *
+ * As opening the events costs a couple of system calls, measuring is opt-in, see HardwareCounterProfiling.
+ */
+class HardwareCounters : private Noncopyable {
+ public:
+  HardwareCounters();
+  ~HardwareCounters();
+
+  // returns true if at least one event can be measured
+  bool available() const;
+
+  void start();
+  HardwareCounterValues stop();
+
+ protected:
+  // file descriptors returned by perf_event_open, -1 for unavailable events
+  std::array<int, HARDWARE_EVENT_COUNT> _file_descriptors;
+};
+
+/**
+ * While an instance of HardwareCounterProfiling exists, operators measure hardware events and the size of their inputs
+ * during their execution (see AbstractOperator::performance_data). It is used in the RAII style of
+ * PerformanceWarningDisabler:
+ *
+ * {
+ *   HardwareCounterProfiling hardware_counter_profiling;
+ *   table_scan->execute();
+ * }
+ */
+class HardwareCounterProfiling {
+ public:
+  HardwareCounterProfiling() : _previously_enabled(_enabled().exchange(true)) {}
+  ~HardwareCounterProfiling() { _enabled() = _previously_enabled; }
+
+  static bool is_enabled() { return _enabled(); }
+
+ protected:
+  // atomic, as operators may check it on other threads than the one that enables profiling
+  static std::atomic<bool>& _enabled() {
+    static std::atomic<bool> enabled{false};
+    return enabled;
+  }
+
+  const bool _previously_enabled;
+};
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include "like_matcher.hpp"
+
+#include <string>
+
+namespace opossum {
+
+LikeMatcher::LikeMatcher(const std::string& pattern) : _pattern(pattern) {
+  const auto literal_begin = _pattern.find_first_not_of(ANY_CHARS);
+  if (literal_begin == std::string::npos) {
+    // The empty pattern only matches the empty string, while any number of '%' matches everything
+    _pattern_type = _pattern.empty() ? PatternType::Exact : PatternType::Contains;
+    return;
+  }
+
+  const auto literal_end = _pattern.find_last_not_of(ANY_CHARS) + 1;
+  _literal = _pattern.substr(literal_begin, literal_end - literal_begin);
+  if (_literal.find(ANY_CHARS) == std::string::npos && _literal.find(ANY_CHAR) == std::string::npos) {
+    const auto is_anchored_at_begin = literal_begin == 0;
+    const auto is_anchored_at_end = literal_end == _pattern.size();
+    if (is_anchored_at_begin) {
+      _pattern_type = is_anchored_at_end ? PatternType::Exact : PatternType::Prefix;
+    } else {
+      _pattern_type = is_anchored_at_end ? PatternType::Suffix : PatternType::Contains;
+    }
+    return;
+  }
+
+  _pattern_type = PatternType::Wildcard;
+  _literal.clear();
+  auto begin = size_t{0};
+  for (auto end = _pattern.find(ANY_CHARS); end != std::string::npos; end = _pattern.find(ANY_CHARS, begin)) {
+    _segments.push_back(_pattern.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  _segments.push_back(_pattern.substr(begin));
+}
+
+bool LikeMatcher::matches(const std::string_view value) const {
+  auto result = false;
+  resolve_kernel([&](const auto& kernel) { result = kernel(value); });
+  return result;
+}
+
+LikeMatcher::PatternType LikeMatcher::pattern_type() const { return _pattern_type; }
+
+const std::string& LikeMatcher::pattern() const { return _pattern; }
+
+bool LikeMatcher::_matches_wildcard(const std::string_view value) const {
+  const auto& first_segment = _segments.front();
+  if (_segments.size() == 1) return value.size() == first_segment.size() && _matches_at(first_segment, value, 0);
+
+  const auto& last_segment = _segments.back();
+  if (value.size() < first_segment.size() + last_segment.size()) return false;
+  const auto last_segment_position = value.size() - last_segment.size();
+  if (!_matches_at(first_segment, value, 0) || !_matches_at(last_segment, value, last_segment_position)) return false;
+
+  // The segments in between must not overlap the first or the last one
+  const auto middle = value.substr(0, last_segment_position);
+  auto position = first_segment.size();
+  for (auto segment_index = size_t{1}; segment_index + 1 < _segments.size(); ++segment_index) {
+    const auto& segment = _segments[segment_index];
+    const auto segment_position = _find(segment, middle, position);
+    if (segment_position == std::string_view::npos) return false;
+    position = segment_position + segment.size();
+  }
+  return true;
+}
+
+bool LikeMatcher::_matches_at(const std::string_view segment, const std::string_view value, const size_t position) {
+  for (auto index = size_t{0}; index < segment.size(); ++index) {
+    if (segment[index] != ANY_CHAR && segment[index] != value[position + index]) return false;
+  }
+  return true;
+}
+
+size_t LikeMatcher::_find(const std::string_view segment, const std::string_view value, const size_t begin) {
+  if (segment.find(ANY_CHAR) == std::string_view::npos) return value.find(segment, begin);
+
+  for (auto position = begin; position + segment.size() <= value.size(); ++position) {
+    if (_matches_at(segment, value, position)) return position;
+  }
+  return std::string_view::npos;
+}
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * LikeMatcher checks strings against a pattern of SQL's LIKE, in which '%' matches any sequence of characters
+ * (including none) and '_' matches any single character. All other characters match themselves, i.e., matching is
+ * case-sensitive and there is no escape character. Characters are bytes, so '_' matches a single byte of a UTF-8
+ * string.
+ *
+ * Most patterns are a literal with '%' at neither, one, or both of its ends, so the pattern is compiled into a kernel
+ * for its type (see PatternType). Scans pass a lambda to resolve_kernel, which is instantiated for each kernel, so that
+ * the check of the pattern type is not repeated per value.
+ *
+ * Other patterns are split at their '%' wildcards into segments. The first segment needs to match at the beginning of
+ * the string and the last one at its end, while those in between are searched for from left to right. As a segment
+ * has a fixed length, matching its leftmost occurrence never rules out a match of the remaining segments.
+ */
+class LikeMatcher {
+ public:
+  static constexpr char ANY_CHARS = '%';
+  static constexpr char ANY_CHAR = '_';
+
+  // The kernels that patterns are compiled into, where "literal" holds no wildcards
+  enum class PatternType {
+    Exact,     // literal
+    Prefix,    // literal%
+    Suffix,    // %literal
+    Contains,  // %literal%, which includes % (with an empty literal)
+    Wildcard   // everything else
+  };
+
+  explicit LikeMatcher(const std::string& pattern);
+
+  bool matches(std::string_view value) const;
+
+  /**
+   * Calls func with the kernel of the pattern, a callable that takes a std::string_view and returns whether it matches:
+   *
+   *   like_matcher.resolve_kernel([&](const auto& kernel) {
+   *     for (...) if (kernel(value)) ...
+   *   });
+   */
+  template <typename Functor>
+  void resolve_kernel(const Functor& func) const {
+    const auto literal = std::string_view{_literal};
+    switch (_pattern_type) {
+      case PatternType::Exact:
+        func([literal](const std::string_view value) { return value == literal; });
+        return;
+      case PatternType::Prefix:
+        func([literal](const std::string_view value) {
+          return value.size() >= literal.size() && std::memcmp(value.data(), literal.data(), literal.size()) == 0;
+        });
+        return;
+      case PatternType::Suffix:
+        func([literal](const std::string_view value) {
+          return value.size() >= literal.size() &&
+                 std::memcmp(value.data() + value.size() - literal.size(), literal.data(), literal.size()) == 0;
+        });
+        return;
+      case PatternType::Contains:
+        func([literal](const std::string_view value) { return _contains(value, literal); });
+        return;
+      case PatternType::Wildcard:
+        func([this](const std::string_view value) { return _matches_wildcard(value); });
+        return;
+    }
+  }
+
+  PatternType pattern_type() const;
+
+  const std::string& pattern() const;
+
+ protected:
+  // Returns whether the literal occurs in the value. Candidate positions are found by looking for the first byte of
+  // the literal using memchr, which the C library vectorizes, and are checked at the last byte before the rest is
+  // compared, as that byte is less likely to match by chance than the ones next to the first.
+  static bool _contains(const std::string_view value, const std::string_view literal) {
+    if (literal.empty()) return true;
+    if (value.size() < literal.size()) return false;
+
+    const auto* position = value.data();
+    const auto* const last_position = value.data() + value.size() - literal.size();
+    const auto last_offset = literal.size() - 1;
+    while (position <= last_position) {
+      const auto remaining_size = static_cast<size_t>(last_position - position) + 1;
+      position = static_cast<const char*>(std::memchr(position, literal[0], remaining_size));
+      if (!position) return false;
+      if (position[last_offset] == literal[last_offset] &&
+          std::memcmp(position + 1, literal.data() + 1, last_offset) == 0) {
+        return true;
+      }
+      ++position;
+    }
+    return false;
+  }
+
+  bool _matches_wildcard(std::string_view value) const;
+
+  // returns whether the segment matches the value at the given position, which needs to leave room for the segment
+  static bool _matches_at(std::string_view segment, std::string_view value, size_t position);
+
+  // returns the first position at or after begin at which the segment matches, or std::string_view::npos
+  static size_t _find(std::string_view segment, std::string_view value, size_t begin);
+
+  std::string _pattern;
+  PatternType _pattern_type;
+
+  // the pattern without its leading and trailing '%' unless the pattern type is Wildcard
+  std::string _literal;
+
+  // Only set if the pattern type is Wildcard: the parts of the pattern between the '%' wildcards, which may be empty
+  std::vector<std::string> _segments;
+};
+
+}  // namespace opossum
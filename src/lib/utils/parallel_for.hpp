@@ -0,0 +1,41 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Calls func(index) for every index in [0, count) on up to max_worker_count threads, of which the calling thread is the
+ * first. Indices are handed out one at a time, so that workers whose indices are cheap take on more of them. If
+ * max_worker_count is 0, one worker per hardware thread is used. Returns once func has returned for all indices.
+ *
+ * Following CONTRIBUTING, errors are not recovered from: an exception thrown by func terminates the program.
+ */
+template <typename Functor>
+void parallel_for(const size_t count, const size_t max_worker_count, const Functor& func) {
+  const auto hardware_worker_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto worker_count =
+      std::clamp(count, size_t{1}, max_worker_count != 0 ? max_worker_count : hardware_worker_count);
+
+  auto next_index = std::atomic<size_t>{0};
+  const auto work = [&]() noexcept {
+    for (auto index = next_index++; index < count; index = next_index++) {
+      func(index);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(worker_count - 1);
+  for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include "performance_counters.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "assert.hpp"
+
+namespace {
+
+// Escapes quotes, backslashes, and control characters so that name can be used as a JSON string
+std::string escape_json(const std::string& name) {
+  std::stringstream escaped;
+  for (const auto character : name) {
+    if (character == '"' || character == '\\') {
+      escaped << '\\' << character;
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec;
+    } else {
+      escaped << character;
+    }
+  }
+  return escaped.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+PerformanceCounters::Shard::Shard() {
+  auto& performance_counters = PerformanceCounters::get();
+  std::lock_guard<std::mutex> lock(performance_counters._mutex);
+  performance_counters._shards.push_back(this);
+}
+
+PerformanceCounters::Shard::~Shard() {
+  auto& performance_counters = PerformanceCounters::get();
+  std::lock_guard<std::mutex> lock(performance_counters._mutex);
+  for (auto counter_id = size_t{0}; counter_id < MAX_COUNTER_COUNT; ++counter_id) {
+    performance_counters._retired_counts[counter_id] += counts[counter_id].load(std::memory_order_relaxed);
+    performance_counters._retired_nanoseconds[counter_id] += nanoseconds[counter_id].load(std::memory_order_relaxed);
+  }
+  auto& shards = performance_counters._shards;
+  shards.erase(std::find(shards.begin(), shards.end(), this));
+}
+
+PerformanceCounters& PerformanceCounters::get() {
+  static PerformanceCounters _instance;
+  return _instance;
+}
+
+size_t PerformanceCounters::register_counter(const std::string& name) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto iter = _ids_by_name.find(name);
+  if (iter != _ids_by_name.end()) return iter->second;
+
+  Assert(_names.size() < MAX_COUNTER_COUNT, "Too many performance counters");
+  const auto counter_id = _names.size();
+  _names.push_back(name);
+  _ids_by_name.emplace(name, counter_id);
+  return counter_id;
+}
+
+std::vector<PerformanceCounterSnapshot> PerformanceCounters::snapshot() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::vector<PerformanceCounterSnapshot> snapshots;
+  snapshots.reserve(_names.size());
+
+  for (auto counter_id = size_t{0}; counter_id < _names.size(); ++counter_id) {
+    auto count = _retired_counts[counter_id];
+    auto nanoseconds = _retired_nanoseconds[counter_id];
+    for (const auto shard : _shards) {
+      count += shard->counts[counter_id].load(std::memory_order_relaxed);
+      nanoseconds += shard->nanoseconds[counter_id].load(std::memory_order_relaxed);
+    }
+    snapshots.push_back({_names[counter_id], count, std::chrono::nanoseconds{nanoseconds}});
+  }
+
+  return snapshots;
+}
+
+void PerformanceCounters::reset() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _retired_counts.fill(0);
+  _retired_nanoseconds.fill(0);
+  for (const auto shard : _shards) {
+    for (auto counter_id = size_t{0}; counter_id < MAX_COUNTER_COUNT; ++counter_id) {
+      shard->counts[counter_id].store(0, std::memory_order_relaxed);
+      shard->nanoseconds[counter_id].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void PerformanceCounters::print(std::ostream& out) const {
+  for (const auto& counter : snapshot()) {
+    out << counter.name << "\t" << counter.count << "\t" << counter.time.count() << std::endl;
+  }
+}
+
+void PerformanceCounters::print_json(std::ostream& out) const {
+  const auto counters = snapshot();
+  out << "[";
+  for (auto index = size_t{0}; index < counters.size(); ++index) {
+    if (index > 0) out << ",";
+    out << "\n  {\"name\": \"" << escape_json(counters[index].name) << "\", \"count\": " << counters[index].count
+        << ", \"nanoseconds\": " << counters[index].time.count() << "}";
+  }
+  out << (counters.empty() ? "]" : "\n]") << std::endl;
+}
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Value of a single performance counter, as reported by PerformanceCounters::snapshot()
+struct PerformanceCounterSnapshot {
+  std::string name;
+  uint64_t count;
+
+  // only increased by PerformanceTimer, zero for counters that are not timed
+  std::chrono::nanoseconds time;
+};
+
+/**
+ * PerformanceCounters is a singleton that counts how often hot code paths, e.g., slow paths marked with a
+ * PerformanceWarning, are executed and how much time is spent in them. Unlike PerformanceWarning's output, counters
+ * are also maintained in release builds so that they can be inspected under real load.
+ *
+ * Each counter is registered once (usually per call site, see PerformanceCount) and then referred to by its id. To keep
+ * the overhead of an increment low, every thread writes to its own shard of counters without synchronization. The
+ * shards are only summed up when a snapshot is taken. The values of exiting threads are kept.
+ *
+ *   void ValueColumn::slow_path() {
+ *     PerformanceCount("slow_path used");  // counts the calls
+ *     PerformanceTimerScope("slow_path");  // counts the calls and measures the time until the end of the scope
+ *     ...
+ *   }
+ *
+ *   PerformanceCounters::get().print_json(std::cout);
+ */
+class PerformanceCounters : private Noncopyable {
+ public:
+  // Shards have a fixed size so that incrementing does not have to synchronize with the registration of counters
+  static constexpr size_t MAX_COUNTER_COUNT = 1024;
+
+  static PerformanceCounters& get();
+
+  // returns the id of the counter with the given name, registering it if necessary
+  size_t register_counter(const std::string& name);
+
+  static void increment(const size_t counter_id, const uint64_t count = 1) {
+    _add(_thread_local_shard().counts[counter_id], count);
+  }
+
+  static void add_time(const size_t counter_id, const std::chrono::nanoseconds time) {
+    _add(_thread_local_shard().nanoseconds[counter_id], static_cast<uint64_t>(time.count()));
+  }
+
+  // returns the current values of all counters, summed up over all threads, in the order of their registration
+  std::vector<PerformanceCounterSnapshot> snapshot() const;
+
+  // sets all counters to zero. Increments that happen concurrently might be lost.
+  void reset();
+
+  // prints one line per counter: name, count, and time in nanoseconds, separated by tabs
+  void print(std::ostream& out = std::cout) const;
+
+  // prints the counters as a JSON array of objects with the keys "name", "count", and "nanoseconds"
+  void print_json(std::ostream& out = std::cout) const;
+
+ protected:
+  // Holds the counter values of one thread. Only the owning thread writes to it, atomics are used so that other
+  // threads can read the values while taking a snapshot.
+  struct Shard {
+    Shard();
+    ~Shard();
+
+    std::array<std::atomic<uint64_t>, MAX_COUNTER_COUNT> counts{};
+    std::array<std::atomic<uint64_t>, MAX_COUNTER_COUNT> nanoseconds{};
+  };
+
+  PerformanceCounters() {}
+
+  static Shard& _thread_local_shard() {
+    thread_local Shard shard;
+    return shard;
+  }
+
+  // A plain load and store instead of fetch_add, as there is only one writer per shard
+  static void _add(std::atomic<uint64_t>& value, const uint64_t addend) {
+    value.store(value.load(std::memory_order_relaxed) + addend, std::memory_order_relaxed);
+  }
+
+  mutable std::mutex _mutex;
+  std::vector<std::string> _names;
+  std::unordered_map<std::string, size_t> _ids_by_name;
+  std::vector<Shard*> _shards;
+
+  // values of threads that have exited
+  std::array<uint64_t, MAX_COUNTER_COUNT> _retired_counts{};
+  std::array<uint64_t, MAX_COUNTER_COUNT> _retired_nanoseconds{};
+};
+
+// RAII-style timer that increments a counter and adds the time until its destruction
+class PerformanceTimer {
+ public:
+  explicit PerformanceTimer(const size_t counter_id)
+      : _counter_id(counter_id), _begin(std::chrono::steady_clock::now()) {}
+
+  ~PerformanceTimer() {
+    PerformanceCounters::increment(_counter_id);
+    PerformanceCounters::add_time(_counter_id, std::chrono::steady_clock::now() - _begin);
+  }
+
+  PerformanceTimer(const PerformanceTimer&) = delete;
+  PerformanceTimer& operator=(const PerformanceTimer&) = delete;
+
+ protected:
+  const size_t _counter_id;
+  const std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace opossum
+
+#ifndef __FILENAME__
+#define __FILENAME__ (__FILE__ + SOURCE_PATH_SIZE)
+#endif
+
+// Name of a counter at the current call site, e.g., "operator[] used at src/lib/storage/value_column.cpp:24"
+#define PERFORMANCE_CALL_SITE(text) \
+  (std::string(text) + " at " + std::string(__FILENAME__) + ":" BOOST_PP_STRINGIZE(__LINE__))
+
+// Id of the counter for the current call site, registered only on the first execution
+#define PERFORMANCE_COUNTER_ID(text)                                                       \
+  ([]() {                                                                                  \
+    static const auto counter_id =                                                         \
+        opossum::PerformanceCounters::get().register_counter(PERFORMANCE_CALL_SITE(text)); \
+    return counter_id;                                                                     \
+  }())
+
+#define PerformanceCount(text) opossum::PerformanceCounters::increment(PERFORMANCE_COUNTER_ID(text))
+
+#define PerformanceTimerScope(text) \
+  const opossum::PerformanceTimer BOOST_PP_CAT(performance_timer_, __LINE__)(PERFORMANCE_COUNTER_ID(text))
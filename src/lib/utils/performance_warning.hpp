@@ -4,6 +4,8 @@
 #include <iostream>
 #include <string>
 
+#include "performance_counters.hpp"
+
 /**
  * Performance Warnings can be used in places where slow workarounds are used. This includes BaseColumn[] or the
  * use of a cross join followed by a projection instead of an equijoin.
@@ -19,6 +21,10 @@
  * // warnings are enabled again
  *
  * Warnings do not print in tests.
+ *
+ * Independently of the printed message, every PerformanceWarning counts how often it is hit (see PerformanceCount).
+ * This also happens in release builds and when warnings are disabled, so that PerformanceCounters::get() tells how
+ * often slow paths are taken under real load.
  */
 
 class PerformanceWarningDisabler;
@@ -59,14 +65,12 @@ class PerformanceWarningDisabler {
 };
 
 #if IS_DEBUG
-#ifndef __FILENAME__
-#define __FILENAME__ (__FILE__ + SOURCE_PATH_SIZE)
-#endif
-#define PerformanceWarning(text)                                                                 \
-  {                                                                                              \
-    static PerformanceWarningClass warn(std::string(text) + " at " + std::string(__FILENAME__) + \
-                                        ":" BOOST_PP_STRINGIZE(__LINE__));                       \
+#define PerformanceWarning(text)                                      \
+  {                                                                   \
+    PerformanceCount(text);                                           \
+    static PerformanceWarningClass warn(PERFORMANCE_CALL_SITE(text)); \
   }  // NOLINT
 #else
-#define PerformanceWarning(text)
+#define PerformanceWarning(text) \
+  { PerformanceCount(text); }  // NOLINT
 #endif
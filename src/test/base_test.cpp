@@ -1,6 +1,9 @@
 #include "base_test.hpp"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,6 +12,7 @@
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
@@ -30,9 +34,32 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
   ASSERT_TABLE_EQ(*tleft, *tright, order_sensitive, strict_types);
 }
 
+uint64_t BaseTest::_counter_value(const std::string& name) {
+  auto count = uint64_t{0};
+  for (const auto& counter : PerformanceCounters::get().snapshot()) {
+    if (counter.name.find(name) == 0) count += counter.count;
+  }
+  return count;
+}
+
+std::string BaseTest::_temp_path(const std::string& name) {
+  const auto temp_directory = std::getenv("TMPDIR");
+  const auto base_directory = std::string{temp_directory && *temp_directory ? temp_directory : "/tmp"};
+  return base_directory + "/" + name + "_" + std::to_string(getpid());
+}
+
+std::shared_ptr<Table> BaseTest::_create_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                               const uint32_t chunk_size) {
+  auto table = std::make_shared<Table>(chunk_size);
+  for (const auto& column : columns) {
+    table->add_column(column.first, column.second);
+  }
+  return table;
+}
+
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& t) {
   // initialize matrix with table sizes
-  Matrix matrix(t.row_count(), std::vector<AllTypeVariant>(t.col_count()));
+  Matrix matrix(t.row_count(), std::vector<CompactValue>(t.col_count()));
 
   // set values
   unsigned row_offset = 0;
@@ -46,7 +73,7 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& t) {
       std::shared_ptr<BaseColumn> column = chunk.get_column(col_id);
 
       for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
-        matrix[row_offset + chunk_offset][col_id] = (*column)[chunk_offset];
+        matrix[row_offset + chunk_offset][col_id] = column->compact_value_at(chunk_offset);
       }
     }
     row_offset += chunk.size();
@@ -124,8 +151,8 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID col{0}; col < left[row].size(); col++) {
       if (tleft.column_type(col) == "float") {
-        auto left_val = type_cast<float>(left[row][col]);
-        auto right_val = type_cast<float>(right[row][col]);
+        auto left_val = type_cast<float>(left[row][col].to_variant());
+        auto right_val = type_cast<float>(right[row][col].to_variant());
 
         if (strict_types) {
           EXPECT_EQ(tright.column_type(col), "float");
@@ -134,8 +161,8 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
         }
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Col:" << row << "/" << col;
       } else if (tleft.column_type(col) == "double") {
-        auto left_val = type_cast<double>(left[row][col]);
-        auto right_val = type_cast<double>(right[row][col]);
+        auto left_val = type_cast<double>(left[row][col].to_variant());
+        auto right_val = type_cast<double>(right[row][col].to_variant());
 
         if (strict_types) {
           EXPECT_EQ(tright.column_type(col), "double");
@@ -145,8 +172,8 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Col:" << row << "/" << col;
       } else {
         if (!strict_types && (tleft.column_type(col) == "int" || tleft.column_type(col) == "long")) {
-          auto left_val = type_cast<int64_t>(left[row][col]);
-          auto right_val = type_cast<int64_t>(right[row][col]);
+          auto left_val = type_cast<int64_t>(left[row][col].to_variant());
+          auto right_val = type_cast<int64_t>(right[row][col].to_variant());
           EXPECT_EQ(left_val, right_val) << "Row:" << row + 1 << " Col:" << col + 1;
         } else {
           EXPECT_EQ(left[row][col], right[row][col]) << "Row:" << row + 1 << " Col:" << col + 1;
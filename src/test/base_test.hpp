@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "../lib/compact_value.hpp"
 #include "../lib/storage/table.hpp"
 #include "../lib/storage/value_column.hpp"
 #include "../lib/types.hpp"
@@ -19,7 +20,8 @@ class Table;
 using Matrix = std::vector<std::vector<AllTypeVariant>>;
 
 class BaseTest : public ::testing::Test {
-  using Matrix = std::vector<std::vector<AllTypeVariant>>;
+  // Strings are views into the compared tables, which avoids copying them
+  using Matrix = std::vector<std::vector<CompactValue>>;
 
   // helper functions for _table_equal
   static BaseTest::Matrix _table_to_matrix(const Table& t);
@@ -46,6 +48,18 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // Returns the sum of the counts of the PerformanceCounters whose names start with name. A name is registered once per
+  // call site, so that it may belong to several counters.
+  static uint64_t _counter_value(const std::string& name);
+
+  // Returns a path in TMPDIR (or /tmp) that starts with name and includes the process id, so that concurrent test runs
+  // do not use the same files
+  static std::string _temp_path(const std::string& name);
+
+  // returns an empty table with the given columns, which are pairs of name and type (see Table::add_column)
+  static std::shared_ptr<Table> _create_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                              uint32_t chunk_size);
+
  public:
   virtual ~BaseTest();
 };
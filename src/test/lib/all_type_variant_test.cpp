@@ -1,4 +1,8 @@
+// the linter wants this to be above everything else
+#include <optional>
+
 #include <cstdlib>
+#include <limits>
 #include <string>
 
 #include "../base_test.hpp"
@@ -73,4 +77,77 @@ TEST_F(AllTypeVariantTest, GetExtractsExactNumericalValue) {
   }
 }
 
+TEST_F(AllTypeVariantTest, TypeCastBetweenNumbers) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{-7}}), -7);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{123}}), 123);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{int32_t{3}}), 3.0);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{2.5}), 2.5f);
+
+  // Floating point numbers are truncated towards zero
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.99}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-3.99f}), -3);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{1e15}), int64_t{1'000'000'000'000'000});
+}
+
+TEST_F(AllTypeVariantTest, TypeCastOutOfRangeFails) {
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{5'000'000'000}}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{3e9}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{2147483648.0}), std::exception);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-2147483648.0}), std::numeric_limits<int32_t>::min());
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{std::numeric_limits<double>::quiet_NaN()}), std::exception);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{1e300}), std::exception);
+}
+
+TEST_F(AllTypeVariantTest, TypeCastFromString) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{std::string{"42"}}), 42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{std::string{"+42"}}), 42);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{std::string{"-9000000000"}}), int64_t{-9'000'000'000});
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{std::string{"3.7"}}), 3);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{std::string{"3.25"}}), 3.25);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{std::string{"1e3"}}), 1000.0f);
+
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::string{"Hi"}}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::string{""}}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::string{" 1"}}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::string{"1x"}}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::string{"+-1"}}), std::exception);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{std::string{"1e999"}}), std::exception);
+}
+
+TEST_F(AllTypeVariantTest, TypeCastToString) {
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int32_t{-12}}), "-12");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{std::numeric_limits<int64_t>::min()}), "-9223372036854775808");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.5}), "0.5");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{1e20}), "1e+20");
+
+  // Floating point numbers are printed with enough digits to be parsed back to the same value
+  const auto value = 0.1;
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{type_cast<std::string>(AllTypeVariant{value})}), value);
+  const auto float_value = 3.14f;
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{type_cast<std::string>(AllTypeVariant{float_value})}), float_value);
+}
+
+TEST_F(AllTypeVariantTest, TryTypeCast) {
+  EXPECT_EQ(try_type_cast<int32_t>(AllTypeVariant{std::string{"17"}}), 17);
+  EXPECT_EQ(try_type_cast<double>(AllTypeVariant{int32_t{2}}), 2.0);
+  EXPECT_EQ(try_type_cast<std::string>(AllTypeVariant{int32_t{2}}), "2");
+  EXPECT_EQ(try_type_cast<int32_t>(AllTypeVariant{std::string{"Hi"}}), std::nullopt);
+  EXPECT_EQ(try_type_cast<int32_t>(AllTypeVariant{1e100}), std::nullopt);
+}
+
+TEST_F(AllTypeVariantTest, DataTypeConversion) {
+  EXPECT_EQ(data_type_from_type<int32_t>(), DataType::Int);
+  EXPECT_EQ(data_type_from_type<int64_t>(), DataType::Long);
+  EXPECT_EQ(data_type_from_type<float>(), DataType::Float);
+  EXPECT_EQ(data_type_from_type<double>(), DataType::Double);
+  EXPECT_EQ(data_type_from_type<std::string>(), DataType::String);
+
+  EXPECT_EQ(data_type_to_string(DataType::Int), "int");
+  EXPECT_EQ(data_type_to_string(DataType::String), "string");
+
+  EXPECT_EQ(data_type_from_string("long"), DataType::Long);
+  EXPECT_EQ(data_type_from_string("double"), DataType::Double);
+  EXPECT_THROW(data_type_from_string("weird_type"), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,106 @@
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/compact_value.hpp"
+
+namespace opossum {
+
+class CompactValueTest : public BaseTest {};
+
+TEST_F(CompactValueTest, Numbers) {
+  EXPECT_EQ(CompactValue{}.data_type(), DataType::Int);
+  EXPECT_EQ(CompactValue{}.get<int32_t>(), 0);
+
+  EXPECT_EQ(CompactValue{int32_t{-3}}.get<int32_t>(), -3);
+  EXPECT_EQ(CompactValue{int64_t{1} << 40}.get<int64_t>(), int64_t{1} << 40);
+  EXPECT_EQ(CompactValue{1.5f}.get<float>(), 1.5f);
+  EXPECT_EQ(CompactValue{2.5}.get<double>(), 2.5);
+  EXPECT_EQ(CompactValue{2.5}.data_type(), DataType::Double);
+}
+
+TEST_F(CompactValueTest, Strings) {
+  const auto inline_string = std::string{"fourteen chars"};
+  const auto long_string = std::string{"this string is too long to be stored inline"};
+
+  const auto inline_value = CompactValue{inline_string};
+  EXPECT_EQ(inline_value.data_type(), DataType::String);
+  EXPECT_FALSE(inline_value.is_view());
+  EXPECT_EQ(inline_value.get<std::string_view>(), inline_string);
+
+  const auto long_value = CompactValue{long_string};
+  EXPECT_FALSE(long_value.is_view());
+  EXPECT_EQ(long_value.get<std::string_view>(), long_string);
+  EXPECT_NE(long_value.get<std::string_view>().data(), long_string.data());
+
+  const auto view = CompactValue::view(long_string);
+  EXPECT_TRUE(view.is_view());
+  EXPECT_EQ(view.get<std::string_view>().data(), long_string.data());
+
+  EXPECT_EQ(CompactValue{""}.get<std::string_view>(), "");
+}
+
+TEST_F(CompactValueTest, CopyAndMove) {
+  const auto long_string = std::string(100, 'x');
+  auto value = CompactValue{long_string};
+
+  auto copy = value;
+  EXPECT_EQ(copy, value);
+  EXPECT_NE(copy.get<std::string_view>().data(), value.get<std::string_view>().data());
+
+  const auto* data = value.get<std::string_view>().data();
+  auto moved = std::move(value);
+  EXPECT_EQ(moved.get<std::string_view>().data(), data);
+
+  copy = moved;
+  EXPECT_EQ(copy.get<std::string_view>(), long_string);
+  copy = CompactValue{int32_t{5}};
+  EXPECT_EQ(copy, CompactValue{int32_t{5}});
+
+  // Copies of views are views
+  const auto view = CompactValue::view(long_string);
+  const auto view_copy = view;
+  EXPECT_TRUE(view_copy.is_view());
+}
+
+TEST_F(CompactValueTest, ConversionFromAndToVariant) {
+  const auto variants = std::vector<AllTypeVariant>{int32_t{1}, int64_t{2}, 3.0f, 4.0, std::string{"five"},
+                                                    std::string(50, '6')};
+  for (const auto& variant : variants) {
+    const auto value = CompactValue{variant};
+    EXPECT_EQ(static_cast<int>(value.data_type()), variant.which());
+    EXPECT_EQ(value.to_variant(), variant);
+  }
+}
+
+TEST_F(CompactValueTest, Comparison) {
+  EXPECT_EQ(CompactValue{int32_t{1}}, CompactValue{int32_t{1}});
+  EXPECT_NE(CompactValue{int32_t{1}}, CompactValue{int64_t{1}});
+  EXPECT_EQ(CompactValue{"abc"}, CompactValue::view("abc"));
+
+  // Like AllTypeVariant, values are ordered by type first
+  auto values = std::vector<CompactValue>{CompactValue{"b"}, CompactValue{2.0}, CompactValue{"a"},
+                                          CompactValue{int32_t{7}}, CompactValue{int32_t{-1}}};
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values[0], CompactValue{int32_t{-1}});
+  EXPECT_EQ(values[1], CompactValue{int32_t{7}});
+  EXPECT_EQ(values[2], CompactValue{2.0});
+  EXPECT_EQ(values[3], CompactValue{"a"});
+  EXPECT_EQ(values[4], CompactValue{"b"});
+}
+
+TEST_F(CompactValueTest, Print) {
+  std::stringstream stream;
+  stream << CompactValue{int32_t{3}} << " " << CompactValue{"hello"};
+  EXPECT_EQ(stream.str(), "3 hello");
+}
+
+}  // namespace opossum
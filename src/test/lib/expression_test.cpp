@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/expression/expression.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class ExpressionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table.add_column_definition("a", "int");
+    _table.add_column_definition("b", "long");
+    _table.add_column_definition("c", "float");
+    _table.add_column_definition("d", "double");
+    _table.add_column_definition("e", "string");
+  }
+
+  Table _table;
+};
+
+TEST_F(ExpressionTest, Accessors) {
+  const auto column = Expression::column(ColumnID{2});
+  EXPECT_EQ(column->type(), ExpressionType::Column);
+  EXPECT_EQ(column->column_id(), ColumnID{2});
+  EXPECT_FALSE(column->is_arithmetic_operation());
+
+  const auto literal = Expression::literal(42);
+  EXPECT_EQ(literal->type(), ExpressionType::Literal);
+  EXPECT_EQ(literal->value(), AllTypeVariant{42});
+  EXPECT_FALSE(literal->is_arithmetic_operation());
+
+  const auto multiplication = column * literal;
+  EXPECT_EQ(multiplication->type(), ExpressionType::Multiplication);
+  EXPECT_TRUE(multiplication->is_arithmetic_operation());
+  EXPECT_EQ(multiplication->left(), column);
+  EXPECT_EQ(multiplication->right(), literal);
+
+  EXPECT_EQ((column + literal)->type(), ExpressionType::Addition);
+  EXPECT_EQ((column - literal)->type(), ExpressionType::Subtraction);
+  EXPECT_EQ((column / literal)->type(), ExpressionType::Division);
+
+  EXPECT_THROW(Expression::binary(ExpressionType::Literal, column, literal), std::logic_error);
+  EXPECT_THROW(Expression::binary(ExpressionType::Addition, column, nullptr), std::logic_error);
+}
+
+TEST_F(ExpressionTest, DataTypes) {
+  const auto a = Expression::column(ColumnID{0});
+  const auto b = Expression::column(ColumnID{1});
+  const auto c = Expression::column(ColumnID{2});
+  const auto d = Expression::column(ColumnID{3});
+  const auto e = Expression::column(ColumnID{4});
+
+  EXPECT_EQ(a->data_type(_table), DataType::Int);
+  EXPECT_EQ(e->data_type(_table), DataType::String);
+  EXPECT_EQ(Expression::literal(1.5)->data_type(_table), DataType::Double);
+  EXPECT_EQ(Expression::literal("x")->data_type(_table), DataType::String);
+
+  // Operations follow the usual arithmetic conversions of C++
+  EXPECT_EQ((a + a)->data_type(_table), DataType::Int);
+  EXPECT_EQ((a * b)->data_type(_table), DataType::Long);
+  EXPECT_EQ((b - c)->data_type(_table), DataType::Float);
+  EXPECT_EQ((c / d)->data_type(_table), DataType::Double);
+  EXPECT_EQ((a + Expression::literal(int64_t{1}))->data_type(_table), DataType::Long);
+
+  EXPECT_THROW((a + e)->data_type(_table), std::logic_error);
+  EXPECT_THROW((Expression::literal("x") * a)->data_type(_table), std::logic_error);
+}
+
+TEST_F(ExpressionTest, Description) {
+  const auto price = Expression::column(ColumnID{2});
+  const auto discount = Expression::column(ColumnID{3});
+  EXPECT_EQ((price * (Expression::literal(1) - discount))->description(), "(#2 * (1 - #3))");
+  EXPECT_EQ((price / price + price)->description(), "((#2 / #2) + #2)");
+}
+
+}  // namespace opossum
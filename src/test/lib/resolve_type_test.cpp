@@ -0,0 +1,81 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class ResolveTypeTest : public BaseTest {};
+
+TEST_F(ResolveTypeTest, ResolveDataType) {
+  auto resolved_int = false;
+  resolve_data_type(DataType::Int, [&](auto type) {
+    resolved_int = std::is_same<typename decltype(type)::type, int32_t>::value;
+  });
+  EXPECT_TRUE(resolved_int);
+
+  auto resolved_string = false;
+  resolve_data_type(DataType::String, [&](auto type) {
+    resolved_string = std::is_same<typename decltype(type)::type, std::string>::value;
+  });
+  EXPECT_TRUE(resolved_string);
+
+  auto resolved_double = false;
+  resolve_data_type("double", [&](auto type) {
+    resolved_double = std::is_same<typename decltype(type)::type, double>::value;
+  });
+  EXPECT_TRUE(resolved_double);
+}
+
+TEST_F(ResolveTypeTest, MakeSharedByDataType) {
+  const auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(DataType::Long);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int64_t>>(column), nullptr);
+  EXPECT_EQ(column->data_type(), DataType::Long);
+}
+
+TEST_F(ResolveTypeTest, ResolveColumnType) {
+  const auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(DataType::Float);
+  column->append(1.5f);
+  column->append(2.5f);
+
+  auto sum = 0.0f;
+  resolve_column_type(*column, [&](auto type, const auto& typed_column) {
+    using Type = typename decltype(type)::type;
+    EXPECT_TRUE((std::is_same<Type, float>::value));
+    if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+      ADD_FAILURE() << "ValueColumn resolved as DictionaryColumn";
+    } else {
+      for (const auto& value : typed_column.values()) {
+        sum += type_cast<float>(AllTypeVariant{value});
+      }
+    }
+  });
+  EXPECT_EQ(sum, 4.0f);
+}
+
+TEST_F(ResolveTypeTest, ResolveDictionaryColumnType) {
+  const auto column = DictionaryColumn<std::string>{pmr_vector<std::string>{"b", "a", "b"}};
+
+  auto values = std::string{};
+  resolve_column_type(column, [&](auto type, const auto& typed_column) {
+    using Type = typename decltype(type)::type;
+    EXPECT_TRUE((std::is_same<Type, std::string>::value));
+    if constexpr (is_dictionary_column<decltype(typed_column)>::value) {
+      for (const auto& value : typed_column.dictionary()) {
+        values += value;
+      }
+    } else {
+      ADD_FAILURE() << "DictionaryColumn resolved as ValueColumn";
+    }
+  });
+  EXPECT_EQ(values, "ab");
+}
+
+}  // namespace opossum
@@ -0,0 +1,139 @@
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/tpch/tpch_table_generator.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {
+ protected:
+  // all values of a column, in order
+  template <typename T>
+  static std::vector<T> column_values(const Table& table, const std::string& column_name) {
+    const auto column_id = table.column_id_by_name(column_name);
+    auto values = std::vector<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto column = table.get_chunk(chunk_id).get_column(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column->size(); ++chunk_offset) {
+        values.push_back(type_cast<T>((*column)[chunk_offset]));
+      }
+    }
+    return values;
+  }
+};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto generator = TpchTableGenerator{0.01, 1'000};
+  EXPECT_EQ(generator.generate_table(TpchTable::Part)->row_count(), 2'000u);
+  EXPECT_EQ(generator.generate_table(TpchTable::PartSupp)->row_count(), 8'000u);
+  EXPECT_EQ(generator.generate_table(TpchTable::Supplier)->row_count(), 100u);
+  EXPECT_EQ(generator.generate_table(TpchTable::Customer)->row_count(), 1'500u);
+  EXPECT_EQ(generator.generate_table(TpchTable::Orders)->row_count(), 15'000u);
+  EXPECT_EQ(generator.generate_table(TpchTable::Nation)->row_count(), 25u);
+  EXPECT_EQ(generator.generate_table(TpchTable::Region)->row_count(), 5u);
+
+  // Orders have one to seven lineitems, four on average
+  const auto line_item_count = generator.generate_table(TpchTable::LineItem)->row_count();
+  EXPECT_EQ(line_item_count, generator.row_count(TpchTable::LineItem));
+  EXPECT_GT(line_item_count, 15'000u * 3.8);
+  EXPECT_LT(line_item_count, 15'000u * 4.2);
+}
+
+TEST_F(TpchTableGeneratorTest, Chunks) {
+  const auto orders = TpchTableGenerator{0.01, 4'000}.generate_table(TpchTable::Orders);
+  EXPECT_EQ(orders->chunk_size(), 4'000u);
+  ASSERT_EQ(orders->chunk_count(), ChunkID{4});
+  for (auto chunk_id = ChunkID{0}; chunk_id < orders->chunk_count(); ++chunk_id) {
+    const auto& chunk = orders->get_chunk(chunk_id);
+    EXPECT_EQ(chunk.size(), chunk_id < 3 ? 4'000u : 3'000u);
+    EXPECT_EQ(chunk.col_count(), 9u);
+    EXPECT_TRUE(chunk.is_sealed());
+    EXPECT_TRUE(chunk.get_min_max(ColumnID{0}).has_value());
+  }
+
+  // Appending continues in a new chunk
+  orders->append({int64_t{1}, 1, "O", 1.0, "1998-01-01", "5-LOW", "Clerk#000000001", 0, "comment"});
+  EXPECT_EQ(orders->chunk_count(), ChunkID{5});
+
+  const auto nation = TpchTableGenerator{0.01, 0}.generate_table(TpchTable::Nation);
+  EXPECT_EQ(nation->chunk_count(), ChunkID{1});
+}
+
+TEST_F(TpchTableGeneratorTest, Deterministic) {
+  // Neither the number of workers nor the chunk size changes the generated values
+  const auto sequential = TpchTableGenerator{0.005, 1'000, 1}.generate_all_tables();
+  const auto parallel = TpchTableGenerator{0.005, 700, 4}.generate_all_tables();
+  ASSERT_EQ(sequential.size(), 8u);
+  ASSERT_EQ(parallel.size(), 8u);
+  for (const auto& name_and_table : sequential) {
+    SCOPED_TRACE(name_and_table.first);
+    EXPECT_TABLE_EQ(*name_and_table.second, *parallel.at(name_and_table.first), true);
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, ReferentialIntegrity) {
+  const auto generator = TpchTableGenerator{0.01, 1'000};
+  const auto orders = generator.generate_table(TpchTable::Orders);
+  const auto line_items = generator.generate_table(TpchTable::LineItem);
+
+  const auto order_keys = column_values<int64_t>(*orders, "o_orderkey");
+  const auto customer_keys = column_values<int32_t>(*orders, "o_custkey");
+  const auto total_prices = column_values<double>(*orders, "o_totalprice");
+  const auto order_dates = column_values<std::string>(*orders, "o_orderdate");
+  const auto order_key_set = std::set<int64_t>(order_keys.cbegin(), order_keys.cend());
+  EXPECT_EQ(order_key_set.size(), order_keys.size());
+  for (const auto customer_key : customer_keys) {
+    EXPECT_GE(customer_key, 1);
+    EXPECT_LE(customer_key, 1'500);
+    EXPECT_NE(customer_key % 3, 0);
+  }
+
+  // Lineitems are ordered by their order and add up to its total price
+  const auto line_item_order_keys = column_values<int64_t>(*line_items, "l_orderkey");
+  const auto line_numbers = column_values<int32_t>(*line_items, "l_linenumber");
+  const auto part_keys = column_values<int32_t>(*line_items, "l_partkey");
+  const auto extended_prices = column_values<double>(*line_items, "l_extendedprice");
+  const auto discounts = column_values<double>(*line_items, "l_discount");
+  const auto taxes = column_values<double>(*line_items, "l_tax");
+  const auto ship_dates = column_values<std::string>(*line_items, "l_shipdate");
+
+  auto order_index = size_t{0};
+  auto total_price = 0.0;
+  for (auto row = size_t{0}; row < line_item_order_keys.size(); ++row) {
+    if (line_numbers[row] == 1 && row > 0) {
+      EXPECT_NEAR(total_price, total_prices[order_index], 0.01);
+      ++order_index;
+      total_price = 0.0;
+    }
+    ASSERT_EQ(line_item_order_keys[row], order_keys[order_index]);
+    EXPECT_GE(part_keys[row], 1);
+    EXPECT_LE(part_keys[row], 2'000);
+    EXPECT_GT(ship_dates[row], order_dates[order_index]);
+    total_price += extended_prices[row] * (1.0 + taxes[row]) * (1.0 - discounts[row]);
+  }
+  EXPECT_NEAR(total_price, total_prices[order_index], 0.01);
+  EXPECT_EQ(order_index + 1, order_keys.size());
+}
+
+TEST_F(TpchTableGeneratorTest, GenerateAndStore) {
+  TpchTableGenerator{0.001, 1'000}.generate_and_store();
+  auto& storage_manager = StorageManager::get();
+  for (const auto& name : {"part", "partsupp", "supplier", "customer", "orders", "lineitem", "nation", "region"}) {
+    EXPECT_TRUE(storage_manager.has_table(name));
+  }
+  EXPECT_EQ(storage_manager.get_table("customer")->row_count(), 150u);
+  EXPECT_EQ(storage_manager.get_table("nation")->column_name(ColumnID{1}), "n_name");
+
+  EXPECT_THROW(TpchTableGenerator(0.001, 1'000).generate_and_store(), std::logic_error);
+  EXPECT_THROW(TpchTableGenerator(0.0, 1'000), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/abstract_operator.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/hardware_counters.hpp"
+
+namespace opossum {
+
+// Returns its left input unchanged, used to build plans with more than one operator
+class PassThrough : public AbstractOperator {
+ public:
+  PassThrough(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right)
+      : AbstractOperator(left, right) {}
+
+  const std::string name() const override { return "PassThrough"; }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override { return _input_table_left(); }
+};
+
+class OperatorsAbstractOperatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("a", "int");
+    for (auto value = 0; value < 5; ++value) {
+      table->append({value});
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAbstractOperatorTest, PerformanceData) {
+  const auto& wrapper_data = _table_wrapper->performance_data();
+  EXPECT_EQ(wrapper_data.input_row_count, 0u);
+  EXPECT_EQ(wrapper_data.output_row_count, 5u);
+  EXPECT_EQ(wrapper_data.output_chunk_count, 3u);
+
+  auto pass_through = std::make_shared<PassThrough>(_table_wrapper, _table_wrapper);
+  pass_through->execute();
+
+  const auto& data = pass_through->performance_data();
+  EXPECT_EQ(data.input_row_count, 10u);
+  EXPECT_EQ(data.input_chunk_count, 6u);
+  EXPECT_EQ(data.input_bytes, 0u);
+  EXPECT_EQ(data.output_row_count, 5u);
+  EXPECT_EQ(data.output_chunk_count, 3u);
+
+  // Input sizes and hardware counters are not measured unless HardwareCounterProfiling is enabled
+  for (const auto& value : data.hardware_counters.values) {
+    EXPECT_FALSE(value);
+  }
+}
+
+TEST_F(OperatorsAbstractOperatorTest, HardwareCounters) {
+  auto pass_through = std::make_shared<PassThrough>(_table_wrapper, nullptr);
+  {
+    HardwareCounterProfiling hardware_counter_profiling;
+    pass_through->execute();
+  }
+  EXPECT_FALSE(HardwareCounterProfiling::is_enabled());
+  EXPECT_EQ(pass_through->performance_data().input_bytes, _table_wrapper->get_output()->estimate_memory_usage());
+
+  // Whether any event is measured depends on the permissions granted by the kernel
+  if (HardwareCounters{}.available()) {
+    const auto& values = pass_through->performance_data().hardware_counters.values;
+    EXPECT_TRUE(std::any_of(values.cbegin(), values.cend(), [](const auto& value) { return value.has_value(); }));
+  }
+}
+
+TEST_F(OperatorsAbstractOperatorTest, PerformanceReport) {
+  auto pass_through = std::make_shared<PassThrough>(_table_wrapper, nullptr);
+  auto root = std::make_shared<PassThrough>(pass_through, _table_wrapper);
+  pass_through->execute();
+  root->execute();
+
+  std::stringstream report;
+  root->print_performance_report(report);
+
+  auto lines = std::vector<std::string>{};
+  for (std::string line; std::getline(report, line);) {
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_EQ(lines[0].find("PassThrough: "), 0u);
+  EXPECT_NE(lines[0].find("in: 10 rows / 6 chunks"), std::string::npos);
+  EXPECT_EQ(lines[1].find("  PassThrough: "), 0u);
+  EXPECT_EQ(lines[2].find("    TableWrapper: "), 0u);
+  EXPECT_NE(lines[2].find("out: 5 rows / 3 chunks"), std::string::npos);
+  EXPECT_EQ(lines[3].find("  TableWrapper: "), 0u);
+}
+
+}  // namespace opossum
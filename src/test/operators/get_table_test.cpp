@@ -0,0 +1,37 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsGetTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _test_table = std::make_shared<Table>(2);
+    StorageManager::get().add_table("aNiceTestTable", _test_table);
+  }
+
+  std::shared_ptr<Table> _test_table;
+};
+
+TEST_F(OperatorsGetTableTest, GetOutput) {
+  auto gt = std::make_shared<GetTable>("aNiceTestTable");
+  gt->execute();
+
+  EXPECT_EQ(gt->get_output(), _test_table);
+  EXPECT_EQ(gt->table_name(), "aNiceTestTable");
+  EXPECT_EQ(gt->description(), "GetTable (aNiceTestTable)");
+}
+
+TEST_F(OperatorsGetTableTest, ThrowsUnknownTableName) {
+  auto gt = std::make_shared<GetTable>("anUglyTestTable");
+
+  EXPECT_THROW(gt->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,192 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _customers = std::make_shared<Table>(2);
+    _customers->add_column("c_id", "int");
+    _customers->add_column("c_name", "string");
+    _customers->append({1, "Alice"});
+    _customers->append({2, "Bob"});
+    _customers->append({3, "Carol"});
+    _customers->append({4, "Dave"});
+    // The first chunks are dictionary-encoded
+    _customers->merge_delta();
+    _customers->append({5, "Erin"});
+
+    _orders = std::make_shared<Table>(3);
+    _orders->add_column("o_id", "int");
+    _orders->add_column("o_c_id", "int");
+    _orders->add_column("o_status", "string");
+    _orders->append({10, 2, "open"});
+    _orders->append({11, 4, "done"});
+    _orders->append({12, 2, "done"});
+    _orders->append({13, 7, "open"});
+    _orders->append({14, 5, "open"});
+
+    _customers_wrapper = std::make_shared<TableWrapper>(_customers);
+    _customers_wrapper->execute();
+    _orders_wrapper = std::make_shared<TableWrapper>(_orders);
+    _orders_wrapper->execute();
+  }
+
+  static std::shared_ptr<const Table> _join(const std::shared_ptr<const AbstractOperator>& left,
+                                            const std::shared_ptr<const AbstractOperator>& right,
+                                            const std::vector<std::pair<ColumnID, ColumnID>>& column_id_pairs) {
+    auto join = std::make_shared<JoinHash>(left, right, column_id_pairs);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<Table> _customers;
+  std::shared_ptr<Table> _orders;
+  std::shared_ptr<TableWrapper> _customers_wrapper;
+  std::shared_ptr<TableWrapper> _orders_wrapper;
+};
+
+TEST_F(OperatorsJoinHashTest, Join) {
+  auto expected = Table{};
+  expected.add_column("o_id", "int");
+  expected.add_column("o_c_id", "int");
+  expected.add_column("o_status", "string");
+  expected.add_column("c_id", "int");
+  expected.add_column("c_name", "string");
+  expected.append({10, 2, "open", 2, "Bob"});
+  expected.append({11, 4, "done", 4, "Dave"});
+  expected.append({12, 2, "done", 2, "Bob"});
+  expected.append({14, 5, "open", 5, "Erin"});
+
+  const auto output = _join(_orders_wrapper, _customers_wrapper, {{ColumnID{1}, ColumnID{0}}});
+  EXPECT_TABLE_EQ(*output, expected);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{0})->encoding_type(), EncodingType::Reference);
+
+  // The result does not depend on which input the hash table is built on
+  const auto swapped_output = _join(_customers_wrapper, _orders_wrapper, {{ColumnID{0}, ColumnID{1}}});
+  EXPECT_EQ(swapped_output->row_count(), 4u);
+  EXPECT_EQ(swapped_output->column_name(ColumnID{0}), "c_id");
+}
+
+TEST_F(OperatorsJoinHashTest, DuplicatesOnBothSides) {
+  auto left = std::make_shared<Table>();
+  left->add_column("a", "string");
+  for (const auto& value : {"x", "x", "y", "z"}) {
+    left->append({value});
+  }
+  auto right = std::make_shared<Table>();
+  right->add_column("b", "string");
+  for (const auto& value : {"x", "y", "y", "x", "x"}) {
+    right->append({value});
+  }
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  // Every x matches every x, and y matches both ys
+  const auto output = _join(left_wrapper, right_wrapper, {{ColumnID{0}, ColumnID{0}}});
+  EXPECT_EQ(output->row_count(), 2u * 3u + 2u);
+}
+
+TEST_F(OperatorsJoinHashTest, ReferenceInputs) {
+  auto open_orders = std::make_shared<TableScan>(_orders_wrapper, ColumnID{2}, ScanType::OpEquals, "open");
+  open_orders->execute();
+  auto customers_after_bob = std::make_shared<TableScan>(_customers_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  customers_after_bob->execute();
+
+  auto join = std::make_shared<JoinHash>(open_orders, customers_after_bob,
+                                         std::vector<std::pair<ColumnID, ColumnID>>{{ColumnID{1}, ColumnID{0}}});
+  join->execute();
+
+  auto expected = Table{};
+  expected.add_column("o_id", "int");
+  expected.add_column("o_c_id", "int");
+  expected.add_column("o_status", "string");
+  expected.add_column("c_id", "int");
+  expected.add_column("c_name", "string");
+  expected.append({10, 2, "open", 2, "Bob"});
+  expected.append({14, 5, "open", 5, "Erin"});
+  EXPECT_TABLE_EQ(*join->get_output(), expected);
+
+  // Joining the output of a join again refers to the original tables, with one position list per table
+  auto second_join = std::make_shared<JoinHash>(join, _customers_wrapper,
+                                                std::vector<std::pair<ColumnID, ColumnID>>{{ColumnID{3}, ColumnID{0}}});
+  second_join->execute();
+  const auto output = second_join->get_output();
+  EXPECT_EQ(output->row_count(), 2u);
+  EXPECT_EQ(output->col_count(), 7u);
+
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  const auto column = [&](const uint16_t column_id) {
+    return std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{column_id}));
+  };
+  EXPECT_EQ(column(0)->referenced_table(), _orders);
+  EXPECT_EQ(column(3)->referenced_table(), _customers);
+  EXPECT_EQ(column(6)->referenced_table(), _customers);
+  EXPECT_EQ(column(0)->pos_list(), column(2)->pos_list());
+  EXPECT_EQ(column(3)->pos_list(), column(4)->pos_list());
+  EXPECT_NE(column(0)->pos_list(), column(3)->pos_list());
+  EXPECT_NE(column(3)->pos_list(), column(5)->pos_list());
+  EXPECT_EQ((*column(4))[1], (*column(6))[1]);
+}
+
+TEST_F(OperatorsJoinHashTest, MultipleColumnPairs) {
+  // Only the orders of customer 2 in status "open" match both columns
+  auto filter = std::make_shared<Table>();
+  filter->add_column("c_id", "int");
+  filter->add_column("status", "string");
+  filter->append({2, "open"});
+  filter->append({4, "open"});
+  auto filter_wrapper = std::make_shared<TableWrapper>(filter);
+  filter_wrapper->execute();
+
+  const auto output = _join(_orders_wrapper, filter_wrapper, {{ColumnID{1}, ColumnID{0}}, {ColumnID{2}, ColumnID{1}}});
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{0})->compact_value_at(0), CompactValue{10});
+}
+
+TEST_F(OperatorsJoinHashTest, NoMatches) {
+  auto join = std::make_shared<JoinHash>(_orders_wrapper, _customers_wrapper,
+                                         std::vector<std::pair<ColumnID, ColumnID>>{{ColumnID{0}, ColumnID{0}}});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->col_count(), 5u);
+  EXPECT_EQ(join->description(), "JoinHash (left column 0 = right column 0)");
+}
+
+TEST_F(OperatorsJoinHashTest, InvalidColumns) {
+  EXPECT_THROW(_join(_orders_wrapper, _customers_wrapper, {{ColumnID{2}, ColumnID{0}}}), std::exception);
+  EXPECT_THROW(_join(_orders_wrapper, _customers_wrapper, {{ColumnID{5}, ColumnID{0}}}), std::exception);
+  EXPECT_THROW(_join(_orders_wrapper, _customers_wrapper, {}), std::exception);
+}
+
+TEST_F(OperatorsJoinHashTest, ChunksReferencingDifferentTables) {
+  auto mixed = std::make_shared<Table>();
+  mixed->add_column_definition("id", "int");
+  for (const auto& referenced : {std::make_pair(_customers, ColumnID{0}), std::make_pair(_orders, ColumnID{1})}) {
+    auto chunk = Chunk{};
+    chunk.add_column(std::make_shared<ReferenceColumn>(referenced.first, referenced.second,
+                                                       std::make_shared<PosList>(1, RowID{ChunkID{0}, 0})));
+    mixed->emplace_chunk(std::move(chunk));
+  }
+  auto mixed_wrapper = std::make_shared<TableWrapper>(mixed);
+  mixed_wrapper->execute();
+
+  EXPECT_THROW(_join(mixed_wrapper, _customers_wrapper, {{ColumnID{0}, ColumnID{0}}}), std::logic_error);
+}
+
+}  // namespace opossum
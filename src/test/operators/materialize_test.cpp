@@ -0,0 +1,139 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/materialize.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "a string that does not fit into SSO"});
+  }
+
+  // creates a table whose columns reference _table, split into chunks of the given positions
+  std::shared_ptr<Table> _create_reference_table(const std::vector<PosList>& pos_lists) {
+    auto reference_table = std::make_shared<Table>(2);
+    reference_table->add_column_definition("a", "int");
+    reference_table->add_column_definition("b", "string");
+    for (const auto& positions : pos_lists) {
+      const auto pos_list = std::make_shared<const PosList>(positions);
+      auto chunk = Chunk{};
+      chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list));
+      chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{1}, pos_list));
+      reference_table->emplace_chunk(std::move(chunk));
+    }
+    return reference_table;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsMaterializeTest, MaterializesReferences) {
+  const auto reference_table = _create_reference_table(
+      {{{ChunkID{1}, 0}, {ChunkID{0}, 1}}, {{ChunkID{0}, 0}}, {{ChunkID{1}, 0}, {ChunkID{1}, 0}}});
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+  const auto output = materialize->get_output();
+
+  EXPECT_EQ(output->chunk_count(), 3u);
+  EXPECT_EQ(output->column_names(), reference_table->column_names());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    EXPECT_EQ(chunk.size(), reference_table->get_chunk(chunk_id).size());
+    for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+      EXPECT_EQ(chunk.get_column(column_id)->encoding_type(), EncodingType::Unencoded);
+    }
+  }
+
+  const auto string_column = output->get_chunk(ChunkID{0}).get_column(ColumnID{1});
+  const auto& strings = std::dynamic_pointer_cast<ValueColumn<std::string>>(string_column)->values();
+  EXPECT_EQ(strings[0], "a string that does not fit into SSO");
+  EXPECT_EQ(strings[1], "two");
+
+  auto expected = Table{};
+  expected.add_column("a", "int");
+  expected.add_column("b", "string");
+  expected.append({3, "a string that does not fit into SSO"});
+  expected.append({2, "two"});
+  expected.append({1, "one"});
+  expected.append({3, "a string that does not fit into SSO"});
+  expected.append({3, "a string that does not fit into SSO"});
+  EXPECT_TABLE_EQ(*output, expected, true);
+}
+
+TEST_F(OperatorsMaterializeTest, PassesValueColumnsThrough) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+  const auto output = materialize->get_output();
+
+  EXPECT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{1}),
+            _table->get_chunk(ChunkID{0}).get_column(ColumnID{1}));
+  EXPECT_TABLE_EQ(*output, *_table, true);
+}
+
+TEST_F(OperatorsMaterializeTest, CopiesColumnsOfUnsealedChunks) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+  const auto output = materialize->get_output();
+  EXPECT_NE(output->get_chunk(ChunkID{1}).get_column(ColumnID{1}),
+            _table->get_chunk(ChunkID{1}).get_column(ColumnID{1}));
+
+  // The row is appended to the unsealed last chunk of _table, which must not change the output
+  _table->append({4, "four"});
+  EXPECT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).get_column(ColumnID{0})->size(), 1u);
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_create_reference_table({}));
+  table_wrapper->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+  EXPECT_EQ(materialize->get_output()->row_count(), 0u);
+  EXPECT_EQ(materialize->get_output()->col_count(), 2u);
+}
+
+TEST_F(OperatorsMaterializeTest, Gather) {
+  const auto column = Materialize::gather(*_table, ColumnID{0}, {{ChunkID{0}, 1}, {ChunkID{1}, 0}});
+  const auto& values = std::dynamic_pointer_cast<ValueColumn<int32_t>>(column)->values();
+  EXPECT_EQ(values, pmr_vector<int32_t>({2, 3}));
+  EXPECT_EQ(values.capacity(), 2u);
+}
+
+TEST_F(OperatorsMaterializeTest, GatherFromDictionaryColumns) {
+  // The first chunk is dictionary-encoded, the second one is not sealed yet
+  _table->merge_delta();
+  ASSERT_EQ(_table->get_chunk(ChunkID{0}).get_column(ColumnID{1})->encoding_type(), EncodingType::Dictionary);
+
+  const auto column = Materialize::gather(*_table, ColumnID{1}, {{ChunkID{0}, 1}, {ChunkID{1}, 0}, {ChunkID{0}, 0}});
+  const auto& values = std::dynamic_pointer_cast<ValueColumn<std::string>>(column)->values();
+  EXPECT_EQ(values, pmr_vector<std::string>({"two", "a string that does not fit into SSO", "one"}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,157 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "double");
+    _table->add_column("c", "string");
+    _table->append({1, 0.5, "one"});
+    _table->append({2, 1.5, "two"});
+    _table->append({3, 2.5, "three"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> _project(const std::shared_ptr<const AbstractOperator>& in,
+                                        const std::vector<ProjectionDefinition>& definitions) {
+    auto projection = std::make_shared<Projection>(in, definitions);
+    projection->execute();
+    return projection->get_output();
+  }
+
+  const std::shared_ptr<const Expression> _a = Expression::column(ColumnID{0});
+  const std::shared_ptr<const Expression> _b = Expression::column(ColumnID{1});
+  const std::shared_ptr<const Expression> _c = Expression::column(ColumnID{2});
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, ArithmeticOperations) {
+  const auto output = _project(_table_wrapper, {{_a + _a, "sum"},
+                                                {_a - Expression::literal(1), "difference"},
+                                                {Expression::literal(int64_t{10}) * _a, "product"},
+                                                {_b / _a, "quotient"},
+                                                {_a / Expression::literal(2), "integer_quotient"}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("sum", "int");
+  expected->add_column("difference", "int");
+  expected->add_column("product", "long");
+  expected->add_column("quotient", "double");
+  expected->add_column("integer_quotient", "int");
+  expected->append({2, 0, int64_t{10}, 0.5, 0});
+  expected->append({4, 1, int64_t{20}, 0.75, 1});
+  expected->append({6, 2, int64_t{30}, 2.5 / 3, 1});
+
+  EXPECT_TABLE_EQ(output, expected);
+  EXPECT_EQ(output->chunk_count(), _table->chunk_count());
+}
+
+TEST_F(OperatorsProjectionTest, NestedExpressions) {
+  const auto output = _project(_table_wrapper, {{_b * (Expression::literal(1) - _b / Expression::literal(10)), "x"}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("x", "double");
+  expected->append({0.5 * 0.95});
+  expected->append({1.5 * 0.85});
+  expected->append({2.5 * 0.75});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsProjectionTest, ColumnsArePassedThrough) {
+  const auto output = _project(_table_wrapper, {{_c, "c"}, {_a, "a"}, {Expression::literal(7), "seven"}});
+
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"c", "a", "seven"}));
+  const auto& input_chunk = _table->get_chunk(ChunkID{0});
+  const auto& output_chunk = output->get_chunk(ChunkID{0});
+  EXPECT_EQ(output_chunk.get_column(ColumnID{0}), input_chunk.get_column(ColumnID{2}));
+  EXPECT_EQ(output_chunk.get_column(ColumnID{1}), input_chunk.get_column(ColumnID{0}));
+
+  const auto sevens = std::dynamic_pointer_cast<ValueColumn<int32_t>>(output_chunk.get_column(ColumnID{2}));
+  ASSERT_TRUE(sevens);
+  EXPECT_EQ(sevens->values(), (pmr_vector<int32_t>{7, 7}));
+}
+
+TEST_F(OperatorsProjectionTest, ColumnsOfUnsealedChunksAreCopied) {
+  const auto output = _project(_table_wrapper, {{_c, "c"}, {_a, "a"}});
+  EXPECT_NE(output->get_chunk(ChunkID{1}).get_column(ColumnID{1}),
+            _table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+
+  // The row is appended to the unsealed last chunk of _table, which must not change the output
+  _table->append({4, 3.5, "four"});
+  EXPECT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).get_column(ColumnID{0})->size(), 1u);
+}
+
+TEST_F(OperatorsProjectionTest, ReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan->execute();
+
+  const auto output = _project(scan, {{_a * _b, "product"}, {_c, "c"}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("product", "double");
+  expected->add_column("c", "string");
+  expected->append({3.0, "two"});
+  expected->append({7.5, "three"});
+  EXPECT_TABLE_EQ(output, expected);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(std::dynamic_pointer_cast<ReferenceColumn>(output->get_chunk(chunk_id).get_column(ColumnID{1})));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, DictionaryColumns) {
+  _table->merge_delta();
+  const auto& input_chunk = _table->get_chunk(ChunkID{0});
+  ASSERT_EQ(input_chunk.get_column(ColumnID{0})->encoding_type(), EncodingType::Dictionary);
+
+  const auto output = _project(_table_wrapper, {{_a * _b, "product"}, {_c, "c"}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("product", "double");
+  expected->add_column("c", "string");
+  expected->append({0.5, "one"});
+  expected->append({3.0, "two"});
+  expected->append({7.5, "three"});
+  EXPECT_TABLE_EQ(output, expected, true);
+
+  // Operands are decoded, while projected columns are passed through
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{1}), input_chunk.get_column(ColumnID{2}));
+}
+
+TEST_F(OperatorsProjectionTest, InvalidExpressions) {
+  EXPECT_THROW(_project(_table_wrapper, {{_a + _c, "x"}}), std::logic_error);
+  EXPECT_THROW(_project(_table_wrapper, {{_a / (_a - _a), "x"}}), std::logic_error);
+  EXPECT_THROW(_project(_table_wrapper, {{_a / Expression::literal(0), "x"}}), std::logic_error);
+
+  // Floating point division by zero follows IEEE 754
+  EXPECT_NO_THROW(_project(_table_wrapper, {{_b / Expression::literal(0.0), "x"}}));
+}
+
+TEST_F(OperatorsProjectionTest, Description) {
+  auto projection = std::make_shared<Projection>(_table_wrapper,
+                                                 std::vector<ProjectionDefinition>{{_a * _b, "x"}, {_c, "c"}});
+  EXPECT_EQ(projection->description(), "Projection ((#0 * #1) AS x, #2 AS c)");
+}
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/materialize.hpp"
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/result_cache.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = _create_table({{"a", "int"}, {"b", "string"}}, 3);
+    for (auto index = 0; index < 10; ++index) {
+      _append({index % 4, "value " + std::to_string(index)});
+    }
+    ResultCache::get().set_memory_budget(1'000'000);
+  }
+
+  void TearDown() override {
+    ResultCache::get().set_memory_budget(0);
+    ResultCache::get().clear();
+  }
+
+  void _append(const std::vector<AllTypeVariant>& row) {
+    _table->append(row);
+    _rows.push_back(row);
+  }
+
+  std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<Table>& table) const {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // scans a fresh wrapper of _table, as a dashboard issuing the same query again would
+  std::shared_ptr<TableScan> _scan(const AllTypeVariant& search_value,
+                                   const ScanType scan_type = ScanType::OpLessThanEquals) const {
+    auto scan = std::make_shared<TableScan>(_wrap(_table), ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan;
+  }
+
+  // returns the output of the scan on a new table holding the rows of _table, for which no output is cached
+  std::shared_ptr<const Table> _expected_scan(const AllTypeVariant& search_value) const {
+    const auto table = _create_table({{"a", "int"}, {"b", "string"}}, 3);
+    for (const auto& row : _rows) {
+      table->append(row);
+    }
+    auto scan = std::make_shared<TableScan>(_wrap(table), ColumnID{0}, ScanType::OpLessThanEquals, search_value);
+    scan->execute();
+    auto materialize = std::make_shared<Materialize>(scan);
+    materialize->execute();
+    return materialize->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::vector<std::vector<AllTypeVariant>> _rows;
+};
+
+TEST_F(OperatorsResultCacheTest, DisabledByDefault) {
+  ResultCache::get().set_memory_budget(0);
+  EXPECT_NE(_scan(1)->get_output(), _scan(1)->get_output());
+  EXPECT_EQ(ResultCache::get().entry_count(), 0u);
+  EXPECT_EQ(ResultCache::get().cached_bytes(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, ReusesOutput) {
+  const auto hits_before = _counter_value("result cache hit");
+  const auto scan = _scan(1);
+  EXPECT_EQ(ResultCache::get().entry_count(), 1u);
+  EXPECT_GT(ResultCache::get().cached_bytes(), 0u);
+
+  // As the scans return the same table, operators consuming them hit the cache, too
+  const auto second_scan = _scan(1);
+  EXPECT_EQ(second_scan->get_output(), scan->get_output());
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+  auto second_materialize = std::make_shared<Materialize>(second_scan);
+  second_materialize->execute();
+  EXPECT_EQ(second_materialize->get_output(), materialize->get_output());
+  EXPECT_EQ(_counter_value("result cache hit") - hits_before, 2u);
+
+  // Operators with other parameters or search values of another type are cached separately
+  EXPECT_NE(_scan(2)->get_output(), scan->get_output());
+  EXPECT_NE(_scan("1")->get_output(), scan->get_output());
+  auto top_k = std::make_shared<TopK>(_wrap(_table), ColumnID{0}, OrderByMode::Ascending, 3);
+  top_k->execute();
+  EXPECT_EQ(ResultCache::get().entry_count(), 5u);
+  EXPECT_EQ(_counter_value("result cache hit") - hits_before, 2u);
+  EXPECT_TABLE_EQ(scan->get_output(), _expected_scan(1));
+}
+
+TEST_F(OperatorsResultCacheTest, ProjectionLiteralTypes) {
+  const auto project = [&](const AllTypeVariant& literal) {
+    const auto expression = Expression::column(ColumnID{0}) * Expression::literal(literal);
+    auto projection = std::make_shared<Projection>(_wrap(_table), std::vector<ProjectionDefinition>{{expression, "x"}});
+    projection->execute();
+    return projection->get_output();
+  };
+
+  const auto int_output = project(2);
+  const auto float_output = project(0.1f);
+  const auto double_output = project(0.1);
+  EXPECT_EQ(project(2), int_output);
+  EXPECT_NE(float_output, double_output);
+  EXPECT_EQ(int_output->column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(float_output->column_data_type(ColumnID{0}), DataType::Float);
+  EXPECT_EQ(double_output->column_data_type(ColumnID{0}), DataType::Double);
+}
+
+TEST_F(OperatorsResultCacheTest, RecomputesChangedChunks) {
+  // The first three chunks are sealed, the fourth holds a single row
+  const auto scan = _scan(1);
+  const auto partial_hits_before = _counter_value("result cache partial hit");
+
+  // Only the rows of chunks that were not sealed are scanned, the output of the others is shared
+  _append({0, "value 10"});
+  _append({3, "value 11"});
+  _append({1, "value 12"});
+  const auto second_scan = _scan(1);
+  EXPECT_NE(second_scan->get_output(), scan->get_output());
+  EXPECT_EQ(_counter_value("result cache partial hit") - partial_hits_before, 1u);
+  EXPECT_TABLE_EQ(second_scan->get_output(), _expected_scan(1), true);
+  EXPECT_EQ(second_scan->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}),
+            scan->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+
+  _append({1, "value 13"});
+  const auto third_scan = _scan(1);
+  EXPECT_EQ(_counter_value("result cache partial hit") - partial_hits_before, 2u);
+  EXPECT_TABLE_EQ(third_scan->get_output(), _expected_scan(1), true);
+  EXPECT_EQ(_scan(1)->get_output(), third_scan->get_output());
+
+  // Operators that do not work chunk by chunk are executed again
+  const auto top_k = [&]() {
+    auto top_k = std::make_shared<TopK>(_wrap(_table), ColumnID{1}, OrderByMode::Descending, 2);
+    top_k->execute();
+    auto materialize = std::make_shared<Materialize>(top_k);
+    materialize->execute();
+    return materialize->get_output();
+  };
+  top_k();
+  _append({1, "value 99"});
+  EXPECT_EQ(type_cast<std::string>((*top_k()->get_chunk(ChunkID{0}).get_column(ColumnID{1}))[0]), "value 99");
+  EXPECT_EQ(_counter_value("result cache partial hit") - partial_hits_before, 2u);
+}
+
+TEST_F(OperatorsResultCacheTest, EvictsLeastRecentlyUsed) {
+  // Each of the scans finds one row in each of three chunks, so that their outputs have the same size
+  const auto scan = _scan(0, ScanType::OpEquals);
+  const auto bytes = ResultCache::get().cached_bytes();
+  const auto evictions_before = _counter_value("result cache entry evicted");
+
+  // Only two outputs fit into the budget, the one used less recently is evicted
+  ResultCache::get().set_memory_budget(bytes * 5 / 2);
+  const auto second_scan = _scan(1, ScanType::OpEquals);
+  EXPECT_EQ(_scan(0, ScanType::OpEquals)->get_output(), scan->get_output());
+  _scan("0", ScanType::OpEquals);
+  EXPECT_EQ(ResultCache::get().entry_count(), 2u);
+  EXPECT_LE(ResultCache::get().cached_bytes(), ResultCache::get().memory_budget());
+  EXPECT_EQ(_counter_value("result cache entry evicted") - evictions_before, 1u);
+  EXPECT_EQ(_scan(0, ScanType::OpEquals)->get_output(), scan->get_output());
+  EXPECT_NE(_scan(1, ScanType::OpEquals)->get_output(), second_scan->get_output());
+
+  ResultCache::get().set_memory_budget(1);
+  EXPECT_EQ(ResultCache::get().entry_count(), 0u);
+  EXPECT_EQ(ResultCache::get().cached_bytes(), 0u);
+}
+
+}  // namespace opossum
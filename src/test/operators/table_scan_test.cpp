@@ -0,0 +1,285 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({12345, "a"});
+    _table->append({123, "b"});
+    _table->append({1234, "c"});
+    _table->append({12345, "d"});
+    _table->append({123, "e"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _create_expected(const std::vector<std::pair<int, std::string>>& rows) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    for (const auto& row : rows) {
+      expected->append({row.first, row.second});
+    }
+    return expected;
+  }
+
+  // returns the number of chunks that TableScans skipped because of Bloom filters
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTableScanTest, ScanTypes) {
+  const auto expected_by_scan_type = std::vector<std::pair<ScanType, std::shared_ptr<Table>>>{
+      {ScanType::OpEquals, _create_expected({{123, "b"}, {123, "e"}})},
+      {ScanType::OpNotEquals, _create_expected({{12345, "a"}, {1234, "c"}, {12345, "d"}})},
+      {ScanType::OpLessThan, _create_expected({})},
+      {ScanType::OpLessThanEquals, _create_expected({{123, "b"}, {123, "e"}})},
+      {ScanType::OpGreaterThan, _create_expected({{12345, "a"}, {1234, "c"}, {12345, "d"}})},
+      {ScanType::OpGreaterThanEquals, _create_expected({{12345, "a"}, {123, "b"}, {1234, "c"}, {12345, "d"},
+                                                        {123, "e"}})}};
+
+  for (const auto& scan_type_and_expected : expected_by_scan_type) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, scan_type_and_expected.first, 123);
+    scan->execute();
+    EXPECT_TABLE_EQ(scan->get_output(), scan_type_and_expected.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, "b");
+  scan->execute();
+  const auto output = scan->get_output();
+
+  EXPECT_EQ(output->chunk_count(), 2u);
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}));
+  ASSERT_TRUE(column_a && column_b);
+  EXPECT_EQ(column_a->referenced_table(), _table);
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+  EXPECT_EQ(*column_a->pos_list(), (PosList{{ChunkID{1}, 0}, {ChunkID{1}, 1}}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanReferences) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 1234);
+  first_scan->execute();
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, "e");
+  second_scan->execute();
+
+  EXPECT_TABLE_EQ(second_scan->get_output(), _create_expected({{12345, "a"}, {123, "b"}, {12345, "d"}}));
+  const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      second_scan->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  EXPECT_EQ(column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsTableScanTest, SkipsChunksUsingBloomFilters) {
+  // The last chunk is not full yet and thus has no Bloom filter
+  _table->enable_bloom_filter(ColumnID{1}, 0.001);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}).get_bloom_filter(ColumnID{1}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}).get_bloom_filter(ColumnID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2}).get_bloom_filter(ColumnID{1}));
+
+  const auto skipped_before = _counter_value("chunk skipped by Bloom filter");
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, "c");
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_expected({{1234, "c"}}));
+  EXPECT_EQ(_counter_value("chunk skipped by Bloom filter") - skipped_before, 1u);
+
+  // Bloom filters are only consulted for equality predicates
+  auto range_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThanEquals, "c");
+  range_scan->execute();
+  EXPECT_EQ(range_scan->get_output()->row_count(), 3u);
+  EXPECT_EQ(_counter_value("chunk skipped by Bloom filter") - skipped_before, 1u);
+}
+
+TEST_F(OperatorsTableScanTest, LooksUpHashIndex) {
+  _table->enable_hash_index(ColumnID{0});
+  const auto lookups_before = _counter_value("scan answered by hash index");
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 12345);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_expected({{12345, "a"}, {12345, "d"}}), true);
+  EXPECT_EQ(_counter_value("scan answered by hash index") - lookups_before, 1u);
+
+  auto missing_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 4);
+  missing_scan->execute();
+  EXPECT_EQ(missing_scan->get_output()->row_count(), 0u);
+
+  // Other predicates and scans of the output, which has no index, scan the values
+  auto range_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 12345);
+  range_scan->execute();
+  auto second_scan = std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpEquals, "d");
+  second_scan->execute();
+  EXPECT_TABLE_EQ(range_scan->get_output(), _create_expected({{123, "b"}, {1234, "c"}, {123, "e"}}), true);
+  EXPECT_TABLE_EQ(second_scan->get_output(), _create_expected({{12345, "d"}}));
+  EXPECT_EQ(_counter_value("scan answered by hash index") - lookups_before, 2u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanLike) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  const auto values = std::vector<std::string>{"GET /index.html", "GET /login",     "POST /login", "GET /logo.png",
+                                               "POST /upload",    "GET /index.html", "GET /logout", "GET /index.html",
+                                               "POST /login",     "GET /help"};
+  const auto append_rows = [&](const int begin, const int end) {
+    for (auto index = begin; index < end; ++index) {
+      table->append({index, values[index]});
+    }
+  };
+
+  // The first two chunks are dictionary-encoded, the third one consists of ValueColumns, and the last one is not sealed
+  table->enable_trigram_index(ColumnID{1});
+  append_rows(0, 7);
+  table->merge_delta();
+  append_rows(7, 10);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}).get_trigram_index(ColumnID{1}));
+  EXPECT_TRUE(table->get_chunk(ChunkID{2}).get_trigram_index(ColumnID{1}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{3}).get_trigram_index(ColumnID{1}));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto skipped_before = _counter_value("chunk skipped by trigram index");
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLike, "%login%");
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_expected({{1, "GET /login"}, {2, "POST /login"}, {8, "POST /login"}}));
+  EXPECT_EQ(_counter_value("chunk skipped by trigram index") - skipped_before, 1u);
+
+  auto infix_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLike, "GET /%o%");
+  infix_scan->execute();
+  EXPECT_TABLE_EQ(infix_scan->get_output(),
+                  _create_expected({{1, "GET /login"}, {3, "GET /logo.png"}, {6, "GET /logout"}}));
+
+  // Scans of ReferenceColumns check every referenced value
+  auto prefix_scan = std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpLike, "POST%");
+  prefix_scan->execute();
+  EXPECT_TABLE_EQ(prefix_scan->get_output(), _create_expected({{2, "POST /login"}, {8, "POST /login"}}));
+
+  auto int_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, "1%");
+  EXPECT_THROW(int_scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScanLikeDictionaryColumns) {
+  // The first two chunks are dictionary-encoded, the last one is not sealed yet
+  _table->merge_delta();
+  const auto skipped_before = _counter_value("chunk skipped by dictionary");
+  const auto matched_before = _counter_value("all rows of dictionary column match");
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLike, "c%");
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_expected({{1234, "c"}}));
+  EXPECT_EQ(_counter_value("chunk skipped by dictionary") - skipped_before, 1u);
+
+  auto match_all_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLike, "%");
+  match_all_scan->execute();
+  EXPECT_EQ(match_all_scan->get_output()->row_count(), _table->row_count());
+  EXPECT_EQ(_counter_value("all rows of dictionary column match") - matched_before, 2u);
+
+  auto wildcard_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLike, "_");
+  wildcard_scan->execute();
+  EXPECT_EQ(wildcard_scan->get_output()->row_count(), _table->row_count());
+}
+
+TEST_F(OperatorsTableScanTest, ScanDictionaryColumns) {
+  // The first two chunks are dictionary-encoded, the last one is not sealed yet
+  auto merged_table = std::make_shared<Table>(2);
+  merged_table->add_column("a", "int");
+  merged_table->add_column("b", "string");
+  for (const auto& row : std::vector<std::pair<int, std::string>>{
+           {12345, "a"}, {123, "b"}, {1234, "c"}, {12345, "d"}, {123, "e"}}) {
+    merged_table->append({row.first, row.second});
+  }
+  merged_table->merge_delta();
+  ASSERT_EQ(merged_table->get_chunk(ChunkID{1}).get_column(ColumnID{0})->encoding_type(), EncodingType::Dictionary);
+  auto merged_table_wrapper = std::make_shared<TableWrapper>(merged_table);
+  merged_table_wrapper->execute();
+
+  // Search values are below, between, equal to, and above the values in the dictionaries
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {0, 123, 124, 1234, 12345, 20000}) {
+      auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      auto merged_scan = std::make_shared<TableScan>(merged_table_wrapper, ColumnID{0}, scan_type, search_value);
+      merged_scan->execute();
+      SCOPED_TRACE(merged_scan->description());
+      EXPECT_TABLE_EQ(merged_scan->get_output(), scan->get_output(), true);
+
+      // Scanning the output reads the values through the ReferenceColumns
+      auto reference_scan = std::make_shared<TableScan>(merged_scan, ColumnID{1}, ScanType::OpGreaterThan, "b");
+      reference_scan->execute();
+      auto expected_scan = std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpGreaterThan, "b");
+      expected_scan->execute();
+      EXPECT_TABLE_EQ(reference_scan->get_output(), expected_scan->get_output(), true);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanSortedChunks) {
+  auto sorted_table = std::make_shared<Table>(4);
+  sorted_table->add_column("a", "int");
+  sorted_table->add_column("b", "string");
+  sorted_table->enable_clustering({ColumnID{0}});
+  for (auto index = 0; index < 30; ++index) {
+    sorted_table->append({(index * 7) % 10, std::to_string(index)});
+  }
+  auto sorted_table_wrapper = std::make_shared<TableWrapper>(sorted_table);
+  sorted_table_wrapper->execute();
+
+  // The same rows, in the order of appending
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto index = 0; index < 30; ++index) {
+    table->append({(index * 7) % 10, std::to_string(index)});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The sealed chunks are searched as ValueColumns and, after merging, as DictionaryColumns
+  for (const auto merge : {false, true}) {
+    if (merge) sorted_table->merge_delta();
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                 ScanType::OpGreaterThanEquals}) {
+      for (const auto search_value : {-1, 0, 4, 9, 10}) {
+        const auto binary_searches_before = _counter_value("sorted chunk scanned by binary search");
+        auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+        scan->execute();
+        auto sorted_scan = std::make_shared<TableScan>(sorted_table_wrapper, ColumnID{0}, scan_type, search_value);
+        sorted_scan->execute();
+        SCOPED_TRACE(sorted_scan->description());
+        EXPECT_TABLE_EQ(sorted_scan->get_output(), scan->get_output());
+        if (!merge) {
+          EXPECT_EQ(_counter_value("sorted chunk scanned by binary search") - binary_searches_before, 7u);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, Description) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThanEquals, "c");
+  EXPECT_EQ(scan->description(), "TableScan (column 1 <= c)");
+  EXPECT_EQ(scan->scan_type(), ScanType::OpLessThanEquals);
+  EXPECT_EQ(scan->search_value(), AllTypeVariant{"c"});
+
+  auto like_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLike, "%c_");
+  EXPECT_EQ(like_scan->description(), "TableScan (column 1 LIKE %c_)");
+}
+
+}  // namespace opossum
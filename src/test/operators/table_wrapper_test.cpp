@@ -0,0 +1,26 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableWrapperTest : public BaseTest {};
+
+TEST_F(OperatorsTableWrapperTest, GetOutput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  table->append({1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  EXPECT_EQ(table_wrapper->get_output(), nullptr);
+
+  table_wrapper->execute();
+  EXPECT_EQ(table_wrapper->get_output(), table);
+  EXPECT_EQ(table_wrapper->name(), "TableWrapper");
+}
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({3, "c"});
+    _table->append({1, "a"});
+    _table->append({4, "d"});
+    _table->append({1, "a2"});
+    _table->append({5, "e"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> _top_k(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                      const OrderByMode order_by_mode, const size_t k) {
+    auto top_k = std::make_shared<TopK>(in, column_id, order_by_mode, k);
+    top_k->execute();
+    return top_k->get_output();
+  }
+
+  std::shared_ptr<Table> _create_expected(const std::vector<std::pair<int, std::string>>& rows) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    for (const auto& row : rows) {
+      expected->append({row.first, row.second});
+    }
+    return expected;
+  }
+
+  // creates a table with a single int column holding values, split into sealed chunks of chunk_size
+  static std::shared_ptr<Table> _create_int_table(const std::vector<int32_t>& values, const size_t chunk_size) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column_definition("a", "int");
+    for (auto begin = size_t{0}; begin < values.size(); begin += chunk_size) {
+      const auto end = std::min(begin + chunk_size, values.size());
+      auto chunk = Chunk{};
+      chunk.add_column(std::make_shared<ValueColumn<int32_t>>(
+          pmr_vector<int32_t>(values.begin() + begin, values.begin() + end)));
+      table->emplace_chunk(std::move(chunk));
+    }
+    table->seal_last_chunk();
+    return table;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, Ascending) {
+  // Equal values are ordered by their position
+  const auto output = _top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 3);
+  EXPECT_TABLE_EQ(output, _create_expected({{1, "a"}, {1, "a2"}, {3, "c"}}), true);
+  EXPECT_EQ(output->chunk_count(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceColumn>(output->get_chunk(ChunkID{0}).get_column(ColumnID{1})));
+}
+
+TEST_F(OperatorsTopKTest, Descending) {
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 2),
+                  _create_expected({{5, "e"}, {4, "d"}}), true);
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{1}, OrderByMode::Descending, 3),
+                  _create_expected({{5, "e"}, {4, "d"}, {3, "c"}}), true);
+}
+
+TEST_F(OperatorsTopKTest, KExceedsRowCount) {
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{1}, OrderByMode::Ascending, 10),
+                  _create_expected({{1, "a"}, {1, "a2"}, {3, "c"}, {4, "d"}, {5, "e"}}), true);
+  EXPECT_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 0)->row_count(), 0u);
+
+  // No memory is reserved for k candidates if the input has fewer rows
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Descending, size_t{1} << 40),
+                  _create_expected({{5, "e"}, {4, "d"}, {3, "c"}, {1, "a"}, {1, "a2"}}), true);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+
+  const auto output = _top_k(scan, ColumnID{0}, OrderByMode::Ascending, 2);
+  EXPECT_TABLE_EQ(output, _create_expected({{3, "c"}, {4, "d"}}), true);
+
+  const auto column =
+      std::dynamic_pointer_cast<ReferenceColumn>(output->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_TRUE(column);
+  EXPECT_EQ(column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksUsingMinMax) {
+  // Values ascend with the chunks, so after the first chunk, no other chunk can contribute
+  auto values = std::vector<int32_t>(1'000);
+  std::iota(values.begin(), values.end(), 0);
+  auto table_wrapper = std::make_shared<TableWrapper>(_create_int_table(values, 100));
+  table_wrapper->execute();
+
+  const auto skipped_before = _counter_value("chunk skipped by TopK");
+  const auto output = _top_k(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 10);
+  EXPECT_EQ(_counter_value("chunk skipped by TopK") - skipped_before, 9u);
+
+  ASSERT_EQ(output->row_count(), 10u);
+  const auto& column = *output->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  for (auto index = ChunkOffset{0}; index < 10; ++index) {
+    EXPECT_EQ(column[index], AllTypeVariant{static_cast<int32_t>(index)});
+  }
+}
+
+TEST_F(OperatorsTopKTest, LargeInput) {
+  // Large enough to be split among several threads, if available
+  auto values = std::vector<int32_t>(400'000);
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, 10'000};
+  std::generate(values.begin(), values.end(), [&]() { return distribution(random_engine); });
+  auto table_wrapper = std::make_shared<TableWrapper>(_create_int_table(values, 10'000));
+  table_wrapper->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    const auto output = _top_k(table_wrapper, ColumnID{0}, order_by_mode, 100);
+
+    auto expected_values = values;
+    if (order_by_mode == OrderByMode::Ascending) {
+      std::sort(expected_values.begin(), expected_values.end());
+    } else {
+      std::sort(expected_values.begin(), expected_values.end(), std::greater<>{});
+    }
+
+    ASSERT_EQ(output->row_count(), 100u);
+    const auto& column = *output->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+    for (auto index = ChunkOffset{0}; index < 100; ++index) {
+      EXPECT_EQ(column[index], AllTypeVariant{expected_values[index]});
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, DictionaryColumns) {
+  // The first two chunks are dictionary-encoded, the last one is not sealed yet
+  _table->merge_delta();
+  ASSERT_EQ(_table->main_chunk_count(), ChunkID{2});
+
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 3),
+                  _create_expected({{1, "a"}, {1, "a2"}, {3, "c"}}), true);
+  EXPECT_TABLE_EQ(_top_k(_table_wrapper, ColumnID{1}, OrderByMode::Descending, 3),
+                  _create_expected({{5, "e"}, {4, "d"}, {3, "c"}}), true);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  EXPECT_TABLE_EQ(_top_k(scan, ColumnID{1}, OrderByMode::Ascending, 2), _create_expected({{3, "c"}, {4, "d"}}),
+                  true);
+}
+
+TEST_F(OperatorsTopKTest, Description) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, ColumnID{1}, OrderByMode::Descending, 10);
+  EXPECT_EQ(top_k->description(), "TopK (column 1 descending, k = 10)");
+}
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/optimizer/join_order_optimizer.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OptimizerJoinOrderOptimizerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // A fact table referencing two dimension tables
+    _facts = std::make_shared<Table>(100);
+    _facts->add_column("f_id", "int");
+    _facts->add_column("f_small_id", "int");
+    _facts->add_column("f_large_id", "int");
+    for (auto index = 0; index < 1'000; ++index) {
+      _facts->append({index, index % 10, index % 100});
+    }
+
+    _small = std::make_shared<Table>(100);
+    _small->add_column("s_id", "int");
+    _small->add_column("s_name", "string");
+    for (auto index = 0; index < 10; ++index) {
+      _small->append({index, "small " + std::to_string(index)});
+    }
+
+    _large = std::make_shared<Table>(100);
+    _large->add_column("l_id", "int");
+    _large->add_column("l_value", "int");
+    for (auto index = 0; index < 100; ++index) {
+      _large->append({index, index * 10});
+    }
+
+    for (const auto& table : {_facts, _small, _large}) {
+      table->enable_statistics();
+    }
+  }
+
+  // The facts are joined with both dimensions, where only a single row of the large dimension qualifies
+  JoinGraph _star_join_graph() const {
+    auto join_graph = JoinGraph{};
+    join_graph.vertices.push_back(JoinVertex{_facts, {}});
+    join_graph.vertices.push_back(JoinVertex{_small, {}});
+    join_graph.vertices.push_back(JoinVertex{
+        _large, {ScanPredicate{ColumnID{1}, ScanType::OpEquals, 420}, {ColumnID{0}, ScanType::OpLessThan, 90}}});
+    join_graph.edges.push_back(JoinEdge{0, ColumnID{1}, 1, ColumnID{0}});
+    join_graph.edges.push_back(JoinEdge{0, ColumnID{2}, 2, ColumnID{0}});
+    return join_graph;
+  }
+
+  // returns the row counts of the joins of the plan in the order in which they are executed
+  static std::vector<uint64_t> _join_row_counts(const JoinPlan& plan) {
+    auto row_counts = std::vector<uint64_t>{};
+    for (const auto& op : plan.operators) {
+      if (std::dynamic_pointer_cast<const JoinHash>(op)) row_counts.push_back(op->get_output()->row_count());
+    }
+    return row_counts;
+  }
+
+  std::shared_ptr<Table> _facts;
+  std::shared_ptr<Table> _small;
+  std::shared_ptr<Table> _large;
+};
+
+TEST_F(OptimizerJoinOrderOptimizerTest, StarJoin) {
+  // Dynamic programming and greedy operator ordering find the same plan
+  for (const auto max_dynamic_programming_vertex_count : {size_t{3}, size_t{0}}) {
+    const auto plan = JoinOrderOptimizer{max_dynamic_programming_vertex_count}.optimize(_star_join_graph());
+    const auto output = plan.execute();
+
+    // The facts are joined with the filtered large dimension first, which keeps the intermediate result small
+    ASSERT_EQ(output->row_count(), 10u);
+    EXPECT_EQ(_join_row_counts(plan), (std::vector<uint64_t>{10, 10}));
+    EXPECT_NEAR(plan.estimated_row_count, 10.0, 2.0);
+    EXPECT_GT(plan.estimated_cost, 0.0);
+
+    // The columns of every vertex can be found in the output
+    ASSERT_EQ(plan.first_column_ids.size(), 3u);
+    const auto& chunk = output->get_chunk(ChunkID{0});
+    for (auto offset = ChunkOffset{0}; offset < output->row_count(); ++offset) {
+      const auto facts_column_id = plan.first_column_ids[0];
+      const auto fact_small_id = chunk.get_column(static_cast<ColumnID>(facts_column_id + 1))->compact_value_at(offset);
+      const auto fact_large_id = chunk.get_column(static_cast<ColumnID>(facts_column_id + 2))->compact_value_at(offset);
+      EXPECT_EQ(fact_large_id, CompactValue{42});
+      EXPECT_EQ(chunk.get_column(plan.first_column_ids[2])->compact_value_at(offset), CompactValue{42});
+      EXPECT_EQ(chunk.get_column(plan.first_column_ids[1])->compact_value_at(offset), fact_small_id);
+    }
+  }
+}
+
+TEST_F(OptimizerJoinOrderOptimizerTest, PredicateOrder) {
+  const auto plan = JoinOrderOptimizer{}.optimize(_star_join_graph());
+
+  // The equality is the most selective predicate on the large dimension
+  auto scans = std::vector<std::shared_ptr<const TableScan>>{};
+  for (const auto& op : plan.operators) {
+    if (const auto scan = std::dynamic_pointer_cast<const TableScan>(op)) scans.push_back(scan);
+  }
+  ASSERT_EQ(scans.size(), 2u);
+  EXPECT_EQ(scans[0]->scan_type(), ScanType::OpEquals);
+  EXPECT_EQ(scans[1]->scan_type(), ScanType::OpLessThan);
+  EXPECT_EQ(scans[1]->input_left(), scans[0]);
+
+  // A HashIndex makes a less selective equality cheaper than scanning the table for the more selective one
+  _facts->enable_hash_index(ColumnID{1});
+  auto join_graph = JoinGraph{};
+  join_graph.vertices.push_back(JoinVertex{
+      _facts, {ScanPredicate{ColumnID{0}, ScanType::OpLessThan, 10}, {ColumnID{1}, ScanType::OpEquals, 3}}});
+  const auto indexed_plan = JoinOrderOptimizer{}.optimize(join_graph);
+  ASSERT_EQ(indexed_plan.operators.size(), 3u);
+  EXPECT_EQ(std::static_pointer_cast<const TableScan>(indexed_plan.operators[1])->column_id(), ColumnID{1});
+  EXPECT_EQ(indexed_plan.execute()->row_count(), 1u);
+}
+
+TEST_F(OptimizerJoinOrderOptimizerTest, ChainWithCycle) {
+  // small - facts - large, plus an edge between small and large, so that the last join checks two pairs of columns
+  auto join_graph = JoinGraph{};
+  join_graph.vertices.push_back(JoinVertex{_small, {}});
+  join_graph.vertices.push_back(JoinVertex{_facts, {ScanPredicate{ColumnID{0}, ScanType::OpLessThan, 500}}});
+  join_graph.vertices.push_back(JoinVertex{_large, {}});
+  join_graph.edges.push_back(JoinEdge{1, ColumnID{1}, 0, ColumnID{0}});
+  join_graph.edges.push_back(JoinEdge{1, ColumnID{2}, 2, ColumnID{0}});
+  join_graph.edges.push_back(JoinEdge{0, ColumnID{0}, 2, ColumnID{0}});
+
+  // Facts match if f_small_id = f_large_id, i.e., if f_id % 100 < 10
+  for (const auto max_dynamic_programming_vertex_count : {size_t{3}, size_t{2}}) {
+    const auto plan = JoinOrderOptimizer{max_dynamic_programming_vertex_count}.optimize(join_graph);
+    EXPECT_EQ(plan.execute()->row_count(), 50u);
+    EXPECT_EQ(_join_row_counts(plan).size(), 2u);
+  }
+}
+
+TEST_F(OptimizerJoinOrderOptimizerTest, TablesWithoutStatistics) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("id", "int");
+  for (auto index = 0; index < 20; ++index) {
+    table->append({index});
+  }
+
+  auto join_graph = JoinGraph{};
+  join_graph.vertices.push_back(JoinVertex{table, {ScanPredicate{ColumnID{0}, ScanType::OpGreaterThanEquals, 15}}});
+  join_graph.vertices.push_back(JoinVertex{_small, {}});
+  join_graph.edges.push_back(JoinEdge{0, ColumnID{0}, 1, ColumnID{0}});
+  const auto plan = JoinOrderOptimizer{}.optimize(join_graph);
+  EXPECT_EQ(plan.execute()->row_count(), 0u);
+  EXPECT_GT(plan.estimated_row_count, 0.0);
+}
+
+TEST_F(OptimizerJoinOrderOptimizerTest, InvalidGraphs) {
+  auto join_graph = _star_join_graph();
+  join_graph.edges.pop_back();
+  EXPECT_THROW(JoinOrderOptimizer{}.optimize(join_graph), std::exception);
+  EXPECT_THROW(JoinOrderOptimizer{0}.optimize(join_graph), std::exception);
+
+  join_graph.edges.push_back(JoinEdge{0, ColumnID{2}, 3, ColumnID{0}});
+  EXPECT_THROW(JoinOrderOptimizer{}.optimize(join_graph), std::exception);
+  EXPECT_THROW(JoinOrderOptimizer{}.optimize(JoinGraph{}), std::exception);
+  EXPECT_THROW(JoinOrderOptimizer{64}, std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/count_min_sketch.hpp"
+
+namespace opossum {
+
+class StatisticsCountMinSketchTest : public BaseTest {};
+
+TEST_F(StatisticsCountMinSketchTest, HeavyHitters) {
+  auto count_min_sketch = CountMinSketch{};
+  for (auto value = int32_t{0}; value < 100'000; ++value) {
+    count_min_sketch.insert(value);
+  }
+  count_min_sketch.insert(int32_t{-1}, 20'000);
+  count_min_sketch.insert(std::string{"frequent"}, 5'000);
+  EXPECT_EQ(count_min_sketch.total_count(), 125'000u);
+
+  // The error is at most e / width * 125'000 = 166 with high probability
+  EXPECT_GE(count_min_sketch.estimate(int32_t{-1}), 20'000u);
+  EXPECT_LE(count_min_sketch.estimate(int32_t{-1}), 20'200u);
+  EXPECT_GE(count_min_sketch.estimate(std::string{"frequent"}), 5'000u);
+  EXPECT_LE(count_min_sketch.estimate(std::string{"frequent"}), 5'200u);
+}
+
+TEST_F(StatisticsCountMinSketchTest, NeverUnderestimates) {
+  auto count_min_sketch = CountMinSketch{256, 2};
+  for (auto value = int64_t{0}; value < 1'000; ++value) {
+    count_min_sketch.insert(value, value % 10 + 1);
+  }
+  for (auto value = int64_t{0}; value < 1'000; ++value) {
+    EXPECT_GE(count_min_sketch.estimate(value), static_cast<uint64_t>(value % 10 + 1));
+  }
+}
+
+TEST_F(StatisticsCountMinSketchTest, Merge) {
+  auto first = CountMinSketch{};
+  auto second = CountMinSketch{};
+  first.insert(1.5, 10);
+  second.insert(1.5, 20);
+  second.insert(2.5, 5);
+
+  first.merge(second);
+  EXPECT_EQ(first.estimate(1.5), 30u);
+  EXPECT_EQ(first.estimate(2.5), 5u);
+  EXPECT_EQ(first.total_count(), 35u);
+
+  EXPECT_THROW(first.merge(CountMinSketch{1024}), std::exception);
+  EXPECT_THROW(CountMinSketch{1000}, std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/equi_height_histogram.hpp"
+
+namespace opossum {
+
+class StatisticsEquiHeightHistogramTest : public BaseTest {
+ protected:
+  static std::string _zero_padded(const int value) {
+    const auto digits = std::to_string(value);
+    return "value_" + std::string(4 - digits.size(), '0') + digits;
+  }
+};
+
+TEST_F(StatisticsEquiHeightHistogramTest, UniformValues) {
+  auto sample = std::vector<int32_t>{};
+  for (auto value = int32_t{9'999}; value >= 0; --value) {
+    sample.push_back(value);
+  }
+  const auto histogram = EquiHeightHistogram<int32_t>{sample, 10'000.0};
+  EXPECT_EQ(histogram.bin_count(), EquiHeightHistogram<int32_t>::DEFAULT_BIN_COUNT);
+  EXPECT_EQ(histogram.min(), 0);
+  EXPECT_EQ(histogram.max(), 9'999);
+
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpLessThan, 5'000), 0.5, 0.01);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpLessThanEquals, 2'500), 0.25, 0.01);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpGreaterThan, 9'000), 0.1, 0.01);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpGreaterThanEquals, 1'234), 0.8766, 0.01);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpEquals, 42), 0.0001, 0.00001);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpNotEquals, 42), 0.9999, 0.00001);
+
+  // Values outside of the histogram's range
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpLessThan, -5), 0.0);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpLessThan, 20'000), 1.0);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpEquals, 20'000), 0.0);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpGreaterThanEquals, 0), 1.0);
+
+  // Values are converted to the type of the column
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpLessThan, AllTypeVariant{5'000.0}),
+            histogram.estimate_selectivity(ScanType::OpLessThan, 5'000));
+  EXPECT_THROW(histogram.estimate_selectivity(ScanType::OpLike, 5), std::exception);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, SkewedValues) {
+  // Half of the values are 0, which is not split across bins
+  auto sample = std::vector<double>(5'000, 0.0);
+  for (auto value = 1; value <= 5'000; ++value) {
+    sample.push_back(value);
+  }
+  const auto histogram = EquiHeightHistogram<double>{sample, 5'001.0, 10};
+  EXPECT_LE(histogram.bin_count(), 10u);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpEquals, 0.0), 0.5, 0.001);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpGreaterThan, 0.0), 0.5, 0.001);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpLessThanEquals, 2'500.0), 0.75, 0.01);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpEquals, 17.0), 0.0001, 0.00001);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, DistinctCountsAreScaled) {
+  // The sample holds every 10th value, so every value of the sample stands for 10 distinct values of the column
+  auto sample = std::vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 100'000; value += 10) {
+    sample.push_back(value);
+  }
+  const auto histogram = EquiHeightHistogram<int64_t>{sample, 100'000.0};
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpEquals, int64_t{55}), 0.00001, 0.000001);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpLessThan, int64_t{55'555}), 0.55555, 0.01);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, Strings) {
+  auto sample = std::vector<std::string>{};
+  for (auto value = 0; value < 10'000; ++value) {
+    sample.push_back(_zero_padded(value));
+  }
+  const auto histogram = EquiHeightHistogram<std::string>{sample, 10'000.0};
+  EXPECT_EQ(histogram.min(), "value_0000");
+  EXPECT_EQ(histogram.max(), "value_9999");
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpLessThan, _zero_padded(5'000)), 0.5, 0.02);
+  EXPECT_NEAR(histogram.estimate_selectivity(ScanType::OpGreaterThanEquals, _zero_padded(7'321)), 0.2679, 0.02);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpLessThan, std::string{"a"}), 0.0);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpGreaterThan, std::string{"z"}), 0.0);
+  EXPECT_GT(histogram.estimate_memory_usage(), 2 * histogram.bin_count() * sizeof(std::string));
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, Empty) {
+  const auto histogram = EquiHeightHistogram<float>{{}, 0.0};
+  EXPECT_EQ(histogram.bin_count(), 0u);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpLessThan, 1.0f), 0.0);
+  EXPECT_EQ(histogram.estimate_selectivity(ScanType::OpNotEquals, 1.0f), 0.0);
+  EXPECT_THROW(histogram.min(), std::exception);
+  EXPECT_THROW((EquiHeightHistogram<float>{{1.0f}, 1.0, 0}), std::exception);
+}
+
+}  // namespace opossum
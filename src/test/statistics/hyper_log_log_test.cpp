@@ -0,0 +1,63 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class StatisticsHyperLogLogTest : public BaseTest {};
+
+TEST_F(StatisticsHyperLogLogTest, SmallCardinalities) {
+  auto hyper_log_log = HyperLogLog{};
+  EXPECT_EQ(hyper_log_log.estimate(), 0.0);
+
+  // Duplicates do not change the estimate
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      hyper_log_log.insert(value);
+    }
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 100.0, 3.0);
+}
+
+TEST_F(StatisticsHyperLogLogTest, LargeCardinalities) {
+  for (const auto distinct_count : {10'000, 1'000'000}) {
+    auto hyper_log_log = HyperLogLog{};
+    for (auto value = int64_t{0}; value < distinct_count; ++value) {
+      hyper_log_log.insert(value);
+    }
+    // The standard error is about 1.6%, so 5% leaves room for three standard deviations
+    EXPECT_NEAR(hyper_log_log.estimate(), distinct_count, distinct_count * 0.05);
+  }
+
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = 0; value < 10'000; ++value) {
+    hyper_log_log.insert(std::to_string(value));
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 10'000.0, 500.0);
+}
+
+TEST_F(StatisticsHyperLogLogTest, Merge) {
+  auto first = HyperLogLog{};
+  auto second = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    first.insert(value);
+    second.insert(value + 10'000);
+  }
+
+  // The merged sketch estimates the union, in which the overlapping values are counted once
+  first.merge(second);
+  EXPECT_NEAR(first.estimate(), 30'000.0, 1'500.0);
+
+  EXPECT_THROW(first.merge(HyperLogLog{10}), std::exception);
+}
+
+TEST_F(StatisticsHyperLogLogTest, Precision) {
+  EXPECT_EQ(HyperLogLog{}.precision(), HyperLogLog::DEFAULT_PRECISION);
+  EXPECT_LT(HyperLogLog{10}.estimate_memory_usage(), HyperLogLog{14}.estimate_memory_usage());
+  EXPECT_THROW(HyperLogLog{2}, std::exception);
+}
+
+}  // namespace opossum
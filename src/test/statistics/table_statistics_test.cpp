@@ -0,0 +1,157 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/chunk_statistics.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _append_rows(0, 500);
+  }
+
+  void _append_rows(const int begin, const int end) {
+    for (auto index = begin; index < end; ++index) {
+      _table->append({index % 50, "value " + std::to_string(index % 3)});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, Disabled) {
+  EXPECT_FALSE(_table->table_statistics());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}).get_statistics());
+}
+
+TEST_F(StatisticsTableStatisticsTest, MaintainedWhenSealing) {
+  // The first chunks are dictionary-encoded, so that both kinds of columns are covered
+  _table->merge_delta();
+  _table->enable_statistics();
+  _append_rows(500, 950);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < _table->chunk_count(); ++chunk_id) {
+    const auto chunk_statistics = _table->get_chunk(chunk_id).get_statistics();
+    ASSERT_TRUE(chunk_statistics);
+    EXPECT_EQ(chunk_statistics->row_count(), 100u);
+    EXPECT_NEAR(chunk_statistics->estimate_distinct_count(ColumnID{0}), 50.0, 2.0);
+    EXPECT_NEAR(chunk_statistics->estimate_distinct_count(ColumnID{1}), 3.0, 0.5);
+  }
+
+  // The last chunk is not sealed yet, but its rows are included
+  EXPECT_FALSE(_table->get_chunk(ChunkID{9}).get_statistics());
+  const auto statistics = _table->table_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->row_count(), 950u);
+  EXPECT_EQ(statistics->col_count(), 2u);
+  EXPECT_NEAR(statistics->estimate_distinct_count(ColumnID{0}), 50.0, 2.0);
+  EXPECT_NEAR(statistics->estimate_distinct_count(ColumnID{1}), 3.0, 0.5);
+
+  // Every value of a occurs 19 times and every value of b 316 or 317 times
+  EXPECT_GE(statistics->estimate_count(ColumnID{0}, 7), 19u);
+  EXPECT_LE(statistics->estimate_count(ColumnID{0}, 7), 25u);
+  EXPECT_GE(statistics->estimate_count(ColumnID{1}, "value 1"), 317u);
+  EXPECT_LE(statistics->estimate_count(ColumnID{1}, "value 1"), 325u);
+  EXPECT_LE(statistics->estimate_count(ColumnID{0}, 1'000), 5u);
+
+  // Values are converted to the type of the column
+  EXPECT_EQ(statistics->estimate_count(ColumnID{0}, int64_t{7}), statistics->estimate_count(ColumnID{0}, 7));
+
+  // The returned statistics do not change when rows are added
+  _append_rows(950, 1'000);
+  EXPECT_EQ(statistics->row_count(), 950u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{9}).get_statistics());
+  EXPECT_EQ(_table->table_statistics()->row_count(), 1'000u);
+  EXPECT_EQ(_table->table_statistics(), _table->table_statistics());
+}
+
+TEST_F(StatisticsTableStatisticsTest, SketchesAreSharedUntilModified) {
+  _table->enable_statistics();
+  _table->seal_last_chunk();
+  const auto* const value_counts = &_table->table_statistics()->value_counts(ColumnID{0});
+
+  // Without readers holding the statistics, sealing a chunk modifies the sketches in place
+  _append_rows(500, 550);
+  _table->seal_last_chunk();
+  EXPECT_EQ(&_table->table_statistics()->value_counts(ColumnID{0}), value_counts);
+
+  // Sketches that a reader holds are copied before they are modified
+  const auto statistics = _table->table_statistics();
+  _append_rows(550, 600);
+  _table->seal_last_chunk();
+  EXPECT_EQ(statistics->row_count(), 550u);
+  EXPECT_EQ(&statistics->value_counts(ColumnID{0}), value_counts);
+  EXPECT_EQ(_table->table_statistics()->row_count(), 600u);
+  EXPECT_NE(&_table->table_statistics()->value_counts(ColumnID{0}), value_counts);
+
+  // The statistics including the unsealed last chunk are built once per version of the table
+  _append_rows(600, 610);
+  const auto unsealed_statistics = _table->table_statistics();
+  EXPECT_EQ(_table->table_statistics(), unsealed_statistics);
+  _append_rows(610, 620);
+  EXPECT_NE(_table->table_statistics(), unsealed_statistics);
+  EXPECT_EQ(unsealed_statistics->row_count(), 610u);
+  EXPECT_EQ(_table->table_statistics()->row_count(), 620u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, DistinctCountIsCappedByRowCount) {
+  auto table = Table{10};
+  table.add_column("a", "double");
+  table.enable_statistics();
+  for (auto index = 0; index < 4; ++index) {
+    table.append({index * 0.5});
+  }
+
+  const auto statistics = table.table_statistics();
+  EXPECT_EQ(statistics->row_count(), 4u);
+  EXPECT_LE(statistics->estimate_distinct_count(ColumnID{0}), 4.0);
+  EXPECT_GE(statistics->estimate_distinct_count(ColumnID{0}), 3.5);
+}
+
+TEST_F(StatisticsTableStatisticsTest, Selectivities) {
+  _table->enable_statistics();
+  const auto statistics = _table->table_statistics();
+  ASSERT_TRUE(statistics->histogram(ColumnID{0}));
+  ASSERT_TRUE(statistics->histogram(ColumnID{1}));
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 25), 0.5, 0.05);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 40), 0.2, 0.05);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 7), 0.02, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, 7), 0.98, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "value 1"), 1.0 / 3, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpGreaterThan, "value 0"), 2.0 / 3, 0.01);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpLike, "%1"),
+            TableStatistics::DEFAULT_LIKE_SELECTIVITY);
+
+  // Without rows or histograms, the estimates fall back to fixed selectivities
+  auto empty_statistics = TableStatistics{{DataType::Int, DataType::String}};
+  EXPECT_EQ(empty_statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 5), 0.0);
+  empty_statistics.add_chunk(_table->get_chunk(ChunkID{0}), *_table->get_chunk(ChunkID{0}).get_statistics());
+  EXPECT_FALSE(empty_statistics.histogram(ColumnID{0}));
+  EXPECT_EQ(empty_statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 5),
+            TableStatistics::DEFAULT_RANGE_SELECTIVITY);
+}
+
+TEST_F(StatisticsTableStatisticsTest, HistogramsAreRebuiltWhenTheTableDoubles) {
+  _table->enable_statistics();
+  EXPECT_EQ(_table->table_statistics()->histogram_row_count(), 500u);
+
+  _append_rows(500, 900);
+  EXPECT_EQ(_table->table_statistics()->histogram_row_count(), 500u);
+
+  _append_rows(900, 1'000);
+  const auto statistics = _table->table_statistics();
+  EXPECT_EQ(statistics->histogram_row_count(), 1'000u);
+  EXPECT_EQ(statistics->histogram(ColumnID{0})->estimate_selectivity(ScanType::OpLessThan, 0), 0.0);
+}
+
+}  // namespace opossum
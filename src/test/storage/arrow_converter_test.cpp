@@ -0,0 +1,175 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/arrow_converter.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageArrowConverterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    for (auto index = 0; index < 7; ++index) {
+      _table->append({index, int64_t{index} * 1'000'000'000'000, index * 0.5f, index * 0.25,
+                      std::string(static_cast<size_t>(index), 'x')});
+    }
+  }
+
+  std::vector<ArrowArray> _export_chunks(const Table& table) {
+    auto batches = std::vector<ArrowArray>(table.chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      ArrowConverter::export_chunk(table.get_chunk(chunk_id), &batches[chunk_id]);
+    }
+    return batches;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageArrowConverterTest, ExportSchema) {
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  ASSERT_EQ(schema.n_children, 5);
+
+  const auto formats = std::vector<std::string>{"i", "l", "f", "g", "u"};
+  for (auto column_id = ColumnID{0}; column_id < 5; ++column_id) {
+    EXPECT_EQ(std::string{schema.children[column_id]->format}, formats[column_id]);
+    EXPECT_EQ(std::string{schema.children[column_id]->name}, _table->column_name(column_id));
+    EXPECT_EQ(schema.children[column_id]->flags & ARROW_FLAG_NULLABLE, 0);
+  }
+
+  schema.release(&schema);
+  EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST_F(StorageArrowConverterTest, ExportChunkWithoutCopying) {
+  auto batch = ArrowArray{};
+  ArrowConverter::export_chunk(_table->get_chunk(ChunkID{1}), &batch);
+  EXPECT_EQ(batch.length, 3);
+  EXPECT_EQ(batch.null_count, 0);
+  ASSERT_EQ(batch.n_children, 5);
+
+  const auto int_column =
+      std::static_pointer_cast<const ValueColumn<int32_t>>(_table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+  const auto& int_array = *batch.children[0];
+  EXPECT_EQ(int_array.length, 3);
+  ASSERT_EQ(int_array.n_buffers, 2);
+  EXPECT_EQ(int_array.buffers[0], nullptr);
+  EXPECT_EQ(int_array.buffers[1], int_column->values().data());
+
+  // Strings are stored as offsets into the concatenated characters
+  const auto& string_array = *batch.children[4];
+  ASSERT_EQ(string_array.n_buffers, 3);
+  const auto offsets = static_cast<const int32_t*>(string_array.buffers[1]);
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[1], 3);
+  EXPECT_EQ(offsets[3], 3 + 4 + 5);
+  EXPECT_EQ(std::string(static_cast<const char*>(string_array.buffers[2]), offsets[3]), std::string(12, 'x'));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(string_array.buffers[1]) % 64, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(string_array.buffers[2]) % 64, 0u);
+
+  // The array keeps the values alive
+  _table = nullptr;
+  EXPECT_EQ(static_cast<const int32_t*>(int_array.buffers[1])[2], 5);
+  batch.release(&batch);
+  EXPECT_EQ(batch.release, nullptr);
+}
+
+TEST_F(StorageArrowConverterTest, ExportRejectsReferenceColumns) {
+  const auto column = _table->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  auto chunk = Chunk{};
+  chunk.add_column(column);
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, std::make_shared<PosList>(1, RowID{})));
+  const auto use_count = column.use_count();
+
+  auto batch = ArrowArray{};
+  EXPECT_THROW(ArrowConverter::export_chunk(chunk, &batch), std::logic_error);
+
+  // The first column has been exported and is released again
+  EXPECT_EQ(batch.release, nullptr);
+  EXPECT_EQ(column.use_count(), use_count);
+}
+
+TEST_F(StorageArrowConverterTest, RoundTrip) {
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  auto batches = _export_chunks(*_table);
+
+  const auto table = ArrowConverter::import_table(&schema, batches);
+  EXPECT_EQ(schema.release, nullptr);
+  EXPECT_EQ(batches[0].release, nullptr);
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->column_names(), _table->column_names());
+  EXPECT_TABLE_EQ(table, _table, true);
+}
+
+TEST_F(StorageArrowConverterTest, RoundTripDictionaryColumns) {
+  // DictionaryColumns are decoded for the export
+  _table->merge_delta();
+  ASSERT_EQ(_table->get_chunk(ChunkID{0}).get_column(ColumnID{4})->encoding_type(), EncodingType::Dictionary);
+
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  auto batches = _export_chunks(*_table);
+
+  const auto table = ArrowConverter::import_table(&schema, batches);
+  EXPECT_TABLE_EQ(table, _table, true);
+}
+
+TEST_F(StorageArrowConverterTest, ImportSlices) {
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  auto batches = _export_chunks(*_table);
+
+  // Skips the first row of the record batch and the first two values of the string array
+  batches[0].offset = 1;
+  batches[0].length = 1;
+  batches[0].children[4]->offset = 1;
+  batches[0].children[4]->length = 2;
+
+  const auto table = ArrowConverter::import_table(&schema, batches);
+  EXPECT_EQ(table->row_count(), 5u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).size(), 1u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))[0], AllTypeVariant{1});
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_column(ColumnID{4}))[0], AllTypeVariant{"xx"});
+}
+
+TEST_F(StorageArrowConverterTest, ImportRejectsNulls) {
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  auto batches = _export_chunks(*_table);
+
+  // Marks the second value of the first column as null
+  const uint8_t validity = 0b101;
+  batches[1].children[0]->buffers[0] = &validity;
+  batches[1].children[0]->null_count = -1;
+
+  EXPECT_THROW(ArrowConverter::import_table(&schema, batches), std::exception);
+  EXPECT_EQ(schema.release, nullptr);
+  EXPECT_EQ(batches[2].release, nullptr);
+}
+
+TEST_F(StorageArrowConverterTest, ImportRejectsUnsupportedTypes) {
+  auto schema = ArrowSchema{};
+  ArrowConverter::export_schema(*_table, &schema);
+  schema.children[1]->format = "s";
+  auto batches = std::vector<ArrowArray>{};
+
+  EXPECT_THROW(ArrowConverter::import_table(&schema, batches), std::exception);
+  EXPECT_EQ(schema.release, nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1'000, 0.01};
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    bloom_filter.insert(value * 7);
+  }
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.contains(value * 7));
+  }
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  for (const auto false_positive_rate : {0.1, 0.01}) {
+    auto bloom_filter = BloomFilter{10'000, false_positive_rate};
+    for (auto value = int64_t{0}; value < 10'000; ++value) {
+      bloom_filter.insert(value);
+    }
+
+    auto false_positives = 0;
+    for (auto value = int64_t{10'000}; value < 110'000; ++value) {
+      if (bloom_filter.contains(value)) ++false_positives;
+    }
+    EXPECT_LT(false_positives / 100'000.0, false_positive_rate * 1.5);
+  }
+
+  // A lower false positive rate requires more memory
+  EXPECT_LT(BloomFilter(10'000, 0.1).block_count(), BloomFilter(10'000, 0.01).block_count());
+  EXPECT_THROW(BloomFilter(10, 0.0), std::exception);
+  EXPECT_THROW(BloomFilter(10, 1.0), std::exception);
+}
+
+TEST_F(StorageBloomFilterTest, Hashing) {
+  EXPECT_EQ(BloomFilter::hash_value(0.0), BloomFilter::hash_value(-0.0));
+  EXPECT_EQ(BloomFilter::hash_value(std::string{"string"}), BloomFilter::hash_value(std::string_view{"string"}));
+  EXPECT_NE(BloomFilter::hash_value(std::string{"a"}), BloomFilter::hash_value(std::string{"a", 2}));
+  EXPECT_NE(BloomFilter::hash_value(std::string(16, 'a')), BloomFilter::hash_value(std::string(17, 'a')));
+}
+
+TEST_F(StorageBloomFilterTest, BuildFromColumn) {
+  auto column = ValueColumn<std::string>{};
+  column.append("alice@example.com");
+  column.append("bob@example.com");
+
+  const auto bloom_filter = BloomFilter::build(column, 0.001);
+  EXPECT_TRUE(bloom_filter->contains(std::string{"alice@example.com"}));
+  EXPECT_TRUE(bloom_filter->contains(AllTypeVariant{"bob@example.com"}, DataType::String));
+  EXPECT_FALSE(bloom_filter->contains(std::string{"carol@example.com"}));
+  EXPECT_GE(bloom_filter->estimate_memory_usage(), CACHE_LINE_SIZE);
+}
+
+}  // namespace opossum
@@ -0,0 +1,151 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/materialize.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto index = 0; index < 1'000; ++index) {
+      _table->append({index, "a string that does not fit into SSO " + std::to_string(index)});
+    }
+  }
+
+  void TearDown() override { BufferManager::get().set_memory_budget(0); }
+
+  static size_t _resident_chunk_count(const Table& table) {
+    auto count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      if (table.get_chunk(chunk_id).is_resident()) ++count;
+    }
+    return count;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageBufferManagerTest, EvictsChunksBeyondBudget) {
+  _table->enable_eviction();
+  const auto& first_chunk = _table->get_chunk(ChunkID{0});
+  ASSERT_TRUE(first_chunk.is_evictable());
+  const auto chunk_bytes = first_chunk.get_column(ColumnID{1})->estimate_memory_usage();
+  EXPECT_GT(BufferManager::get().resident_bytes(), 10 * chunk_bytes);
+
+  const auto evicted_before = _counter_value("chunk evicted by BufferManager");
+  BufferManager::get().set_memory_budget(BufferManager::get().resident_bytes() / 4);
+  EXPECT_LE(BufferManager::get().resident_bytes(), BufferManager::get().memory_budget());
+  EXPECT_LT(_resident_chunk_count(*_table), 10u);
+  EXPECT_GT(_counter_value("chunk evicted by BufferManager") - evicted_before, 0u);
+
+  // Metadata stays available without loading the columns
+  const auto resident_before = _resident_chunk_count(*_table);
+  EXPECT_EQ(_table->row_count(), 1'000u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{9}).size(), 100u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{9}).get_min_max(ColumnID{0}));
+  EXPECT_EQ(_resident_chunk_count(*_table), resident_before);
+}
+
+TEST_F(StorageBufferManagerTest, ReloadsTransparently) {
+  _table->enable_eviction();
+  BufferManager::get().set_memory_budget(BufferManager::get().resident_bytes() / 4);
+
+  // Operators read evicted chunks like resident ones
+  const auto loaded_before = _counter_value("chunk loaded by BufferManager");
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 50);
+  table_scan->execute();
+  auto materialize = std::make_shared<Materialize>(table_scan);
+  materialize->execute();
+
+  EXPECT_GT(_counter_value("chunk loaded by BufferManager") - loaded_before, 0u);
+  EXPECT_LE(BufferManager::get().resident_bytes(), BufferManager::get().memory_budget());
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  for (auto index = 50; index < 1'000; ++index) {
+    expected->append({index, "a string that does not fit into SSO " + std::to_string(index)});
+  }
+  EXPECT_TABLE_EQ(materialize->get_output(), expected);
+}
+
+TEST_F(StorageBufferManagerTest, PinnedChunksAreNotEvicted) {
+  _table->enable_eviction();
+  {
+    // Chunks are only pinned once their values are accessed
+    const auto values = ReferencedValues<int32_t>{*_table, ColumnID{0}};
+    BufferManager::get().set_memory_budget(1);
+    EXPECT_EQ(_resident_chunk_count(*_table), 0u);
+
+    EXPECT_EQ((values[RowID{ChunkID{3}, 42}]), 342);
+    BufferManager::get().set_memory_budget(1);
+    EXPECT_EQ(_resident_chunk_count(*_table), 1u);
+    EXPECT_TRUE(_table->get_chunk(ChunkID{3}).is_resident());
+  }
+
+  // Once unpinned, chunks are evicted as soon as the budget is enforced again
+  BufferManager::get().set_memory_budget(1);
+  EXPECT_EQ(_resident_chunk_count(*_table), 0u);
+}
+
+TEST_F(StorageBufferManagerTest, OnlyReferencedChunksAreLoaded) {
+  _table->enable_eviction();
+  BufferManager::get().set_memory_budget(1);
+  ASSERT_EQ(_resident_chunk_count(*_table), 0u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 342);
+  table_scan->execute();
+
+  // Operators on the reference output only load the chunk that it refers to, once per operator
+  const auto loaded_before = _counter_value("chunk loaded by BufferManager");
+  auto like_scan = std::make_shared<TableScan>(table_scan, ColumnID{1}, ScanType::OpLike, "%342");
+  like_scan->execute();
+  auto materialize = std::make_shared<Materialize>(like_scan);
+  materialize->execute();
+  EXPECT_EQ(materialize->get_output()->row_count(), 1u);
+  EXPECT_LE(_counter_value("chunk loaded by BufferManager") - loaded_before, 2u);
+}
+
+TEST_F(StorageBufferManagerTest, NewlySealedChunksAreEvictable) {
+  _table->enable_eviction();
+  _table->append({1'000, "x"});
+  EXPECT_FALSE(_table->get_chunk(ChunkID{10}).is_evictable());
+  _table->seal_last_chunk();
+  EXPECT_TRUE(_table->get_chunk(ChunkID{10}).is_evictable());
+}
+
+TEST_F(StorageBufferManagerTest, DestroyedChunksReleaseBudget) {
+  const auto resident_before = BufferManager::get().resident_bytes();
+  _table->enable_eviction();
+  EXPECT_GT(BufferManager::get().resident_bytes(), resident_before);
+
+  _table = nullptr;
+  EXPECT_EQ(BufferManager::get().resident_bytes(), resident_before);
+}
+
+TEST_F(StorageBufferManagerTest, SpillDirectory) {
+  const auto previous_spill_directory = BufferManager::get().spill_directory();
+  BufferManager::get().set_spill_directory("/this/directory/does/not/exist");
+  _table->enable_eviction();
+  EXPECT_THROW(BufferManager::get().set_memory_budget(1), std::logic_error);
+  BufferManager::get().set_spill_directory(previous_spill_directory);
+}
+
+}  // namespace opossum
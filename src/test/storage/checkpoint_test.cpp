@@ -0,0 +1,186 @@
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/checkpoint.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/write_ahead_log.hpp"
+
+namespace opossum {
+
+class StorageCheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _directory = _temp_path("hyrise_checkpoint_test");
+    _remove_directory();
+
+    _table = _create_table(_columns, 3);
+    for (auto index = 0; index < 8; ++index) {
+      _table->append({index, "a string that does not fit into SSO " + std::to_string(index), index * 0.5});
+    }
+    StorageManager::get().add_table("t", _table);
+    StorageManager::get().add_table("empty", _create_table(_columns, 3));
+  }
+
+  void TearDown() override { _remove_directory(); }
+
+  std::vector<std::string> _file_names() const {
+    auto file_names = std::vector<std::string>{};
+    const auto directory = opendir(_directory.c_str());
+    if (!directory) return file_names;
+    while (const auto entry = readdir(directory)) {
+      const auto file_name = std::string{entry->d_name};
+      if (file_name != "." && file_name != "..") file_names.push_back(file_name);
+    }
+    closedir(directory);
+    return file_names;
+  }
+
+  void _remove_directory() const {
+    for (const auto& file_name : _file_names()) {
+      std::remove((_directory + "/" + file_name).c_str());
+    }
+    rmdir(_directory.c_str());
+  }
+
+  // the columns of the tables in the tests
+  const std::vector<std::pair<std::string, std::string>> _columns{{"a", "int"}, {"b", "string"}, {"c", "double"}};
+
+  std::string _directory;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageCheckpointTest, LoadsTablesLazily) {
+  Checkpoint{_directory, 42}.write();
+  StorageManager::reset();
+
+  EXPECT_EQ(Checkpoint::load(_directory), 42u);
+  ASSERT_TRUE(StorageManager::get().has_table("empty"));
+  EXPECT_EQ(StorageManager::get().get_table("empty")->col_count(), 3u);
+  EXPECT_EQ(StorageManager::get().get_table("empty")->row_count(), 0u);
+
+  const auto table = StorageManager::get().get_table("t");
+  EXPECT_EQ(table->chunk_size(), 3u);
+  ASSERT_EQ(table->chunk_count(), 3u);
+
+  // Sealed chunks are not loaded before they are accessed, but their metadata is available
+  const auto& first_chunk = table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(first_chunk.is_sealed());
+  EXPECT_FALSE(first_chunk.is_resident());
+  EXPECT_EQ(first_chunk.size(), 3u);
+  EXPECT_EQ(first_chunk.persistent_id(), _table->get_chunk(ChunkID{0}).persistent_id());
+  ASSERT_TRUE(first_chunk.get_min_max(ColumnID{0}));
+  EXPECT_EQ(first_chunk.get_min_max(ColumnID{0})->max, AllTypeVariant{2});
+  EXPECT_FALSE(table->get_chunk(ChunkID{2}).is_sealed());
+
+  EXPECT_TABLE_EQ(table, _table, true);
+  EXPECT_TRUE(first_chunk.is_resident());
+
+  // Appending continues in the last chunk
+  table->append({8, "eight", 4.0});
+  _table->append({8, "eight", 4.0});
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_TABLE_EQ(table, _table, true);
+}
+
+TEST_F(StorageCheckpointTest, KeepsSortOrder) {
+  auto table = _create_table(_columns, 3);
+  table->enable_clustering({ColumnID{2}, ColumnID{0}});
+  for (auto index = 0; index < 8; ++index) {
+    table->append({index, "value", (index % 3) * 0.5});
+  }
+  StorageManager::get().add_table("sorted", table);
+  Checkpoint{_directory}.write();
+  StorageManager::reset();
+
+  Checkpoint::load(_directory);
+  const auto loaded_table = StorageManager::get().get_table("sorted");
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).sorted_by(), (std::vector<ColumnID>{ColumnID{2}, ColumnID{0}}));
+  EXPECT_TRUE(loaded_table->get_chunk(ChunkID{2}).sorted_by().empty());
+  EXPECT_TABLE_EQ(loaded_table, table, true);
+}
+
+TEST_F(StorageCheckpointTest, SkipsUnchangedChunks) {
+  const auto written_before = _counter_value("chunk written by Checkpoint");
+  const auto skipped_before = _counter_value("chunk skipped by Checkpoint");
+  Checkpoint{_directory}.write();
+  EXPECT_EQ(_counter_value("chunk written by Checkpoint") - written_before, 3u);
+  const auto first_file_names = _file_names();
+  EXPECT_EQ(first_file_names.size(), 4u);
+
+  // The last chunk is sealed and a new one is started, only these two are written
+  _table->append({8, "eight", 4.0});
+  _table->append({9, "nine", 4.5});
+  Checkpoint{_directory}.write();
+  EXPECT_EQ(_counter_value("chunk written by Checkpoint") - written_before, 5u);
+  EXPECT_EQ(_counter_value("chunk skipped by Checkpoint") - skipped_before, 2u);
+
+  // The file of the previous last chunk has been removed
+  EXPECT_EQ(_file_names().size(), 5u);
+
+  StorageManager::reset();
+  Checkpoint::load(_directory);
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("t"), _table, true);
+}
+
+TEST_F(StorageCheckpointTest, SkipsLoadedChunks) {
+  Checkpoint{_directory}.write();
+  StorageManager::reset();
+  Checkpoint::load(_directory);
+
+  // Writing the checkpoint again neither loads nor rewrites the sealed chunks
+  const auto written_before = _counter_value("chunk written by Checkpoint");
+  Checkpoint{_directory}.write();
+  EXPECT_EQ(_counter_value("chunk written by Checkpoint") - written_before, 1u);
+  EXPECT_FALSE(StorageManager::get().get_table("t")->get_chunk(ChunkID{0}).is_resident());
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("t"), _table, true);
+}
+
+TEST_F(StorageCheckpointTest, DroppedTables) {
+  Checkpoint{_directory}.write();
+  StorageManager::get().drop_table("t");
+  Checkpoint{_directory}.write();
+
+  // Only the manifest remains
+  EXPECT_EQ(_file_names().size(), 1u);
+  StorageManager::reset();
+  Checkpoint::load(_directory);
+  EXPECT_FALSE(StorageManager::get().has_table("t"));
+  EXPECT_TRUE(StorageManager::get().has_table("empty"));
+}
+
+TEST_F(StorageCheckpointTest, MissingCheckpoint) { EXPECT_THROW(Checkpoint::load(_directory), std::exception); }
+
+TEST_F(StorageCheckpointTest, RestartsWriteAheadLogFromCheckpoint) {
+  StorageManager::reset();
+  const auto log_path = _directory + "_log";
+  std::remove(log_path.c_str());
+
+  {
+    WriteAheadLog log{log_path};
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.0}, {2, "two", 2.0}, {3, "three", 3.0}, {4, "four", 4.0}});
+    log.checkpoint(_directory);
+    log.append("t", {{5, "five", 5.0}});
+  }
+  auto expected_table = StorageManager::get().get_table("t");
+
+  StorageManager::reset();
+  {
+    WriteAheadLog log{log_path, _directory};
+    EXPECT_EQ(log.recovered_record_count(), 1u);
+    EXPECT_TABLE_EQ(StorageManager::get().get_table("t"), expected_table, true);
+  }
+  std::remove(log_path.c_str());
+}
+
+}  // namespace opossum
@@ -1,10 +1,13 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_column.hpp"
+#include "../lib/storage/bloom_filter.hpp"
 #include "../lib/storage/chunk.hpp"
 #include "../lib/types.hpp"
 
@@ -58,6 +61,78 @@ TEST_F(StorageChunkTest, RetrieveColumn) {
   EXPECT_EQ(base_col->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, Seal) {
+  c.add_column(vc_int);
+  EXPECT_FALSE(c.is_sealed());
+  c.seal();
+  EXPECT_TRUE(c.is_sealed());
+  EXPECT_THROW(c.add_column(vc_str), std::exception);
+  if (IS_DEBUG) {
+    EXPECT_THROW(c.append({5}), std::exception);
+  }
+}
+
+TEST_F(StorageChunkTest, Sort) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  c.append({4, "again"});
+  EXPECT_TRUE(c.sorted_by().empty());
+
+  // Ties of the first column are broken by the second one
+  c.sort({ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(c.sorted_by(), (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+  EXPECT_TRUE(c.is_sorted_by(ColumnID{0}));
+  EXPECT_FALSE(c.is_sorted_by(ColumnID{1}));
+
+  const auto ints = std::dynamic_pointer_cast<ValueColumn<int32_t>>(c.get_column(ColumnID{0}));
+  const auto strings = std::dynamic_pointer_cast<ValueColumn<std::string>>(c.get_column(ColumnID{1}));
+  ASSERT_TRUE(ints && strings);
+  EXPECT_EQ(ints->values(), (pmr_vector<int32_t>{3, 4, 4, 6}));
+  EXPECT_EQ(strings->values(), (pmr_vector<std::string>{"!", "Hello,", "again", "world"}));
+
+  c.seal();
+  EXPECT_THROW(c.sort({ColumnID{1}}), std::logic_error);
+}
+
+TEST_F(StorageChunkTest, MinMax) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  EXPECT_FALSE(c.get_min_max(ColumnID{0}));
+
+  c.seal();
+  ASSERT_TRUE(c.get_min_max(ColumnID{0}));
+  EXPECT_EQ(c.get_min_max(ColumnID{0})->min, AllTypeVariant{3});
+  EXPECT_EQ(c.get_min_max(ColumnID{0})->max, AllTypeVariant{6});
+  ASSERT_TRUE(c.get_min_max(ColumnID{1}));
+  EXPECT_EQ(c.get_min_max(ColumnID{1})->min, AllTypeVariant{"!"});
+  EXPECT_EQ(c.get_min_max(ColumnID{1})->max, AllTypeVariant{"world"});
+
+  auto empty_chunk = Chunk{};
+  empty_chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>("int"));
+  empty_chunk.seal();
+  EXPECT_FALSE(empty_chunk.get_min_max(ColumnID{0}));
+}
+
+TEST_F(StorageChunkTest, BloomFilters) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  EXPECT_EQ(c.get_bloom_filter(ColumnID{1}), nullptr);
+
+  const auto bloom_filter = BloomFilter::build(*vc_str, 0.01);
+  c.set_bloom_filter(ColumnID{1}, bloom_filter);
+  EXPECT_EQ(c.get_bloom_filter(ColumnID{1}), bloom_filter);
+  EXPECT_EQ(c.get_bloom_filter(ColumnID{0}), nullptr);
+  EXPECT_THROW(c.set_bloom_filter(ColumnID{2}, bloom_filter), std::exception);
+}
+
+TEST_F(StorageChunkTest, MemoryUsage) {
+  const auto empty_usage = c.estimate_memory_usage();
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  EXPECT_GE(c.estimate_memory_usage(),
+            empty_usage + vc_int->estimate_memory_usage() + vc_str->estimate_memory_usage());
+}
+
 TEST_F(StorageChunkTest, UnknownColumnType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
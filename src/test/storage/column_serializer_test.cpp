@@ -0,0 +1,77 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/column_serializer.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageColumnSerializerTest : public BaseTest {};
+
+TEST_F(StorageColumnSerializerTest, RoundTrip) {
+  auto int_column = std::make_shared<ValueColumn<int32_t>>(pmr_vector<int32_t>{4, -6, 3});
+  auto double_column = std::make_shared<ValueColumn<double>>(pmr_vector<double>{1.5, -0.25});
+  auto string_column = std::make_shared<ValueColumn<std::string>>(
+      pmr_vector<std::string>{"", "a", std::string("with\0zero", 9), "a string that does not fit into SSO"});
+  auto empty_column = std::make_shared<ValueColumn<int64_t>>();
+
+  auto stream = std::stringstream{};
+  ColumnSerializer::serialize(stream, *int_column);
+  ColumnSerializer::serialize(stream, *double_column);
+  ColumnSerializer::serialize(stream, *string_column);
+  ColumnSerializer::serialize(stream, *empty_column);
+
+  const auto int_result = std::dynamic_pointer_cast<ValueColumn<int32_t>>(ColumnSerializer::deserialize(stream));
+  ASSERT_TRUE(int_result);
+  EXPECT_EQ(int_result->values(), int_column->values());
+
+  const auto double_result = std::dynamic_pointer_cast<ValueColumn<double>>(ColumnSerializer::deserialize(stream));
+  ASSERT_TRUE(double_result);
+  EXPECT_EQ(double_result->values(), double_column->values());
+
+  const auto string_result =
+      std::dynamic_pointer_cast<ValueColumn<std::string>>(ColumnSerializer::deserialize(stream));
+  ASSERT_TRUE(string_result);
+  EXPECT_EQ(string_result->values(), string_column->values());
+
+  const auto empty_result = std::dynamic_pointer_cast<ValueColumn<int64_t>>(ColumnSerializer::deserialize(stream));
+  ASSERT_TRUE(empty_result);
+  EXPECT_EQ(empty_result->size(), 0u);
+}
+
+TEST_F(StorageColumnSerializerTest, DictionaryColumnRoundTrip) {
+  auto values = pmr_vector<std::string>{};
+  for (auto index = 0; index < 1'000; ++index) {
+    values.push_back("a string that does not fit into SSO " + std::to_string(index % 300));
+  }
+  const auto column = DictionaryColumn<std::string>{values};
+
+  auto stream = std::stringstream{};
+  ColumnSerializer::serialize(stream, column);
+
+  const auto result = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(ColumnSerializer::deserialize(stream));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->dictionary(), column.dictionary());
+  EXPECT_EQ(result->attribute_vector().width(), 2u);
+  EXPECT_EQ(result->decode()->values(), values);
+}
+
+TEST_F(StorageColumnSerializerTest, TruncatedStream) {
+  auto stream = std::stringstream{};
+  ColumnSerializer::serialize(stream, ValueColumn<int32_t>{pmr_vector<int32_t>{1, 2, 3}});
+
+  const auto serialized = stream.str();
+  auto truncated_stream = std::stringstream{serialized.substr(0, serialized.size() - 1)};
+  EXPECT_THROW(ColumnSerializer::deserialize(truncated_stream), std::logic_error);
+
+  auto empty_stream = std::stringstream{};
+  EXPECT_THROW(ColumnSerializer::deserialize(empty_stream), std::logic_error);
+}
+
+}  // namespace opossum
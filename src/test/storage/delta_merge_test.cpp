@@ -0,0 +1,150 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/materialize.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/delta_merge.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageDeltaMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = _create_table({{"a", "int"}, {"b", "string"}}, 10);
+    _expected_table = _create_table({{"a", "int"}, {"b", "string"}}, 10);
+    for (auto index = 0; index < 45; ++index) {
+      _table->append({index % 7, "value " + std::to_string(index % 3)});
+      _expected_table->append({index % 7, "value " + std::to_string(index % 3)});
+    }
+  }
+
+  void TearDown() override { BufferManager::get().set_memory_budget(0); }
+
+  static size_t _dictionary_chunk_count(const Table& table) {
+    auto count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.get_column(ColumnID{0})->encoding_type() == EncodingType::Dictionary) ++count;
+    }
+    return count;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(StorageDeltaMergeTest, EncodeAndCommit) {
+  auto delta_merge = DeltaMerge{*_table, ChunkID{0}};
+  EXPECT_EQ(delta_merge.chunk_count(), 4u);
+  EXPECT_EQ(delta_merge.end(), ChunkID{4});
+  EXPECT_THROW(delta_merge.commit(*_table), std::logic_error);
+
+  delta_merge.encode(2);
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 0u);
+  delta_merge.commit(*_table);
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4}).get_column(ColumnID{1})->encoding_type(), EncodingType::Unencoded);
+  EXPECT_TABLE_EQ(*_table, *_expected_table, true);
+
+  // Merged chunks are not merged again
+  EXPECT_EQ((DeltaMerge{*_table, ChunkID{0}}.chunk_count()), 0u);
+}
+
+TEST_F(StorageDeltaMergeTest, MergeDelta) {
+  EXPECT_EQ(_table->main_chunk_count(), ChunkID{0});
+  _table->merge_delta();
+  EXPECT_EQ(_table->main_chunk_count(), ChunkID{4});
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 4u);
+
+  for (auto index = 45; index < 70; ++index) {
+    const auto row = std::vector<AllTypeVariant>{index % 7, "value " + std::to_string(index % 3)};
+    _table->append(row);
+    _expected_table->append(row);
+  }
+  _table->merge_delta();
+  EXPECT_EQ(_table->main_chunk_count(), ChunkID{7});
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 7u);
+  EXPECT_TABLE_EQ(*_table, *_expected_table, true);
+
+  // Min/max and Bloom filters stay valid, as merging does not change the values
+  const auto& min_max = _table->get_chunk(ChunkID{0}).get_min_max(ColumnID{0});
+  ASSERT_TRUE(min_max.has_value());
+  EXPECT_EQ(min_max->min, AllTypeVariant{0});
+  EXPECT_EQ(min_max->max, AllTypeVariant{6});
+}
+
+TEST_F(StorageDeltaMergeTest, ScanDuringMerge) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  scan->execute();
+
+  // The scan output references the replaced columns as well as the encoded ones
+  _table->merge_delta();
+  auto expected_wrapper = std::make_shared<TableWrapper>(_expected_table);
+  expected_wrapper->execute();
+  auto expected_scan = std::make_shared<TableScan>(expected_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  expected_scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), expected_scan->get_output());
+
+  auto merged_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  merged_scan->execute();
+  EXPECT_TABLE_EQ(merged_scan->get_output(), expected_scan->get_output());
+}
+
+TEST_F(StorageDeltaMergeTest, BackgroundMerge) {
+  _table->enable_delta_merge(ChunkID{2});
+
+  // The first merge starts as soon as the delta holds two sealed chunks and is committed by a later seal
+  for (auto index = 45; index < 200; ++index) {
+    const auto row = std::vector<AllTypeVariant>{index % 7, "value " + std::to_string(index % 3)};
+    _table->append(row);
+    _expected_table->append(row);
+  }
+  // At most the merge in flight and the chunks sealed after it started are not committed yet
+  EXPECT_GE(_table->main_chunk_count(), ChunkID{17});
+  EXPECT_GE(_dictionary_chunk_count(*_table), 17u);
+  EXPECT_TABLE_EQ(*_table, *_expected_table, true);
+
+  _table->merge_delta();
+  EXPECT_EQ(_table->main_chunk_count(), ChunkID{20});
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 20u);
+  EXPECT_TABLE_EQ(*_table, *_expected_table, true);
+
+  EXPECT_THROW(_table->enable_delta_merge(ChunkID{0}), std::logic_error);
+}
+
+TEST_F(StorageDeltaMergeTest, EvictionAfterMerge) {
+  _table->enable_delta_merge(ChunkID{1});
+  _table->enable_eviction();
+  _table->merge_delta();
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{4}; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id).is_evictable());
+  }
+
+  // Evicted DictionaryColumns are loaded again when they are accessed
+  BufferManager::get().set_memory_budget(1);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}).is_resident());
+  EXPECT_EQ(_dictionary_chunk_count(*_table), 4u);
+
+  const auto scan_and_materialize = [](const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "value 1");
+    scan->execute();
+    auto materialize = std::make_shared<Materialize>(scan);
+    materialize->execute();
+    return materialize->get_output();
+  };
+  EXPECT_TABLE_EQ(scan_and_materialize(_table), scan_and_materialize(_expected_table), true);
+}
+
+}  // namespace opossum
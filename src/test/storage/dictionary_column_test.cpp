@@ -0,0 +1,100 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class StorageDictionaryColumnTest : public BaseTest {};
+
+TEST_F(StorageDictionaryColumnTest, EncodeValues) {
+  const auto values = pmr_vector<std::string>{"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"};
+  const auto column = DictionaryColumn<std::string>{values};
+
+  EXPECT_EQ(column.size(), 6u);
+  EXPECT_EQ(column.data_type(), DataType::String);
+  EXPECT_EQ(column.encoding_type(), EncodingType::Dictionary);
+  EXPECT_EQ(column.unique_values_count(), 4u);
+  EXPECT_EQ(column.dictionary(), (pmr_vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(type_cast<std::string>(column[index]), values[index]);
+    EXPECT_EQ(column.compact_value_at(index).get<std::string_view>(), values[index]);
+    EXPECT_EQ(column.value_by_value_id(column.attribute_vector().get(index)), values[index]);
+  }
+
+  EXPECT_THROW(column.value_by_value_id(ValueID{4}), std::exception);
+}
+
+TEST_F(StorageDictionaryColumnTest, Bounds) {
+  const auto column = DictionaryColumn<int32_t>{pmr_vector<int32_t>{0, 2, 4, 6, 8, 10, 2}};
+
+  EXPECT_EQ(column.lower_bound(4), ValueID{2});
+  EXPECT_EQ(column.upper_bound(4), ValueID{3});
+  EXPECT_EQ(column.lower_bound(5), ValueID{3});
+  EXPECT_EQ(column.upper_bound(5), ValueID{3});
+  EXPECT_EQ(column.lower_bound(-1), ValueID{0});
+  EXPECT_EQ(column.lower_bound(15), ValueID{6});
+  EXPECT_EQ(column.upper_bound(10), ValueID{6});
+}
+
+TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorWidth) {
+  EXPECT_EQ(fitted_attribute_vector_width(1), 1u);
+  EXPECT_EQ(fitted_attribute_vector_width(256), 1u);
+  EXPECT_EQ(fitted_attribute_vector_width(257), 2u);
+  EXPECT_EQ(fitted_attribute_vector_width(65'536), 2u);
+  EXPECT_EQ(fitted_attribute_vector_width(65'537), 4u);
+
+  auto values = pmr_vector<int32_t>{};
+  for (auto value = 0; value < 1'000; ++value) {
+    values.push_back(value % 300);
+  }
+  const auto column = DictionaryColumn<int32_t>{values};
+  EXPECT_EQ(column.attribute_vector().width(), 2u);
+  EXPECT_EQ(column.attribute_vector().size(), 1'000u);
+  resolve_attribute_vector(column.attribute_vector(), [&](const auto& attribute_vector) {
+    EXPECT_EQ(sizeof(attribute_vector.value_ids()[0]), 2u);
+    EXPECT_EQ(attribute_vector.value_ids()[999], 99u);
+  });
+}
+
+TEST_F(StorageDictionaryColumnTest, Decode) {
+  const auto values = pmr_vector<double>{1.5, -2.0, 1.5, 3.25};
+  const auto column = std::make_shared<DictionaryColumn<double>>(values);
+  EXPECT_EQ(column->decode()->values(), values);
+
+  const auto decoded = std::dynamic_pointer_cast<const ValueColumn<double>>(decode_dictionary_column(column));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->values(), values);
+
+  // ValueColumns are passed through
+  const auto value_column = std::make_shared<ValueColumn<double>>(pmr_vector<double>{values});
+  EXPECT_EQ(decode_dictionary_column(value_column), value_column);
+}
+
+TEST_F(StorageDictionaryColumnTest, Immutable) {
+  auto column = DictionaryColumn<int32_t>{pmr_vector<int32_t>{1, 2}};
+  EXPECT_THROW(column.append(3), std::logic_error);
+}
+
+TEST_F(StorageDictionaryColumnTest, MemoryUsage) {
+  auto values = pmr_vector<int64_t>{};
+  for (auto value = 0; value < 10'000; ++value) {
+    values.push_back(value % 10);
+  }
+  const auto value_column = ValueColumn<int64_t>{pmr_vector<int64_t>{values}};
+  const auto column = DictionaryColumn<int64_t>{values};
+
+  // One byte per value id instead of eight bytes per value
+  EXPECT_GE(column.estimate_memory_usage(), 10'000u);
+  EXPECT_LT(column.estimate_memory_usage() * 7, value_column.estimate_memory_usage());
+}
+
+}  // namespace opossum
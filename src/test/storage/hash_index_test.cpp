@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/hash_index.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageHashIndexTest : public BaseTest {
+ protected:
+  // returns the positions of the rows holding key in ascending order
+  static PosList _lookup(const BaseHashIndex& hash_index, const AllTypeVariant& key) {
+    auto row_ids = hash_index.lookup(key);
+    std::sort(row_ids.begin(), row_ids.end());
+    return row_ids;
+  }
+
+  // returns the positions of the rows holding key in ascending order, found by looking at every row of the table
+  static PosList _scan(const Table& table, const ColumnID column_id, const AllTypeVariant& key) {
+    auto row_ids = PosList{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto column = table.get_chunk(chunk_id).get_column(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column->size(); ++chunk_offset) {
+        if ((*column)[chunk_offset] == key) row_ids.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+    return row_ids;
+  }
+};
+
+TEST_F(StorageHashIndexTest, InsertAndLookup) {
+  auto hash_index = HashIndex<int32_t>{};
+  hash_index.insert(4, RowID{ChunkID{0}, 0});
+  hash_index.insert(7, RowID{ChunkID{0}, 1});
+  hash_index.insert(4, RowID{ChunkID{1}, 0});
+  hash_index.insert(AllTypeVariant{4}, RowID{ChunkID{1}, 1});
+  hash_index.insert(CompactValue{int64_t{9}}, RowID{ChunkID{1}, 2});
+
+  EXPECT_EQ(hash_index.key_count(), 3u);
+  EXPECT_EQ(hash_index.row_count(), 5u);
+  EXPECT_EQ(_lookup(hash_index, 4), (PosList{{ChunkID{0}, 0}, {ChunkID{1}, 0}, {ChunkID{1}, 1}}));
+  EXPECT_EQ(_lookup(hash_index, 7), (PosList{{ChunkID{0}, 1}}));
+  EXPECT_EQ(_lookup(hash_index, int64_t{9}), (PosList{{ChunkID{1}, 2}}));
+  EXPECT_TRUE(hash_index.lookup(5).empty());
+
+  // Positions are appended to the given list
+  auto row_ids = PosList{{ChunkID{2}, 0}};
+  hash_index.lookup(7, row_ids);
+  EXPECT_EQ(row_ids, (PosList{{ChunkID{2}, 0}, {ChunkID{0}, 1}}));
+}
+
+TEST_F(StorageHashIndexTest, Strings) {
+  auto hash_index = HashIndex<std::string>{};
+  const auto long_string = std::string(100, 'x');
+  hash_index.insert(CompactValue{"Hasso"}, RowID{ChunkID{0}, 0});
+  hash_index.insert(CompactValue::view(long_string), RowID{ChunkID{0}, 1});
+  hash_index.insert(std::string{"Hasso"}, RowID{ChunkID{0}, 2});
+  hash_index.insert(CompactValue{17}, RowID{ChunkID{0}, 3});
+
+  EXPECT_EQ(hash_index.key_count(), 3u);
+  EXPECT_EQ(_lookup(hash_index, "Hasso"), (PosList{{ChunkID{0}, 0}, {ChunkID{0}, 2}}));
+  EXPECT_EQ(_lookup(hash_index, long_string), (PosList{{ChunkID{0}, 1}}));
+  EXPECT_EQ(_lookup(hash_index, "17"), (PosList{{ChunkID{0}, 3}}));
+  EXPECT_TRUE(hash_index.lookup("Hass").empty());
+  EXPECT_GT(hash_index.estimate_memory_usage(), long_string.size());
+}
+
+TEST_F(StorageHashIndexTest, FloatingPointZero) {
+  auto hash_index = HashIndex<double>{};
+  hash_index.insert(0.0, RowID{ChunkID{0}, 0});
+  hash_index.insert(-0.0, RowID{ChunkID{0}, 1});
+  EXPECT_EQ(hash_index.key_count(), 1u);
+  EXPECT_EQ(hash_index.lookup(-0.0).size(), 2u);
+}
+
+TEST_F(StorageHashIndexTest, ManyKeys) {
+  // The index grows several times and every key has two rows
+  auto hash_index = HashIndex<int64_t>{};
+  for (auto key = int64_t{0}; key < 10'000; ++key) {
+    hash_index.insert(key * 3, RowID{ChunkID{0}, static_cast<ChunkOffset>(key)});
+  }
+  for (auto key = int64_t{0}; key < 10'000; ++key) {
+    hash_index.insert(key * 3, RowID{ChunkID{1}, static_cast<ChunkOffset>(key)});
+  }
+  EXPECT_EQ(hash_index.key_count(), 10'000u);
+  EXPECT_EQ(hash_index.row_count(), 20'000u);
+
+  for (auto key = int64_t{0}; key < 30'000; ++key) {
+    const auto row_ids = _lookup(hash_index, key);
+    if (key % 3 != 0) {
+      EXPECT_TRUE(row_ids.empty());
+      continue;
+    }
+    const auto chunk_offset = static_cast<ChunkOffset>(key / 3);
+    EXPECT_EQ(row_ids, (PosList{{ChunkID{0}, chunk_offset}, {ChunkID{1}, chunk_offset}}));
+  }
+}
+
+TEST_F(StorageHashIndexTest, BatchedLookup) {
+  auto hash_index = HashIndex<int32_t>{};
+  for (auto key = 0; key < 100; ++key) {
+    hash_index.insert(key % 40, RowID{ChunkID{0}, static_cast<ChunkOffset>(key)});
+  }
+
+  auto keys = std::vector<int32_t>{};
+  for (auto key = -5; key < 45; ++key) {
+    keys.push_back(key);
+  }
+  auto row_ids = PosList{};
+  auto row_id_ends = std::vector<size_t>{};
+  hash_index.lookup(keys, row_ids, row_id_ends);
+
+  ASSERT_EQ(row_id_ends.size(), keys.size());
+  EXPECT_EQ(row_id_ends.back(), 100u);
+  for (auto index = size_t{0}; index < keys.size(); ++index) {
+    const auto begin = index == 0 ? size_t{0} : row_id_ends[index - 1];
+    auto key_row_ids = PosList(row_ids.cbegin() + begin, row_ids.cbegin() + row_id_ends[index]);
+    std::sort(key_row_ids.begin(), key_row_ids.end());
+    EXPECT_EQ(key_row_ids, _lookup(hash_index, keys[index]));
+  }
+}
+
+TEST_F(StorageHashIndexTest, IndexColumn) {
+  const auto value_column = ValueColumn<int32_t>{pmr_vector<int32_t>{3, 1, 3}};
+  const auto dictionary_column = DictionaryColumn<int32_t>{pmr_vector<int32_t>{1, 2, 1}};
+  auto hash_index = HashIndex<int32_t>{};
+  hash_index.insert(value_column, ChunkID{0});
+  hash_index.insert(dictionary_column, ChunkID{1});
+
+  EXPECT_EQ(_lookup(hash_index, 1), (PosList{{ChunkID{0}, 1}, {ChunkID{1}, 0}, {ChunkID{1}, 2}}));
+  EXPECT_EQ(_lookup(hash_index, 2), (PosList{{ChunkID{1}, 1}}));
+  EXPECT_EQ(_lookup(hash_index, 3), (PosList{{ChunkID{0}, 0}, {ChunkID{0}, 2}}));
+}
+
+TEST_F(StorageHashIndexTest, TableMaintainsIndex) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto index = 0; index < 10; ++index) {
+    table.append({index % 3, "value " + std::to_string(index)});
+  }
+  EXPECT_EQ(table.get_hash_index(ColumnID{0}), nullptr);
+  EXPECT_THROW(table.enable_hash_index(ColumnID{2}), std::logic_error);
+
+  // The index covers the rows that exist already as well as rows and chunks that are added later
+  table.enable_hash_index(ColumnID{0});
+  table.enable_hash_index(ColumnID{1});
+  for (auto index = 10; index < 20; ++index) {
+    table.append_compact({CompactValue{index % 3}, CompactValue{"value " + std::to_string(index)}});
+  }
+  auto chunk = Chunk{};
+  chunk.add_column(std::make_shared<ValueColumn<int32_t>>(pmr_vector<int32_t>{2, 5}));
+  chunk.add_column(std::make_shared<ValueColumn<std::string>>(pmr_vector<std::string>{"value 20", "value 21"}));
+  table.emplace_chunk(std::move(chunk));
+  table.append({1, "value 22"});
+
+  const auto hash_index = table.get_hash_index(ColumnID{0});
+  ASSERT_TRUE(hash_index);
+  EXPECT_EQ(hash_index->row_count(), table.row_count());
+  for (auto key = 0; key < 6; ++key) {
+    EXPECT_EQ(_lookup(*hash_index, key), _scan(table, ColumnID{0}, key));
+  }
+  EXPECT_EQ(_lookup(*table.get_hash_index(ColumnID{1}), "value 21"), (PosList{{ChunkID{5}, 1}}));
+
+  // Merging the delta keeps the positions
+  table.merge_delta();
+  for (auto key = 0; key < 6; ++key) {
+    EXPECT_EQ(_lookup(*hash_index, key), _scan(table, ColumnID{0}, key));
+  }
+}
+
+TEST_F(StorageHashIndexTest, ClusteredTable) {
+  // Sorting a chunk when it is sealed moves its rows, which the index follows
+  auto table = Table{8};
+  table.add_column("a", "int");
+  table.add_column("b", "long");
+  table.enable_clustering({ColumnID{1}});
+  table.enable_hash_index(ColumnID{0});
+  for (auto index = 0; index < 30; ++index) {
+    table.append({(index * 7) % 5, int64_t{(index * 11) % 13}});
+  }
+
+  const auto hash_index = table.get_hash_index(ColumnID{0});
+  for (auto key = 0; key < 5; ++key) {
+    EXPECT_EQ(_lookup(*hash_index, key), _scan(table, ColumnID{0}, key));
+  }
+}
+
+}  // namespace opossum
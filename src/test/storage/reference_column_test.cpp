@@ -0,0 +1,61 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/performance_warning.hpp"
+
+namespace opossum {
+
+class StorageReferenceColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+
+    _pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, 0}, {ChunkID{0}, 0}, {ChunkID{0}, 0}});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<PosList> _pos_list;
+};
+
+TEST_F(StorageReferenceColumnTest, RetrievesValues) {
+  PerformanceWarningDisabler performance_warning_disabler;
+  const auto column = ReferenceColumn{_table, ColumnID{1}, _pos_list};
+
+  EXPECT_EQ(column.size(), 3u);
+  EXPECT_EQ(column.data_type(), DataType::String);
+  EXPECT_EQ(column.encoding_type(), EncodingType::Reference);
+  EXPECT_EQ(column[0], AllTypeVariant{"three"});
+  EXPECT_EQ(column[2], AllTypeVariant{"one"});
+  EXPECT_EQ(column.compact_value_at(1), CompactValue{"one"});
+
+  EXPECT_EQ(column.referenced_table(), _table);
+  EXPECT_EQ(column.referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(column.pos_list(), _pos_list);
+}
+
+TEST_F(StorageReferenceColumnTest, IsImmutable) {
+  auto column = ReferenceColumn{_table, ColumnID{0}, _pos_list};
+  EXPECT_THROW(column.append(4), std::exception);
+  EXPECT_THROW(column.append(CompactValue{int32_t{4}}), std::exception);
+}
+
+TEST_F(StorageReferenceColumnTest, InvalidColumn) {
+  EXPECT_THROW(ReferenceColumn(_table, ColumnID{2}, _pos_list), std::exception);
+}
+
+TEST_F(StorageReferenceColumnTest, MemoryUsage) {
+  const auto column = ReferenceColumn{_table, ColumnID{0}, _pos_list};
+  EXPECT_GE(column.estimate_memory_usage(), sizeof(ReferenceColumn) + 3 * sizeof(RowID));
+}
+
+}  // namespace opossum
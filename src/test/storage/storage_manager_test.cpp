@@ -1,4 +1,6 @@
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -50,4 +52,37 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, MemoryUsage) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("col_1", "int");
+  table->add_column("col_2", "string");
+  for (auto i = 0; i < 10; ++i) {
+    table->append({i, std::string(100, 'x')});
+  }
+
+  const auto report = sm.memory_usage();
+  ASSERT_EQ(report.size(), 2u);
+
+  const auto& table_usage = report[1];
+  EXPECT_EQ(table_usage.name, "second_table");
+  EXPECT_EQ(table_usage.row_count, 10u);
+  EXPECT_EQ(table_usage.chunk_count, 3u);
+  EXPECT_EQ(table_usage.bytes, table->estimate_memory_usage());
+
+  ASSERT_EQ(table_usage.columns.size(), 2u);
+  EXPECT_EQ(table_usage.columns[1].name, "col_2");
+  EXPECT_EQ(table_usage.columns[1].type, "string");
+  EXPECT_EQ(table_usage.columns[1].bytes_by_encoding.size(), 1u);
+  EXPECT_GE(table_usage.columns[1].bytes(), 10u * 100u);
+  EXPECT_GT(table_usage.bytes, table_usage.columns[0].bytes() + table_usage.columns[1].bytes());
+
+  EXPECT_EQ(sm.estimate_memory_usage(), report[0].bytes + report[1].bytes);
+
+  std::stringstream out;
+  sm.print_memory_usage(out);
+  EXPECT_NE(out.str().find("second_table\t10\t3"), std::string::npos);
+  EXPECT_NE(out.str().find("\tcol_2\tstring\tUnencoded\t"), std::string::npos);
+}
+
 }  // namespace opossum
@@ -8,7 +8,10 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/bloom_filter.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
 
 namespace opossum {
 
@@ -64,6 +67,20 @@ TEST_F(StorageTableTest, GetColumnType) {
   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
 }
 
+TEST_F(StorageTableTest, GetColumnDataType) {
+  EXPECT_EQ(t.column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(t.column_data_type(ColumnID{1}), DataType::String);
+}
+
+TEST_F(StorageTableTest, AddColumnWithDataType) {
+  t.add_column("col_3", DataType::Double);
+  EXPECT_EQ(t.column_type(ColumnID{2}), "double");
+  EXPECT_EQ(t.column_data_type(ColumnID{2}), DataType::Double);
+
+  t.append({4, "Hello,", 1.5});
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_column(ColumnID{2})->data_type(), DataType::Double);
+}
+
 TEST_F(StorageTableTest, GetColumnIdByName) {
   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
@@ -71,10 +88,124 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, AppendCompact) {
+  t.append_compact({CompactValue{int32_t{4}}, CompactValue{"Hello,"}});
+  t.append_compact({CompactValue{int32_t{6}}, CompactValue{"world"}});
+  t.append_compact({CompactValue{int32_t{3}}, CompactValue{"!"}});
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ(t.chunk_count(), 2u);
+
+  auto expected = Table{};
+  expected.add_column("col_1", "int");
+  expected.add_column("col_2", "string");
+  expected.append({6, "world"});
+  expected.append({4, "Hello,"});
+  expected.append({3, "!"});
+  EXPECT_TABLE_EQ(t, expected);
+}
+
+TEST_F(StorageTableTest, SealChunks) {
+  t.append({4, "Hello,"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).is_sealed());
+  t.append({6, "world"});
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).is_sealed());
+  EXPECT_EQ(t.chunk_count(), 1u);
+
+  t.append({3, "!"});
+  t.seal_last_chunk();
+  EXPECT_TRUE(t.get_chunk(ChunkID{1}).is_sealed());
+  t.append({5, "?"});
+  EXPECT_EQ(t.chunk_count(), 3u);
+}
+
+TEST_F(StorageTableTest, BloomFilters) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  // Built for sealed chunks right away and for other chunks when they are sealed
+  t.enable_bloom_filter(ColumnID{0}, 0.05);
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).get_bloom_filter(ColumnID{1}));
+  const auto bloom_filter = t.get_chunk(ChunkID{0}).get_bloom_filter(ColumnID{0});
+  ASSERT_TRUE(bloom_filter);
+  EXPECT_TRUE(bloom_filter->contains(4));
+  EXPECT_TRUE(bloom_filter->contains(6));
+
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).get_bloom_filter(ColumnID{0}));
+  t.append({5, "?"});
+  EXPECT_TRUE(t.get_chunk(ChunkID{1}).get_bloom_filter(ColumnID{0}));
+
+  EXPECT_THROW(t.enable_bloom_filter(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, Clustering) {
+  t.append({4, "Hello,"});
+  t.append({3, "world"});
+  t.enable_clustering({ColumnID{1}});
+
+  // Only chunks that are sealed afterwards are sorted
+  t.append({6, "b"});
+  t.append({5, "a"});
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).sorted_by().empty());
+  EXPECT_TRUE(t.get_chunk(ChunkID{1}).is_sorted_by(ColumnID{1}));
+
+  auto expected = Table{2};
+  expected.add_column("col_1", "int");
+  expected.add_column("col_2", "string");
+  expected.append({4, "Hello,"});
+  expected.append({3, "world"});
+  expected.append({5, "a"});
+  expected.append({6, "b"});
+  EXPECT_TABLE_EQ(t, expected, true);
+
+  EXPECT_THROW(t.enable_clustering({ColumnID{2}}), std::exception);
+  EXPECT_THROW(t.enable_clustering({}), std::exception);
+}
+
+TEST_F(StorageTableTest, EmplaceChunk) {
+  auto chunk = Chunk{};
+  chunk.add_column(std::make_shared<ValueColumn<int32_t>>(pmr_vector<int32_t>{1, 2, 3}));
+  chunk.add_column(std::make_shared<ValueColumn<std::string>>(pmr_vector<std::string>{"a", "b", "c"}));
+
+  // The empty first chunk is replaced
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 3u);
+
+  auto another_chunk = Chunk{};
+  another_chunk.add_column(std::make_shared<ValueColumn<int32_t>>(pmr_vector<int32_t>{4}));
+  another_chunk.add_column(std::make_shared<ValueColumn<std::string>>(pmr_vector<std::string>{"d"}));
+  t.emplace_chunk(std::move(another_chunk));
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).is_sealed());
+
+  EXPECT_THROW(t.emplace_chunk(Chunk{}), std::exception);
+}
+
+TEST_F(StorageTableTest, MemoryUsage) {
+  const auto empty_usage = t.estimate_memory_usage();
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_GT(t.estimate_memory_usage(), empty_usage + t.get_chunk(ChunkID{1}).estimate_memory_usage() - sizeof(Chunk));
+}
+
 TEST_F(StorageTableTest, AddColumnsToNonEmptyTable) {
   EXPECT_NO_THROW(t.add_column("foo1", "int"));
   t.append({4, "Hello,", 27});
   EXPECT_THROW(t.add_column("foo2", "int"), std::exception);
 }
 
+TEST_F(StorageTableTest, MoveConstruct) {
+  t.enable_statistics();
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  auto moved = Table{std::move(t)};
+  EXPECT_EQ(moved.row_count(), 3u);
+  EXPECT_EQ(moved.table_statistics()->row_count(), 3u);
+  EXPECT_EQ(moved.table_statistics(), moved.table_statistics());
+}
+
 }  // namespace opossum
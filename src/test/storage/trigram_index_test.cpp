@@ -0,0 +1,91 @@
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/trigram_index.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/utils/like_matcher.hpp"
+
+namespace opossum {
+
+class StorageTrigramIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _values = pmr_vector<std::string>{"GET /index.html 200", "GET /images/logo.png 404", "POST /login 200",
+                                      "GET /index.html 304",  "", "ab", "x", "GET /login 500"};
+  }
+
+  // returns the offsets of the values that match the pattern
+  std::vector<ChunkOffset> _matching_offsets(const std::string& pattern) const {
+    const auto like_matcher = LikeMatcher{pattern};
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _values.size(); ++chunk_offset) {
+      if (like_matcher.matches(_values[chunk_offset])) chunk_offsets.push_back(chunk_offset);
+    }
+    return chunk_offsets;
+  }
+
+  // returns the candidates of the index that match the pattern, where all rows are candidates if the index has none
+  std::vector<ChunkOffset> _matching_candidates(const TrigramIndex& trigram_index, const std::string& pattern) const {
+    auto candidates = trigram_index.candidates(pattern);
+    if (!candidates) {
+      candidates.emplace(_values.size());
+      std::iota(candidates->begin(), candidates->end(), ChunkOffset{0});
+    }
+
+    const auto like_matcher = LikeMatcher{pattern};
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (const auto chunk_offset : *candidates) {
+      if (like_matcher.matches(_values[chunk_offset])) chunk_offsets.push_back(chunk_offset);
+    }
+    return chunk_offsets;
+  }
+
+  pmr_vector<std::string> _values;
+};
+
+TEST_F(StorageTrigramIndexTest, Candidates) {
+  const auto trigram_index = TrigramIndex::build(ValueColumn<std::string>{pmr_vector<std::string>{_values}});
+
+  // Infixes, prefixes, and suffixes narrow the candidates down to the rows containing them
+  EXPECT_EQ(trigram_index->candidates("%login%"), (std::vector<ChunkOffset>{2, 7}));
+  EXPECT_EQ(trigram_index->candidates("GET%"), (std::vector<ChunkOffset>{0, 1, 3, 7}));
+  EXPECT_EQ(trigram_index->candidates("%200"), (std::vector<ChunkOffset>{0, 2}));
+  EXPECT_EQ(trigram_index->candidates("%index.html%200"), (std::vector<ChunkOffset>{0}));
+  EXPECT_EQ(trigram_index->candidates("ab"), (std::vector<ChunkOffset>{5}));
+  EXPECT_EQ(trigram_index->candidates("x"), (std::vector<ChunkOffset>{6}));
+
+  // A part that is not anchored at the end does not require the marker, so "200" is not excluded
+  EXPECT_EQ(trigram_index->candidates("%200%"), (std::vector<ChunkOffset>{0, 2}));
+
+  // Trigrams that no value contains rule out all rows
+  EXPECT_EQ(trigram_index->candidates("%logout%"), std::vector<ChunkOffset>{});
+  EXPECT_EQ(trigram_index->candidates("%gin"), std::vector<ChunkOffset>{});
+
+  // Patterns without trigrams cannot narrow the candidates
+  EXPECT_FALSE(trigram_index->candidates("%"));
+  EXPECT_FALSE(trigram_index->candidates("%ab%"));
+  EXPECT_FALSE(trigram_index->candidates("a_c"));
+}
+
+TEST_F(StorageTrigramIndexTest, CandidatesIncludeAllMatches) {
+  const auto value_index = TrigramIndex::build(ValueColumn<std::string>{pmr_vector<std::string>{_values}});
+  const auto dictionary_index = TrigramIndex::build(DictionaryColumn<std::string>{_values});
+  EXPECT_EQ(value_index->trigram_count(), dictionary_index->trigram_count());
+
+  for (const auto& pattern : {"GET /index%", "%.html%", "%/lo_in%", "P%_00", "%0_", "GET % 200", "%4", "ab", "x"}) {
+    EXPECT_EQ(_matching_candidates(*value_index, pattern), _matching_offsets(pattern)) << pattern;
+    EXPECT_EQ(_matching_candidates(*dictionary_index, pattern), _matching_offsets(pattern)) << pattern;
+  }
+}
+
+TEST_F(StorageTrigramIndexTest, NonStringColumn) {
+  EXPECT_THROW(TrigramIndex::build(ValueColumn<int32_t>{}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
 #include <limits>
 #include <string>
 #include <vector>
@@ -9,6 +12,24 @@
 
 namespace opossum {
 
+// Counts the allocations that are passed on to the default resource
+class CountingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  size_t allocation_count = 0;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocation_count;
+    return boost::container::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+    boost::container::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const memory_resource& other) const noexcept override { return &other == this; }
+};
+
 class StorageValueColumnTest : public BaseTest {
  protected:
   ValueColumn<int> vc_int;
@@ -47,4 +68,53 @@ TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
   EXPECT_THROW(vc_double.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueColumnTest, CompactValues) {
+  vc_int.append(CompactValue{int32_t{3}});
+  vc_int.append(CompactValue{4.5});
+  EXPECT_EQ(vc_int.compact_value_at(0), CompactValue{int32_t{3}});
+  EXPECT_EQ(vc_int.compact_value_at(1), CompactValue{int32_t{4}});
+  EXPECT_THROW(vc_int.append(CompactValue{"Hi"}), std::exception);
+
+  vc_str.append(CompactValue{std::string(20, 'a')});
+  vc_str.append(CompactValue{int32_t{5}});
+  EXPECT_TRUE(vc_str.compact_value_at(0).is_view());
+  EXPECT_EQ(vc_str.compact_value_at(0), CompactValue{std::string(20, 'a')});
+  EXPECT_EQ(vc_str.compact_value_at(1), CompactValue{"5"});
+}
+
+TEST_F(StorageValueColumnTest, UsesAllocator) {
+  auto resource = CountingMemoryResource{};
+  auto column = ValueColumn<int64_t>{&resource};
+  column.append(int64_t{1});
+  column.append(int64_t{2});
+  column.append(int64_t{3});
+  EXPECT_GT(resource.allocation_count, 1u);
+}
+
+TEST_F(StorageValueColumnTest, PresizedColumnAllocatesOnce) {
+  auto resource = CountingMemoryResource{};
+  auto column = ValueColumn<int64_t>{&resource, 100};
+  EXPECT_EQ(resource.allocation_count, 1u);
+
+  for (auto value = int64_t{0}; value < 100; ++value) {
+    column.append(value);
+  }
+  EXPECT_EQ(column.size(), 100u);
+  EXPECT_EQ(resource.allocation_count, 1u);
+}
+
+TEST_F(StorageValueColumnTest, MemoryUsage) {
+  const auto empty_int_usage = vc_int.estimate_memory_usage();
+  EXPECT_GE(empty_int_usage, sizeof(ValueColumn<int>));
+
+  vc_int.append(3);
+  EXPECT_GE(vc_int.estimate_memory_usage(), empty_int_usage + sizeof(int));
+
+  // Short strings are stored inline, long strings add their heap-allocated payload
+  vc_str.append("Hello");
+  const auto short_string_usage = vc_str.estimate_memory_usage();
+  vc_str.append(std::string(1000, 'x'));
+  EXPECT_GE(vc_str.estimate_memory_usage(), short_string_usage + 1000);
+}
+
 }  // namespace opossum
@@ -0,0 +1,221 @@
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/write_ahead_log.hpp"
+
+namespace opossum {
+
+class StorageWriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _path = _temp_path("hyrise_wal_test");
+    std::remove(_path.c_str());
+  }
+
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  // Simulates a crash by forgetting all tables, which are then recovered from the log
+  void _recover(const uint64_t expected_record_count) {
+    StorageManager::reset();
+    WriteAheadLog log{_path};
+    EXPECT_EQ(log.recovered_record_count(), expected_record_count);
+  }
+
+  // the columns of the tables in the tests
+  const std::vector<std::pair<std::string, std::string>> _columns{{"a", "int"}, {"b", "string"}, {"c", "double"}};
+
+  std::string _path;
+};
+
+TEST_F(StorageWriteAheadLogTest, RecoversTablesAndRows) {
+  auto expected_table = _create_table(_columns, 3);
+  {
+    WriteAheadLog log{_path};
+    EXPECT_EQ(log.recovered_record_count(), 0u);
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.5}, {2, "two", 2.5}});
+    log.append("t", {{3, "a longer string that does not fit into SSO", -3.0}, {4, "", 0.0}});
+    log.add_table("dropped", _create_table(_columns, 3));
+    log.drop_table("dropped");
+    EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 4u);
+  }
+  expected_table->append({1, "one", 1.5});
+  expected_table->append({2, "two", 2.5});
+  expected_table->append({3, "a longer string that does not fit into SSO", -3.0});
+  expected_table->append({4, "", 0.0});
+
+  _recover(5);
+  ASSERT_TRUE(StorageManager::get().has_table("t"));
+  EXPECT_FALSE(StorageManager::get().has_table("dropped"));
+  const auto table = StorageManager::get().get_table("t");
+  EXPECT_EQ(table->chunk_size(), 3u);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(StorageWriteAheadLogTest, ContinuesRecoveredLog) {
+  {
+    WriteAheadLog log{_path};
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.0}});
+  }
+  StorageManager::reset();
+  {
+    WriteAheadLog log{_path};
+    log.append("t", {{2, "two", 2.0}});
+  }
+
+  _recover(3);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 2u);
+}
+
+TEST_F(StorageWriteAheadLogTest, ConcurrentAppendersShareFlushes) {
+  constexpr auto thread_count = 8;
+  constexpr auto appends_per_thread = 50;
+
+  {
+    WriteAheadLog log{_path};
+    log.add_table("t", _create_table(_columns, 3));
+
+    const auto flushes_before = _counter_value("WriteAheadLog flush");
+    auto threads = std::vector<std::thread>{};
+    for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+      threads.emplace_back([&, thread_index]() {
+        for (auto append_index = 0; append_index < appends_per_thread; ++append_index) {
+          log.append("t", {{thread_index, std::to_string(append_index), 0.0}});
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    // Each append waits for its flush, so without group commit, there would be one flush per append
+    const auto flushes = _counter_value("WriteAheadLog flush") - flushes_before;
+    EXPECT_GT(flushes, 0u);
+    EXPECT_LE(flushes, static_cast<uint64_t>(thread_count * appends_per_thread));
+  }
+
+  _recover(1 + thread_count * appends_per_thread);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(),
+            static_cast<uint64_t>(thread_count * appends_per_thread));
+}
+
+TEST_F(StorageWriteAheadLogTest, IgnoresAndTruncatesTornRecord) {
+  {
+    WriteAheadLog log{_path};
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.0}});
+    log.append("t", {{2, "two", 2.0}});
+  }
+
+  // Cuts the last record in half, as a crash during the write could
+  auto stream = std::ifstream{_path, std::ios::binary | std::ios::ate};
+  const auto size = static_cast<off_t>(stream.tellg());
+  stream.close();
+  ASSERT_EQ(truncate(_path.c_str(), size - 5), 0);
+
+  _recover(2);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 1u);
+
+  // New records follow the last complete record and are recovered as well
+  {
+    StorageManager::reset();
+    WriteAheadLog log{_path};
+    log.append("t", {{3, "three", 3.0}});
+  }
+  _recover(3);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 2u);
+}
+
+TEST_F(StorageWriteAheadLogTest, IgnoresCorruptRecord) {
+  {
+    WriteAheadLog log{_path};
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.0}});
+  }
+
+  // Flips a byte in the string of the last record, which the checksum detects
+  auto stream = std::fstream{_path, std::ios::binary | std::ios::in | std::ios::out};
+  stream.seekg(-(static_cast<std::streamoff>(sizeof(double)) + 1), std::ios::end);
+  stream.put('x');
+  stream.close();
+
+  _recover(1);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 0u);
+}
+
+TEST_F(StorageWriteAheadLogTest, FailsAfterWriteError) {
+  {
+    WriteAheadLog log{_path};
+    log.add_table("t", _create_table(_columns, 3));
+    log.append("t", {{1, "one", 1.0}});
+
+    // Limits the size of the files that the process writes to a few bytes more than the log, so that the next record
+    // is torn and writing it fails with EFBIG
+    auto stream = std::ifstream{_path, std::ios::binary | std::ios::ate};
+    const auto size = static_cast<rlim_t>(stream.tellg());
+    stream.close();
+    auto original_limit = rlimit{};
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &original_limit), 0);
+    auto limit = original_limit;
+    limit.rlim_cur = size + 10;
+    const auto original_handler = std::signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+    EXPECT_THROW(log.append("t", {{2, "two", 2.0}}), std::logic_error);
+    setrlimit(RLIMIT_FSIZE, &original_limit);
+    std::signal(SIGXFSZ, original_handler);
+
+    // Records after the torn one would be lost by recovery, so the log fails all changes, even if writing would work
+    EXPECT_THROW(log.append("t", {{3, "three", 3.0}}), std::logic_error);
+    EXPECT_THROW(log.add_table("u", _create_table(_columns, 3)), std::logic_error);
+    EXPECT_FALSE(StorageManager::get().has_table("u"));
+  }
+
+  _recover(2);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 1u);
+
+  // The torn record is truncated when the log is opened again, so that it can be continued
+  {
+    StorageManager::reset();
+    WriteAheadLog log{_path};
+    log.append("t", {{4, "four", 4.0}});
+  }
+  _recover(3);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 2u);
+}
+
+TEST_F(StorageWriteAheadLogTest, RejectsInvalidRows) {
+  {
+    WriteAheadLog log{_path};
+    EXPECT_THROW(log.append("t", {{1, "one", 1.0}}), std::exception);
+    auto non_empty_table = _create_table(_columns, 3);
+    non_empty_table->append({1, "one", 1.0});
+    EXPECT_THROW(log.add_table("t", non_empty_table), std::exception);
+
+    log.add_table("t", _create_table(_columns, 3));
+    EXPECT_THROW(log.add_table("t", _create_table(_columns, 3)), std::exception);
+    EXPECT_THROW(log.append("t", {{1, "one"}}), std::exception);
+    EXPECT_THROW(log.append("t", {{2, "two", 2.0}, {"not a number", "three", 3.0}}), std::exception);
+    EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 0u);
+  }
+
+  _recover(1);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 0u);
+}
+
+}  // namespace opossum
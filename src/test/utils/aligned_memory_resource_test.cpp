@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/utils/aligned_memory_resource.hpp"
+
+namespace opossum {
+
+class UtilsAlignedMemoryResourceTest : public BaseTest {
+ protected:
+  static bool is_aligned(const void* pointer, const size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+  }
+};
+
+TEST_F(UtilsAlignedMemoryResourceTest, AlignsToCacheLines) {
+  auto& resource = AlignedMemoryResource::cache_line_aligned_resource();
+  EXPECT_EQ(resource.alignment(), CACHE_LINE_SIZE);
+  EXPECT_FALSE(resource.uses_huge_pages());
+
+  for (const auto bytes : {size_t{1}, size_t{3}, size_t{100}, size_t{4096}}) {
+    auto pointer = resource.allocate(bytes, 1);
+    EXPECT_TRUE(is_aligned(pointer, CACHE_LINE_SIZE));
+    resource.deallocate(pointer, bytes, 1);
+  }
+
+  // Stricter alignments requested by the caller are respected
+  auto pointer = resource.allocate(10, 4096);
+  EXPECT_TRUE(is_aligned(pointer, 4096));
+  resource.deallocate(pointer, 10, 4096);
+}
+
+TEST_F(UtilsAlignedMemoryResourceTest, AlignsLargeAllocationsToHugePages) {
+  auto& resource = AlignedMemoryResource::huge_page_resource();
+  EXPECT_TRUE(resource.uses_huge_pages());
+
+  auto small_pointer = resource.allocate(100);
+  EXPECT_TRUE(is_aligned(small_pointer, CACHE_LINE_SIZE));
+  resource.deallocate(small_pointer, 100);
+
+  const auto large_size = AlignedMemoryResource::HUGE_PAGE_SIZE + 1;
+  auto large_pointer = resource.allocate(large_size);
+  EXPECT_TRUE(is_aligned(large_pointer, AlignedMemoryResource::HUGE_PAGE_SIZE));
+  resource.deallocate(large_pointer, large_size);
+
+  EXPECT_TRUE(resource.is_equal(AlignedMemoryResource::cache_line_aligned_resource()));
+}
+
+TEST_F(UtilsAlignedMemoryResourceTest, InvalidAlignment) {
+  EXPECT_THROW(AlignedMemoryResource{3}, std::logic_error);
+  EXPECT_THROW(AlignedMemoryResource{2}, std::logic_error);
+}
+
+TEST_F(UtilsAlignedMemoryResourceTest, UsedByTable) {
+  auto table = Table{4, &AlignedMemoryResource::cache_line_aligned_resource()};
+  table.add_column("a", "double");
+  table.append({1.0});
+
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.get_allocator().resource(), &AlignedMemoryResource::cache_line_aligned_resource());
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class UtilsHardwareCountersTest : public BaseTest {};
+
+TEST_F(UtilsHardwareCountersTest, MeasuresAvailableEvents) {
+  HardwareCounters hardware_counters;
+  hardware_counters.start();
+  auto sum = uint64_t{0};
+  for (auto index = uint64_t{0}; index < 100'000; ++index) {
+    sum += index;
+  }
+  EXPECT_EQ(sum, uint64_t{4'999'950'000});
+  const auto values = hardware_counters.stop();
+
+  // Access to the counters might be denied by the kernel, in which case no values are reported
+  if (!hardware_counters.available()) {
+    for (const auto& value : values.values) {
+      EXPECT_FALSE(value);
+    }
+    return;
+  }
+
+  if (values[HardwareEvent::Instructions]) {
+    EXPECT_GT(*values[HardwareEvent::Instructions], 100'000u);
+  }
+}
+
+TEST_F(UtilsHardwareCountersTest, IncludesJoinedThreads) {
+  HardwareCounters hardware_counters;
+  hardware_counters.start();
+  auto sum = uint64_t{0};
+  auto thread = std::thread{[&]() {
+    for (auto index = uint64_t{0}; index < 10'000'000; ++index) {
+      sum += index;
+    }
+  }};
+  thread.join();
+  EXPECT_EQ(sum, uint64_t{49'999'995'000'000});
+  const auto values = hardware_counters.stop();
+
+  if (values[HardwareEvent::Instructions]) {
+    EXPECT_GT(*values[HardwareEvent::Instructions], 10'000'000u);
+  }
+}
+
+TEST_F(UtilsHardwareCountersTest, ProfilingScope) {
+  EXPECT_FALSE(HardwareCounterProfiling::is_enabled());
+  {
+    HardwareCounterProfiling outer;
+    {
+      HardwareCounterProfiling inner;
+      EXPECT_TRUE(HardwareCounterProfiling::is_enabled());
+    }
+    EXPECT_TRUE(HardwareCounterProfiling::is_enabled());
+  }
+  EXPECT_FALSE(HardwareCounterProfiling::is_enabled());
+}
+
+TEST_F(UtilsHardwareCountersTest, EventToString) {
+  EXPECT_EQ(hardware_event_to_string(HardwareEvent::LLCMisses), "LLC misses");
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/like_matcher.hpp"
+
+namespace opossum {
+
+class UtilsLikeMatcherTest : public BaseTest {
+ protected:
+  static bool _matches(const std::string& pattern, const std::string& value) {
+    return LikeMatcher{pattern}.matches(value);
+  }
+
+  // matches the pattern by trying every way to expand its '%' wildcards
+  static bool _reference_matches(const std::string_view pattern, const std::string_view value) {
+    if (pattern.empty()) return value.empty();
+    if (pattern[0] == LikeMatcher::ANY_CHARS) {
+      for (auto skipped = size_t{0}; skipped <= value.size(); ++skipped) {
+        if (_reference_matches(pattern.substr(1), value.substr(skipped))) return true;
+      }
+      return false;
+    }
+    if (value.empty() || (pattern[0] != LikeMatcher::ANY_CHAR && pattern[0] != value[0])) return false;
+    return _reference_matches(pattern.substr(1), value.substr(1));
+  }
+};
+
+TEST_F(UtilsLikeMatcherTest, Literal) {
+  EXPECT_TRUE(_matches("abc", "abc"));
+  EXPECT_FALSE(_matches("abc", "abcd"));
+  EXPECT_FALSE(_matches("abc", "ab"));
+  EXPECT_FALSE(_matches("abc", "ABC"));
+  EXPECT_TRUE(_matches("", ""));
+  EXPECT_FALSE(_matches("", "a"));
+}
+
+TEST_F(UtilsLikeMatcherTest, AnyChars) {
+  EXPECT_TRUE(_matches("%", ""));
+  EXPECT_TRUE(_matches("%", "anything"));
+  EXPECT_TRUE(_matches("ab%", "ab"));
+  EXPECT_TRUE(_matches("ab%", "abc"));
+  EXPECT_FALSE(_matches("ab%", "cab"));
+  EXPECT_TRUE(_matches("%ab", "cab"));
+  EXPECT_FALSE(_matches("%ab", "abc"));
+  EXPECT_TRUE(_matches("%ab%", "xxabxx"));
+  EXPECT_FALSE(_matches("%ab%", "a b"));
+  EXPECT_TRUE(_matches("a%b%c", "abc"));
+  EXPECT_TRUE(_matches("a%b%c", "axxbxxbxxc"));
+  EXPECT_FALSE(_matches("a%b%c", "acb"));
+  EXPECT_TRUE(_matches("a%%c", "ac"));
+
+  // The first and the last segment must not overlap
+  EXPECT_FALSE(_matches("ab%ba", "aba"));
+  EXPECT_TRUE(_matches("ab%ba", "abba"));
+  EXPECT_FALSE(_matches("%aa%aa%", "aaa"));
+  EXPECT_TRUE(_matches("%aa%aa%", "aaaa"));
+}
+
+TEST_F(UtilsLikeMatcherTest, AnyChar) {
+  EXPECT_TRUE(_matches("a_c", "abc"));
+  EXPECT_FALSE(_matches("a_c", "ac"));
+  EXPECT_FALSE(_matches("a_c", "abbc"));
+  EXPECT_TRUE(_matches("___", "xyz"));
+  EXPECT_TRUE(_matches("%b_d%", "abcde"));
+  EXPECT_TRUE(_matches("%b_d%", "abxbcd"));
+  EXPECT_FALSE(_matches("%b_d%", "abdxd"));
+  EXPECT_TRUE(_matches("_%_", "ab"));
+  EXPECT_FALSE(_matches("_%_", "a"));
+}
+
+TEST_F(UtilsLikeMatcherTest, PatternTypes) {
+  EXPECT_EQ(LikeMatcher{"abc"}.pattern_type(), LikeMatcher::PatternType::Exact);
+  EXPECT_EQ(LikeMatcher{""}.pattern_type(), LikeMatcher::PatternType::Exact);
+  EXPECT_EQ(LikeMatcher{"abc%"}.pattern_type(), LikeMatcher::PatternType::Prefix);
+  EXPECT_EQ(LikeMatcher{"abc%%"}.pattern_type(), LikeMatcher::PatternType::Prefix);
+  EXPECT_EQ(LikeMatcher{"%abc"}.pattern_type(), LikeMatcher::PatternType::Suffix);
+  EXPECT_EQ(LikeMatcher{"%abc%"}.pattern_type(), LikeMatcher::PatternType::Contains);
+  EXPECT_EQ(LikeMatcher{"%"}.pattern_type(), LikeMatcher::PatternType::Contains);
+  EXPECT_EQ(LikeMatcher{"%%"}.pattern_type(), LikeMatcher::PatternType::Contains);
+  EXPECT_EQ(LikeMatcher{"a_c"}.pattern_type(), LikeMatcher::PatternType::Wildcard);
+  EXPECT_EQ(LikeMatcher{"%a%c%"}.pattern_type(), LikeMatcher::PatternType::Wildcard);
+
+  const auto values = std::vector<std::string>{"", "a", "abc", "xabc", "abcx", "xabcx", "aabcc", "ab", "bc", "abcabc"};
+  for (const auto& pattern : {"abc", "", "abc%", "%abc", "%abc%", "%", "%%", "%c", "a%", "%b%", "a_c%", "%a%c%"}) {
+    const auto like_matcher = LikeMatcher{pattern};
+    for (const auto& value : values) {
+      EXPECT_EQ(like_matcher.matches(value), _reference_matches(pattern, value)) << pattern << " " << value;
+    }
+  }
+}
+
+TEST_F(UtilsLikeMatcherTest, ContainsFindsLaterOccurrences) {
+  // The first byte of the literal occurs several times before the literal does
+  EXPECT_TRUE(_matches("%aab%", "aaaaab"));
+  EXPECT_TRUE(_matches("%abab%", "abaabab"));
+  EXPECT_FALSE(_matches("%abab%", "abaaba"));
+  EXPECT_TRUE(_matches("%b%", "aaab"));
+  EXPECT_FALSE(_matches("%b%", "aaa"));
+  EXPECT_FALSE(_matches("%abcd%", "abc"));
+}
+
+}  // namespace opossum
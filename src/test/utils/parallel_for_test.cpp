@@ -0,0 +1,45 @@
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/parallel_for.hpp"
+
+namespace opossum {
+
+class UtilsParallelForTest : public BaseTest {};
+
+TEST_F(UtilsParallelForTest, CallsFunctorOncePerIndex) {
+  auto calls = std::vector<std::atomic<uint32_t>>(1'000);
+  parallel_for(calls.size(), 4, [&](const size_t index) { ++calls[index]; });
+  for (const auto& call_count : calls) {
+    EXPECT_EQ(call_count, 1u);
+  }
+
+  parallel_for(0, 4, [&](const size_t index) { ++calls[index]; });
+  parallel_for(calls.size(), 0, [&](const size_t index) { ++calls[index]; });
+  for (const auto& call_count : calls) {
+    EXPECT_EQ(call_count, 2u);
+  }
+}
+
+TEST_F(UtilsParallelForTest, UsesAtMostMaxWorkerCountThreads) {
+  auto mutex = std::mutex{};
+  auto thread_ids = std::set<std::thread::id>{};
+  parallel_for(100, 3, [&](const size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    thread_ids.insert(std::this_thread::get_id());
+  });
+  EXPECT_LE(thread_ids.size(), 3u);
+
+  // A single worker is the calling thread
+  thread_ids.clear();
+  parallel_for(100, 1, [&](const size_t index) { thread_ids.insert(std::this_thread::get_id()); });
+  EXPECT_EQ(thread_ids, std::set<std::thread::id>{std::this_thread::get_id()});
+}
+
+}  // namespace opossum
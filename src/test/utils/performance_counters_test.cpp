@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/value_column.hpp"
+#include "../lib/utils/performance_counters.hpp"
+#include "../lib/utils/performance_warning.hpp"
+
+namespace opossum {
+
+class UtilsPerformanceCountersTest : public BaseTest {
+ protected:
+  void SetUp() override { PerformanceCounters::get().reset(); }
+
+  // returns the snapshot of the only counter whose name starts with prefix
+  static PerformanceCounterSnapshot counter_with_prefix(const std::string& prefix) {
+    const auto counters = PerformanceCounters::get().snapshot();
+    const auto matches = std::count_if(counters.cbegin(), counters.cend(),
+                                       [&](const auto& counter) { return counter.name.find(prefix) == 0; });
+    EXPECT_EQ(matches, 1);
+    return *std::find_if(counters.cbegin(), counters.cend(),
+                         [&](const auto& counter) { return counter.name.find(prefix) == 0; });
+  }
+};
+
+TEST_F(UtilsPerformanceCountersTest, RegisterCounter) {
+  auto& performance_counters = PerformanceCounters::get();
+  const auto counter_id = performance_counters.register_counter("test_register_counter");
+  EXPECT_EQ(performance_counters.register_counter("test_register_counter"), counter_id);
+  EXPECT_NE(performance_counters.register_counter("test_register_other_counter"), counter_id);
+
+  PerformanceCounters::increment(counter_id, 3);
+  PerformanceCounters::add_time(counter_id, std::chrono::nanoseconds{42});
+  const auto counter = counter_with_prefix("test_register_counter");
+  EXPECT_EQ(counter.count, 3u);
+  EXPECT_EQ(counter.time.count(), 42);
+}
+
+TEST_F(UtilsPerformanceCountersTest, CountsPerCallSite) {
+  for (auto index = 0; index < 5; ++index) {
+    PerformanceCount("test_call_site");
+  }
+  PerformanceCount("test_call_site");
+
+  const auto counters = PerformanceCounters::get().snapshot();
+  auto counts = std::vector<uint64_t>{};
+  for (const auto& counter : counters) {
+    if (counter.name.find("test_call_site at src/test/utils/performance_counters_test.cpp:") == 0) {
+      counts.push_back(counter.count);
+    }
+  }
+  EXPECT_EQ(counts, std::vector<uint64_t>({5, 1}));
+}
+
+TEST_F(UtilsPerformanceCountersTest, Timer) {
+  for (auto index = 0; index < 2; ++index) {
+    PerformanceTimerScope("test_timer");
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  const auto counter = counter_with_prefix("test_timer");
+  EXPECT_EQ(counter.count, 2u);
+  EXPECT_GE(counter.time, std::chrono::milliseconds{2});
+}
+
+TEST_F(UtilsPerformanceCountersTest, SumsUpThreads) {
+  const auto counter_id = PerformanceCounters::get().register_counter("test_threads");
+  PerformanceCounters::increment(counter_id);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&]() {
+      for (auto index = 0; index < 1000; ++index) {
+        PerformanceCounters::increment(counter_id);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // The threads have exited, their values are kept nonetheless
+  EXPECT_EQ(counter_with_prefix("test_threads").count, 4001u);
+
+  PerformanceCounters::get().reset();
+  EXPECT_EQ(counter_with_prefix("test_threads").count, 0u);
+}
+
+TEST_F(UtilsPerformanceCountersTest, PerformanceWarningCounts) {
+  auto column = ValueColumn<int32_t>{};
+  column.append(4);
+
+  // Counting also happens if warnings are disabled
+  PerformanceWarningDisabler performance_warning_disabler;
+  column[0];
+  column[0];
+  EXPECT_EQ(counter_with_prefix("operator[] used at src/lib/storage/value_column.cpp:").count, 2u);
+}
+
+TEST_F(UtilsPerformanceCountersTest, Print) {
+  const auto counter_id = PerformanceCounters::get().register_counter("test_\"print\"");
+  PerformanceCounters::increment(counter_id, 7);
+  PerformanceCounters::add_time(counter_id, std::chrono::nanoseconds{11});
+
+  std::stringstream text;
+  PerformanceCounters::get().print(text);
+  EXPECT_NE(text.str().find("test_\"print\"\t7\t11\n"), std::string::npos);
+
+  std::stringstream json;
+  PerformanceCounters::get().print_json(json);
+  EXPECT_EQ(json.str().front(), '[');
+  EXPECT_NE(json.str().find("{\"name\": \"test_\\\"print\\\"\", \"count\": 7, \"nanoseconds\": 11}"),
+            std::string::npos);
+}
+
+}  // namespace opossum